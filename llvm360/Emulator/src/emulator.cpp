@@ -2,11 +2,24 @@
 #include "Naive+.h"
 #include <locale>
 #include <codecvt>
+#include <cstring>
+#include <cstdlib>
 
 
 int main(int argc, char *argv[])
 {
 	std::wstring path;
+	if (argc >= 3 && strcmp(argv[1], "--bench-load") == 0) {
+		path = std::wstring_convert<std::codecvt_utf8<wchar_t>>().from_bytes(argv[2]);
+		bool verify = !(argc >= 5 && strcmp(argv[4], "--no-verify") == 0);
+		BenchmarkLoader(path, argc >= 4 ? atoi(argv[3]) : 5, verify);
+		return 0;
+	}
+	if (argc >= 3 && strcmp(argv[1], "--bench-decode") == 0) {
+		path = std::wstring_convert<std::codecvt_utf8<wchar_t>>().from_bytes(argv[2]);
+		BenchmarkDecoder(path, argc >= 4 ? atoi(argv[3]) : 10);
+		return 0;
+	}
 	if (argc < 2) {
 		path = L"./kernel17559.exe";
 	} else {
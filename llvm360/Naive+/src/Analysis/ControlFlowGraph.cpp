@@ -0,0 +1,127 @@
+#include "ControlFlowGraph.h"
+#include "Decoder/InstructionRegistry.h"
+#include <algorithm>
+#include <bit>
+
+namespace Analysis
+{
+	void ControlFlowGraph::reset(uint32_t start, uint32_t end)
+	{
+		m_start = start;
+		m_end = end;
+		m_leaders.assign(((end - start) / 4 + 63) / 64, 0);
+		m_blockStart.clear();
+		m_blockEnd.clear();
+		m_succOffsets.clear();
+		m_succ.clear();
+		m_predOffsets.clear();
+		m_pred.clear();
+		addLeader(start);
+	}
+
+	uint32_t ControlFlowGraph::blockOf(uint32_t address) const
+	{
+		if (!contains(address) || m_blockStart.empty())
+			return NoBlock;
+		auto it = std::upper_bound(m_blockStart.begin(), m_blockStart.end(), address);
+		return (uint32_t)(it - m_blockStart.begin()) - 1;
+	}
+
+	// table of the bctr at <address>, nullptr if it has none
+	static const JumpTable* FindTable(const std::vector<JumpTable>* tables, uint32_t address)
+	{
+		if (tables == nullptr)
+			return nullptr;
+		auto it = std::lower_bound(tables->begin(), tables->end(), address,
+			[](const JumpTable& table, uint32_t addr) { return table.m_branch < addr; });
+		return it != tables->end() && it->m_branch == address ? &*it : nullptr;
+	}
+
+	void BuildControlFlowGraph(const CodeSection& section, uint32_t start, uint32_t end, ControlFlowGraph& cfg,
+		const std::vector<JumpTable>* tables)
+	{
+		cfg.reset(start, end);
+		if (tables)
+		{
+			for (const JumpTable& table : *tables)
+			{
+				for (uint32_t target : table.m_targets)
+					cfg.addLeader(target);
+			}
+		}
+
+		// leaders and terminators in one pass over the branches of the function, the other instructions are skipped
+		// a word at a time in the branch bitmap
+		const std::vector<uint64_t>& branches = section.m_flagBits[std::countr_zero(INSTR_BRANCH)];
+		size_t last = section.indexOf(end);
+		for (size_t i = section.nextSet(branches, section.indexOf(start)); i < last; i = section.nextSet(branches, i + 1))
+		{
+			uint16_t flags = section.m_flags[i];
+			if (flags & INSTR_LINK)
+				continue;
+			uint32_t address = section.m_address + (uint32_t)i * 4;
+			cfg.addLeader(address + 4);
+			if (InstructionRegistry::IsDirectBranch(section.m_opcodes[i]))
+				cfg.addLeader(InstructionRegistry::GetBranchTarget(section.m_opcodes[i], section.m_words[i], address));
+		}
+
+		for (size_t word = 0; word < cfg.m_leaders.size(); word++)
+		{
+			for (uint64_t bits = cfg.m_leaders[word]; bits; bits &= bits - 1)
+			{
+				size_t index = word * 64 + std::countr_zero(bits);
+				uint32_t address = cfg.m_start + (uint32_t)index * 4;
+				if (!cfg.m_blockStart.empty())
+					cfg.m_blockEnd.push_back(address);
+				cfg.m_blockStart.push_back(address);
+			}
+		}
+		cfg.m_blockEnd.push_back(cfg.m_end);
+
+		// successors from the last instruction of each block
+		uint32_t blocks = (uint32_t)cfg.blockCount();
+		cfg.m_succOffsets.push_back(0);
+		for (uint32_t b = 0; b < blocks; b++)
+		{
+			uint32_t address = cfg.m_blockEnd[b] - 4;
+			size_t i = section.indexOf(address);
+			uint16_t flags = section.m_flags[i];
+			bool fallthrough = !(flags & INSTR_BRANCH) || (flags & (INSTR_CONDITIONAL | INSTR_LINK));
+			if ((flags & INSTR_BRANCH) && !(flags & INSTR_LINK) && InstructionRegistry::IsDirectBranch(section.m_opcodes[i]))
+			{
+				uint32_t target = InstructionRegistry::GetBranchTarget(section.m_opcodes[i], section.m_words[i], address);
+				if (cfg.isLeader(target))
+					cfg.m_succ.push_back(cfg.blockOf(target));
+			}
+			if (const JumpTable* table = (flags & INSTR_INDIRECT) ? FindTable(tables, address) : nullptr)
+			{
+				// one edge per distinct case
+				for (uint32_t target : table->m_targets)
+					cfg.m_succ.push_back(cfg.blockOf(target));
+				std::sort(cfg.m_succ.begin() + cfg.m_succOffsets.back(), cfg.m_succ.end());
+				cfg.m_succ.erase(std::unique(cfg.m_succ.begin() + cfg.m_succOffsets.back(), cfg.m_succ.end()), cfg.m_succ.end());
+			}
+			if (fallthrough && b + 1 < blocks)
+			{
+				// bc to the next instruction is a single edge
+				if (cfg.m_succ.size() == cfg.m_succOffsets.back() || cfg.m_succ.back() != b + 1)
+					cfg.m_succ.push_back(b + 1);
+			}
+			cfg.m_succOffsets.push_back((uint32_t)cfg.m_succ.size());
+		}
+
+		// predecessors, counting sort of the edges by target filled back to front, so each list is in block order
+		// and m_predOffsets ends up at the start of every range
+		cfg.m_predOffsets.assign(blocks + 1, 0);
+		for (uint32_t target : cfg.m_succ)
+			cfg.m_predOffsets[target]++;
+		for (uint32_t b = 1; b <= blocks; b++)
+			cfg.m_predOffsets[b] += cfg.m_predOffsets[b - 1];
+		cfg.m_pred.resize(cfg.m_succ.size());
+		for (uint32_t b = blocks; b-- > 0;)
+		{
+			for (uint32_t e = cfg.m_succOffsets[b + 1]; e-- > cfg.m_succOffsets[b];)
+				cfg.m_pred[--cfg.m_predOffsets[cfg.m_succ[e]]] = b;
+		}
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "Naive+/Naive+.h"
+#include "JumpTable.h"
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+namespace Analysis
+{
+	using CodeSection = PBinaryHandle::CodeSection;
+
+	// Basic blocks of one function and the edges between them, in flat arrays (CSR) so nothing is allocated per block
+	// and a graph can be reset and reused for the next function.
+	// block b covers [m_blockStart[b], m_blockEnd[b]), blocks are numbered in address order
+	// its successors are m_succ[m_succOffsets[b]] .. m_succ[m_succOffsets[b + 1] - 1], the same for predecessors
+	struct ControlFlowGraph
+	{
+		static const uint32_t NoBlock = ~0u;
+
+		uint32_t m_start = 0;
+		uint32_t m_end = 0;		// one past the last instruction
+		std::vector<uint64_t> m_leaders;	// bit (address - m_start) / 4 set when a block begins there
+		std::vector<uint32_t> m_blockStart;
+		std::vector<uint32_t> m_blockEnd;
+		std::vector<uint32_t> m_succOffsets;	// blockCount() + 1 entries
+		std::vector<uint32_t> m_succ;
+		std::vector<uint32_t> m_predOffsets;
+		std::vector<uint32_t> m_pred;
+
+		// empty graph of the function [start, end) with a leader at <start>, the arrays keep their capacity
+		void reset(uint32_t start, uint32_t end);
+
+		size_t blockCount() const { return m_blockStart.size(); }
+		bool contains(uint32_t address) const { return address >= m_start && address < m_end; }
+		bool isLeader(uint32_t address) const
+		{
+			if (!contains(address) || (address & 3))
+				return false;
+			size_t index = (address - m_start) / 4;
+			return (m_leaders[index / 64] >> (index % 64)) & 1;
+		}
+		// mark <address> as the start of a block, addresses outside the function are ignored
+		void addLeader(uint32_t address)
+		{
+			if (!contains(address) || (address & 3))
+				return;
+			size_t index = (address - m_start) / 4;
+			m_leaders[index / 64] |= 1ull << (index % 64);
+		}
+
+		// block that contains <address>, NoBlock outside the function
+		uint32_t blockOf(uint32_t address) const;
+
+		std::pair<const uint32_t*, const uint32_t*> successors(uint32_t block) const
+		{
+			return { m_succ.data() + m_succOffsets[block], m_succ.data() + m_succOffsets[block + 1] };
+		}
+		std::pair<const uint32_t*, const uint32_t*> predecessors(uint32_t block) const
+		{
+			return { m_pred.data() + m_predOffsets[block], m_pred.data() + m_predOffsets[block + 1] };
+		}
+	};
+
+	// Blocks and edges of the function [start, end) of <section>, in one pass over its branches: every direct target
+	// inside the function and the instruction after every branch that doesn't return (anything but bl) begin a block.
+	// Targets outside the function are tail branches and get no edge, neither does a block ending in blr or a bctr
+	// that has no table in <tables> (FindJumpTables), the cases of a table are blocks and successors of its bctr.
+	void BuildControlFlowGraph(const CodeSection& section, uint32_t start, uint32_t end, ControlFlowGraph& cfg,
+		const std::vector<JumpTable>* tables = nullptr);
+}
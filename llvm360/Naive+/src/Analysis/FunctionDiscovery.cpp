@@ -0,0 +1,228 @@
+#include "FunctionDiscovery.h"
+#include "Decoder/InstructionRegistry.h"
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace Analysis
+{
+	// functions scanned by one task
+	static const size_t ScanBatch = 256;
+
+	static const CodeSection* FindSection(const std::vector<CodeSection>& code, uint32_t address)
+	{
+		for (const CodeSection& section : code)
+		{
+			if (section.contains(address))
+				return &section;
+		}
+		return nullptr;
+	}
+
+	// a word aligned address of a known instruction
+	static bool IsCode(const std::vector<CodeSection>& code, uint32_t address)
+	{
+		const CodeSection* section = FindSection(code, address);
+		return section && (address & 3) == 0 && section->isValid(section->indexOf(address));
+	}
+
+	static bool TestBit(const std::vector<uint64_t>& bits, size_t index) { return (bits[index / 64] >> (index % 64)) & 1; }
+
+	// Walk <func> from its first instruction along every path, <starts> has a bit per instruction of <section> that begins a function
+	// direct branches that leave the function and bl targets go to <callees>, m_end is set when it wasn't known
+	// <seen> and <pending> are scratch buffers, reused from one function to the next
+	static void ScanFunction(const CodeSection& section, const std::vector<uint64_t>& starts, Function& func,
+		std::vector<uint32_t>& callees, size_t& reached, std::vector<uint64_t>& seen, std::vector<size_t>& pending)
+	{
+		size_t first = section.indexOf(func.m_address);
+		size_t limit = func.m_end ? std::min(section.m_count, (size_t)section.indexOf(func.m_end)) : section.m_count;
+		auto isInside = [&](uint32_t target)
+		{
+			if (func.m_end)
+				return target >= func.m_address && target < func.m_end;
+			return target >= func.m_address && section.contains(target) && (target == func.m_address || !TestBit(starts, section.indexOf(target)));
+		};
+
+		// instructions already walked, bit i - first, grows with the function
+		seen.clear();
+		auto visit = [&](size_t i)
+		{
+			size_t bit = i - first;
+			if (bit / 64 >= seen.size())
+				seen.resize(bit / 64 + 1, 0);
+			uint64_t mask = 1ull << (bit % 64);
+			bool fresh = !(seen[bit / 64] & mask);
+			seen[bit / 64] |= mask;
+			return fresh;
+		};
+
+		size_t last = first;
+		pending.assign(1, first);
+		while (!pending.empty())
+		{
+			size_t i = pending.back();
+			pending.pop_back();
+
+			for (; i < limit; i++)
+			{
+				// falling through into the next function or into data, or joining a path that was already walked
+				if ((i != first && TestBit(starts, i)) || !section.isValid(i) || !visit(i))
+					break;
+				last = std::max(last, i);
+				reached++;
+
+				uint16_t flags = section.m_flags[i];
+				if (!(flags & INSTR_BRANCH))
+					continue;
+				bool conditional = (flags & INSTR_CONDITIONAL) != 0;
+				if (flags & INSTR_INDIRECT)
+				{
+					// blr / bctr end the path, the targets of a bctr are resolved when the function is emitted
+					if (conditional || (flags & INSTR_LINK))
+						continue;
+					break;
+				}
+
+				uint32_t address = section.m_address + (uint32_t)i * 4;
+				uint32_t target = InstructionRegistry::GetBranchTarget(section.m_opcodes[i], section.m_words[i], address);
+				if (flags & INSTR_LINK)
+				{
+					callees.push_back(target);
+					continue;
+				}
+				if (isInside(target))
+					pending.push_back(section.indexOf(target));
+				else
+					callees.push_back(target);	// tail branch
+				if (!conditional)
+					break;
+			}
+		}
+
+		if (func.m_end == 0)
+			func.m_end = section.m_address + (uint32_t)(last + 1) * 4;
+	}
+
+	DiscoveryStats DiscoverFunctions(const std::vector<CodeSection>& code, const XrefIndex& xrefs, std::vector<Function> seeds,
+		std::vector<Function>& functions)
+	{
+		DiscoveryStats stats;
+		functions.clear();
+
+		// one seed per address, exact bounds win and the lowest source (entry, export, pdata) names it
+		seeds.erase(std::remove_if(seeds.begin(), seeds.end(), [&](const Function& seed) { return !IsCode(code, seed.m_address); }), seeds.end());
+		std::sort(seeds.begin(), seeds.end(), [](const Function& a, const Function& b) { return a.m_address < b.m_address; });
+		std::vector<Function> pending;
+		for (const Function& seed : seeds)
+		{
+			if (!pending.empty() && pending.back().m_address == seed.m_address)
+			{
+				Function& merged = pending.back();
+				merged.m_end = merged.m_end ? merged.m_end : seed.m_end;
+				merged.m_source = std::min(merged.m_source, seed.m_source);
+				continue;
+			}
+			pending.push_back(seed);
+		}
+		stats.seeds = pending.size();
+
+		// functions with exact bounds, calls into the middle of one are not new functions
+		std::vector<Function> bounded;
+		for (const Function& func : pending)
+		{
+			if (func.m_end)
+				bounded.push_back(func);
+		}
+		auto inBounded = [&](uint32_t address)
+		{
+			auto it = std::upper_bound(bounded.begin(), bounded.end(), address,
+				[](uint32_t addr, const Function& func) { return addr < func.m_address; });
+			return it != bounded.begin() && (it - 1)->contains(address);
+		};
+
+		// every seed and every bl target of the sweep begins a function, fixed before the descent so
+		// a scan doesn't depend on what the other scans of its round found
+		// <known> has the functions that are already queued, both are a bit per instruction of each section
+		std::vector<std::vector<uint64_t>> starts(code.size());
+		std::vector<std::vector<uint64_t>> known(code.size());
+		for (size_t i = 0; i < code.size(); i++)
+		{
+			starts[i].resize((code[i].m_count + 63) / 64, 0);
+			known[i].resize((code[i].m_count + 63) / 64, 0);
+		}
+		auto setBit = [&](std::vector<std::vector<uint64_t>>& bits, uint32_t address)
+		{
+			const CodeSection* section = FindSection(code, address);
+			size_t index = section->indexOf(address);
+			bits[section - code.data()][index / 64] |= 1ull << (index % 64);
+		};
+		auto isKnown = [&](uint32_t address)
+		{
+			const CodeSection* section = FindSection(code, address);
+			return TestBit(known[section - code.data()], section->indexOf(address));
+		};
+		for (const Function& func : pending)
+		{
+			setBit(starts, func.m_address);
+			setBit(known, func.m_address);
+		}
+		for (size_t i = 0; i < xrefs.size(); i++)
+		{
+			if (xrefs.m_kinds[i] == XrefIndex::XREF_CALL && IsCode(code, xrefs.m_targets[i]))
+				setBit(starts, xrefs.m_targets[i]);
+		}
+
+		while (!pending.empty())
+		{
+			stats.rounds++;
+
+			// batches of functions per task, the callees of a batch are one vector and batches merge in order
+			size_t batches = (pending.size() + ScanBatch - 1) / ScanBatch;
+			std::vector<std::vector<uint32_t>> callees(batches);
+			std::vector<size_t> reached(batches, 0);
+			ThreadPool::global().parallelFor(batches, [&](size_t batch)
+			{
+				std::vector<uint64_t> seen;
+				std::vector<size_t> scratch;
+				size_t end = std::min(pending.size(), (batch + 1) * ScanBatch);
+				for (size_t i = batch * ScanBatch; i < end; i++)
+				{
+					const CodeSection* section = FindSection(code, pending[i].m_address);
+					ScanFunction(*section, starts[section - code.data()], pending[i], callees[batch], reached[batch], seen, scratch);
+				}
+			});
+
+			std::vector<uint32_t> next;
+			for (size_t batch = 0; batch < batches; batch++)
+			{
+				stats.instructions += reached[batch];
+				for (uint32_t target : callees[batch])
+				{
+					if (IsCode(code, target) && !isKnown(target) && !inBounded(target))
+						next.push_back(target);
+				}
+			}
+			size_t merged = functions.size();
+			functions.insert(functions.end(), pending.begin(), pending.end());
+			std::inplace_merge(functions.begin(), functions.begin() + merged, functions.end(),
+				[](const Function& a, const Function& b) { return a.m_address < b.m_address; });
+
+			std::sort(next.begin(), next.end());
+			next.erase(std::unique(next.begin(), next.end()), next.end());
+			pending.clear();
+			for (uint32_t target : next)
+			{
+				setBit(known, target);
+				pending.push_back({ target, 0, Function::FUNCTION_CALL });
+			}
+			stats.discovered += pending.size();
+		}
+
+		// a function found by the descent can run over the start of one found later, it ends there
+		for (size_t i = 0; i + 1 < functions.size(); i++)
+		{
+			if (functions[i].m_end > functions[i + 1].m_address && functions[i].m_source != Function::FUNCTION_PDATA)
+				functions[i].m_end = functions[i + 1].m_address;
+		}
+		return stats;
+	}
+}
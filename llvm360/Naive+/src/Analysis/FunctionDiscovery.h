@@ -0,0 +1,28 @@
+#pragma once
+#include "Naive+/Naive+.h"
+#include <cstdint>
+#include <vector>
+
+namespace Analysis
+{
+	using CodeSection = PBinaryHandle::CodeSection;
+	using XrefIndex = PBinaryHandle::XrefIndex;
+	using Function = PBinaryHandle::Function;
+
+	struct DiscoveryStats
+	{
+		size_t seeds = 0;		// distinct seed addresses that landed on code
+		size_t discovered = 0;	// functions only found by following calls
+		size_t rounds = 0;
+		size_t instructions = 0;	// instructions reached by the descent
+	};
+
+	// Recursive descent over the decoded sections of a handle, starting from <seeds> (entry point, exports, .pdata;
+	// m_end is kept for seeds that already have exact bounds, 0 otherwise).
+	// Every function is walked along its branches until blr, bctr or a tail branch; bl targets become new functions.
+	// Functions are scanned in rounds, each round in parallel over the global ThreadPool, and a scan only reads
+	// state fixed before the descent, so <functions> is the same whatever the thread count.
+	// <functions> receives every function sorted by address, a function without exact bounds ends at the next one
+	DiscoveryStats DiscoverFunctions(const std::vector<CodeSection>& code, const XrefIndex& xrefs, std::vector<Function> seeds,
+		std::vector<Function>& functions);
+}
@@ -0,0 +1,253 @@
+#include "JumpTable.h"
+#include "Decoder/InstructionRegistry.h"
+#include "Loader/ImageLoader.h"
+#include <bit>
+
+namespace Analysis
+{
+	// instructions walked back from a bctr to its bound check
+	static const size_t JumpTableWindow = 16;
+
+	static constexpr OpcodeID OpAddi = InstructionRegistry::FindOpcode("addi");
+	static constexpr OpcodeID OpAddis = InstructionRegistry::FindOpcode("addis");
+	static constexpr OpcodeID OpOri = InstructionRegistry::FindOpcode("ori");
+	static constexpr OpcodeID OpOr = InstructionRegistry::FindOpcode("orx");
+	static constexpr OpcodeID OpAdd = InstructionRegistry::FindOpcode("addx");
+	static constexpr OpcodeID OpRlwinm = InstructionRegistry::FindOpcode("rlwinmx");
+	static constexpr OpcodeID OpLwzx = InstructionRegistry::FindOpcode("lwzx");
+	static constexpr OpcodeID OpLhzx = InstructionRegistry::FindOpcode("lhzx");
+	static constexpr OpcodeID OpLbzx = InstructionRegistry::FindOpcode("lbzx");
+	static constexpr OpcodeID OpMtspr = InstructionRegistry::FindOpcode("mtspr");
+	static constexpr OpcodeID OpCmpli = InstructionRegistry::FindOpcode("cmpli");
+	static constexpr OpcodeID OpBc = InstructionRegistry::FindOpcode("bcx");
+	static constexpr OpcodeID OpBcctr = InstructionRegistry::FindOpcode("bcctrx");
+
+	// value of a register on the way back from a bctr, m_constant + (x << m_shift) where x is the case number
+	// (INDEX, held by m_reg before the table code) or the table entry it selects (ENTRY)
+	struct TableValue
+	{
+		enum Kind { UNKNOWN, CONSTANT, INDEX, ENTRY };
+
+		Kind m_kind = UNKNOWN;
+		uint32_t m_constant = 0;
+		uint32_t m_shift = 0;
+		uint32_t m_reg = 0;
+		// ENTRY: m_entrySize bytes at m_table + (case number << m_indexShift)
+		uint32_t m_table = 0;
+		uint32_t m_entrySize = 0;
+		uint32_t m_indexShift = 0;
+	};
+
+	static TableValue Constant(uint32_t value)
+	{
+		TableValue v;
+		v.m_kind = TableValue::CONSTANT;
+		v.m_constant = value;
+		return v;
+	}
+
+	static TableValue AddConstant(TableValue v, uint32_t value)
+	{
+		v.m_constant += value;
+		return v;
+	}
+
+	static TableValue Add(const TableValue& a, const TableValue& b)
+	{
+		if (a.m_kind == TableValue::CONSTANT)
+			return AddConstant(b, a.m_constant);
+		if (b.m_kind == TableValue::CONSTANT)
+			return AddConstant(a, b.m_constant);
+		return {};
+	}
+
+	// rlwinm, a shift left of a case number or entry only drops bits a bounded value doesn't have
+	static TableValue Rotate(TableValue v, uint32_t sh, uint32_t mb, uint32_t me)
+	{
+		uint32_t mask = mb <= me ? (~0u >> mb) & (~0u << (31 - me)) : (~0u >> mb) | (~0u << (31 - me));
+		if (v.m_kind == TableValue::CONSTANT)
+			return Constant(std::rotl(v.m_constant, (int)sh) & mask);
+		if (v.m_kind == TableValue::UNKNOWN || v.m_constant != 0 || me != 31 - sh)
+			return {};
+		v.m_shift += sh;
+		return v;
+	}
+
+	// <reg> may be written by the instruction at <i>, for the instructions Resolve doesn't follow
+	static bool MayWrite(const CodeSection& section, size_t i, uint32_t reg)
+	{
+		uint32_t word = section.m_words[i];
+		if (section.m_flags[i] & INSTR_STORE)
+			return Field<16, 5>::get(word) == reg;	// update forms
+		return Field<21, 5>::get(word) == reg || Field<16, 5>::get(word) == reg;
+	}
+
+	// value of <reg> before the instruction at <at>, following its definitions back to <lo>
+	static TableValue Resolve(const CodeSection& section, size_t lo, size_t at, uint32_t reg)
+	{
+		for (size_t i = at; i-- > lo;)
+		{
+			OpcodeID opcode = section.m_opcodes[i];
+			uint32_t word = section.m_words[i];
+			if (opcode == OpAddi || opcode == OpAddis)
+			{
+				Operands<FORM_D> op = Operands<FORM_D>::decode(word);
+				if (op.D != reg)
+					continue;
+				uint32_t imm = opcode == OpAddis ? (uint32_t)op.SIMM << 16 : (uint32_t)op.SIMM;
+				return AddConstant(op.A == 0 ? Constant(0) : Resolve(section, lo, i, op.A), imm);
+			}
+			if (opcode == OpOri)
+			{
+				// ori has its source register in the D field
+				Operands<FORM_D> op = Operands<FORM_D>::decode(word);
+				if (op.A != reg)
+					continue;
+				TableValue v = Resolve(section, lo, i, op.D);
+				return v.m_kind == TableValue::CONSTANT ? Constant(v.m_constant | op.UIMM) : TableValue();
+			}
+			if (opcode == OpOr)
+			{
+				// mr rA, rS
+				Operands<FORM_X> op = Operands<FORM_X>::decode(word);
+				if (op.A != reg)
+					continue;
+				return op.D == op.B ? Resolve(section, lo, i, op.D) : TableValue();
+			}
+			if (opcode == OpRlwinm)
+			{
+				Operands<FORM_M> op = Operands<FORM_M>::decode(word);
+				if (op.A != reg)
+					continue;
+				return Rotate(Resolve(section, lo, i, op.S), op.SH, op.MB, op.ME);
+			}
+			if (opcode == OpAdd)
+			{
+				Operands<FORM_XO> op = Operands<FORM_XO>::decode(word);
+				if (op.D != reg)
+					continue;
+				return Add(Resolve(section, lo, i, op.A), Resolve(section, lo, i, op.B));
+			}
+			if (opcode == OpLwzx || opcode == OpLhzx || opcode == OpLbzx)
+			{
+				Operands<FORM_X> op = Operands<FORM_X>::decode(word);
+				if (op.D != reg)
+					continue;
+				TableValue address = Add(op.A == 0 ? Constant(0) : Resolve(section, lo, i, op.A), Resolve(section, lo, i, op.B));
+				if (address.m_kind != TableValue::INDEX)
+					return {};
+				TableValue v;
+				v.m_kind = TableValue::ENTRY;
+				v.m_reg = address.m_reg;
+				v.m_table = address.m_constant;
+				v.m_indexShift = address.m_shift;
+				v.m_entrySize = opcode == OpLwzx ? 4 : opcode == OpLhzx ? 2 : 1;
+				return v;
+			}
+			if (MayWrite(section, i, reg))
+				return {};
+		}
+
+		// not written between the bound check and the bctr, the case number
+		TableValue v;
+		v.m_kind = TableValue::INDEX;
+		v.m_reg = reg;
+		return v;
+	}
+
+	bool RecognizeJumpTable(const CodeSection& section, XLoader::IImage& image, uint32_t start, uint32_t end, uint32_t branch,
+		JumpTable& table)
+	{
+		// the table code is the straight line between the bound check and the bctr
+		size_t first = section.indexOf(start);
+		size_t k = section.indexOf(branch);
+		size_t lo = k;
+		while (lo > first && k - lo < JumpTableWindow && !(section.m_flags[lo - 1] & INSTR_BRANCH))
+			lo--;
+		if (lo == first || !(section.m_flags[lo - 1] & INSTR_BRANCH))
+			return false;
+
+		// mtctr rE
+		size_t mtctr = k;
+		while (mtctr > lo && !(section.m_opcodes[mtctr - 1] == OpMtspr && Operands<FORM_XFX>::decode(section.m_words[mtctr - 1]).spr == 9))
+			mtctr--;
+		if (mtctr == lo)
+			return false;
+		TableValue target = Resolve(section, lo, mtctr - 1, Operands<FORM_XFX>::decode(section.m_words[mtctr - 1]).D);
+		if (target.m_kind != TableValue::ENTRY)
+			return false;
+
+		// bgt crN, default after cmplwi crN, rI, count - 1 (or bge after cmplwi rI, count)
+		if (section.m_opcodes[lo - 1] != OpBc)
+			return false;
+		Operands<FORM_B> bc = Operands<FORM_B>::decode(section.m_words[lo - 1]);
+		if ((bc.BO & 0x10) || !(bc.BO & 0x04) || bc.AA || bc.LK)
+			return false;
+		bool onTrue = (bc.BO & 0x08) != 0;
+		size_t compare = lo - 1;
+		while (compare > first && lo - compare <= JumpTableWindow)
+		{
+			compare--;
+			uint16_t flags = section.m_flags[compare];
+			if (section.m_opcodes[compare] == OpCmpli && Operands<FORM_D>::decode(section.m_words[compare]).crfD == bc.BI / 4)
+				break;
+			if (flags & (INSTR_BRANCH | INSTR_WRITES_CR))
+				return false;
+			if (MayWrite(section, compare, target.m_reg))
+				return false;
+		}
+		Operands<FORM_D> cmp = Operands<FORM_D>::decode(section.m_words[compare]);
+		if (section.m_opcodes[compare] != OpCmpli || cmp.crfD != bc.BI / 4 || cmp.A != target.m_reg)
+			return false;
+		uint32_t count;
+		if (bc.BI % 4 == 1 && onTrue)
+			count = cmp.UIMM + 1;
+		else if (bc.BI % 4 == 0 && !onTrue)
+			count = cmp.UIMM;
+		else
+			return false;
+		if (count == 0)
+			return false;
+
+		uint32_t stride = 1u << target.m_indexShift;
+		size_t size = (size_t)(count - 1) * stride + target.m_entrySize;
+		const uint8_t* data = target.m_table >= image.getBaseAddress()
+			? image.materialize(target.m_table - image.getBaseAddress(), size) : nullptr;
+		if (data == nullptr)
+			return false;
+
+		table.m_branch = branch;
+		table.m_table = target.m_table;
+		table.m_entrySize = target.m_entrySize;
+		table.m_base = target.m_constant;
+		table.m_shift = target.m_shift;
+		table.m_targets.resize(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const uint8_t* entry = data + (size_t)i * stride;
+			uint32_t value = 0;
+			for (uint32_t b = 0; b < target.m_entrySize; b++)
+				value = (value << 8) | entry[b];
+			uint32_t address = table.m_base + (value << table.m_shift);
+			if (address < start || address >= end || (address & 3) || !section.isValid(section.indexOf(address)))
+				return false;
+			table.m_targets[i] = address;
+		}
+		return true;
+	}
+
+	void FindJumpTables(const CodeSection& section, XLoader::IImage& image, uint32_t start, uint32_t end, std::vector<JumpTable>& tables)
+	{
+		tables.clear();
+		const std::vector<uint64_t>& indirect = section.m_flagBits[std::countr_zero(INSTR_INDIRECT)];
+		size_t last = section.indexOf(end);
+		for (size_t i = section.nextSet(indirect, section.indexOf(start)); i < last; i = section.nextSet(indirect, i + 1))
+		{
+			if (section.m_opcodes[i] != OpBcctr || (section.m_flags[i] & (INSTR_CONDITIONAL | INSTR_LINK)))
+				continue;
+			JumpTable table;
+			if (RecognizeJumpTable(section, image, start, end, section.m_address + (uint32_t)i * 4, table))
+				tables.push_back(std::move(table));
+		}
+	}
+}
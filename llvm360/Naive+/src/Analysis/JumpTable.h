@@ -0,0 +1,33 @@
+#pragma once
+#include "Naive+/Naive+.h"
+#include <cstdint>
+#include <vector>
+
+namespace Analysis
+{
+	using CodeSection = PBinaryHandle::CodeSection;
+
+	// a switch table recovered from the instructions before a bctr
+	//   cmplwi crN, rI, count - 1 / bgt crN, default
+	//   lis rT, table@ha / addi rT, rT, table@l / rlwinm rO, rI, shift, ... / lwzx (lhzx, lbzx) rE, rT, rO
+	//   optionally rlwinm rE, rE, m_shift and add rE, rE, rB with rB = lis / addi base
+	//   mtctr rE / bctr
+	struct JumpTable
+	{
+		uint32_t m_branch = 0;		// the bctr
+		uint32_t m_table = 0;		// guest address of entry 0
+		uint32_t m_entrySize = 0;	// 4 (lwzx), 2 (lhzx) or 1 (lbzx)
+		uint32_t m_base = 0;		// case k branches to m_base + (entry k << m_shift), 0 for tables of addresses
+		uint32_t m_shift = 0;
+		std::vector<uint32_t> m_targets;	// one per case, every one inside the function
+	};
+
+	// Recover the table of the bctr at <branch> in the function [start, end) of <section>, the entries are read from <image>.
+	// False when the code before the bctr isn't a bounded table load or a target isn't an instruction of the function,
+	// the bctr then has to be dispatched at runtime.
+	bool RecognizeJumpTable(const CodeSection& section, XLoader::IImage& image, uint32_t start, uint32_t end, uint32_t branch,
+		JumpTable& table);
+
+	// RecognizeJumpTable for every bctr of [start, end), <tables> receives the recognized ones sorted by m_branch
+	void FindJumpTables(const CodeSection& section, XLoader::IImage& image, uint32_t start, uint32_t end, std::vector<JumpTable>& tables);
+}
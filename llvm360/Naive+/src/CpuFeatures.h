@@ -0,0 +1,78 @@
+#pragma once
+#include <cstdint>
+
+// Runtime detection of the host cpu extensions used by the SIMD paths
+// every accelerated kernel must be guarded by one of these and keep a portable fallback
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define HOST_X86 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+#else
+#define HOST_X86 0
+#endif
+
+// lets a single function use instructions the rest of the TU isn't compiled for
+#if HOST_X86 && !defined(_MSC_VER)
+#define TARGET_ATTR(x) __attribute__((target(x)))
+#else
+#define TARGET_ATTR(x)
+#endif
+
+struct CpuFeatures
+{
+    bool aes = false;
+    bool vaes = false;
+    bool avx2 = false;
+    bool sha = false;
+    bool ssse3 = false;
+    bool sse41 = false;
+
+    static const CpuFeatures& get()
+    {
+        static const CpuFeatures features = detect();
+        return features;
+    }
+
+private:
+    static CpuFeatures detect()
+    {
+        CpuFeatures f;
+#if HOST_X86
+        uint32_t leaf1[4] = {};
+        uint32_t leaf7[4] = {};
+#ifdef _MSC_VER
+        __cpuid((int*)leaf1, 1);
+        __cpuidex((int*)leaf7, 7, 0);
+#else
+        __cpuid(1, leaf1[0], leaf1[1], leaf1[2], leaf1[3]);
+        __cpuid_count(7, 0, leaf7[0], leaf7[1], leaf7[2], leaf7[3]);
+#endif
+        // AVX state must be enabled by the OS as well
+        bool osAvx = false;
+        if ((leaf1[2] & (1u << 27)) && (leaf1[2] & (1u << 28)))
+        {
+#ifdef _MSC_VER
+            uint64_t xcr0 = _xgetbv(0);
+#else
+            uint32_t lo, hi;
+            __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            uint64_t xcr0 = ((uint64_t)hi << 32) | lo;
+#endif
+            osAvx = (xcr0 & 0x6) == 0x6;
+        }
+
+        f.ssse3 = (leaf1[2] & (1u << 9)) != 0;
+        f.sse41 = (leaf1[2] & (1u << 19)) != 0;
+        f.aes = (leaf1[2] & (1u << 25)) != 0;
+        f.avx2 = osAvx && (leaf7[1] & (1u << 5)) != 0;
+        f.sha = (leaf7[1] & (1u << 29)) != 0;
+        f.vaes = f.avx2 && f.aes && (leaf7[2] & (1u << 9)) != 0;
+#endif
+        return f;
+    }
+};
@@ -1,183 +1,271 @@
 #include "InstructionRegistry.h"
+#include "CpuFeatures.h"
+#include <algorithm>
 
 
+// nothing to construct, the decode tables are constexpr data
 InstructionRegistry g_instrRegistry;
 
 
-InstructionRegistry::InstructionRegistry()
+void UnknownOpcodeHistogram::merge(const UnknownOpcodeHistogram& other)
 {
-	registerInstructions();
+	for (size_t i = 0; i < m_counts.size(); i++)
+	{
+		m_counts[i] += other.m_counts[i];
+	}
+	m_total += other.m_total;
 }
 
+std::vector<std::pair<uint32_t, uint32_t>> UnknownOpcodeHistogram::sorted() const
+{
+	using namespace InstructionTableIndex;
+
+	std::vector<std::pair<uint32_t, uint32_t>> entries;
+	for (uint32_t main = 0; main < 64; main++)
+	{
+		const OpcodeKey& key = keys[main];
+		if (key.m_extOffset == 0)
+		{
+			if (m_counts[extIDs.size() + main])
+				entries.emplace_back(main << 16, m_counts[extIDs.size() + main]);
+			continue;
+		}
+		for (uint32_t ext = 0; ext <= (key.m_extMASK >> key.m_extShift); ext++)
+		{
+			if (m_counts[key.m_extOffset + ext])
+				entries.emplace_back((main << 16) | ext, m_counts[key.m_extOffset + ext]);
+		}
+	}
+	std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b)
+	{
+		return a.second != b.second ? a.second > b.second : a.first < b.first;
+	});
+	return entries;
+}
+
+void UnknownOpcodeHistogram::formatKey(uint32_t key, char* out, size_t size)
+{
+	uint32_t main = key >> 16;
+	if (InstructionTableIndex::keys[main].m_extOffset == 0)
+	{
+		snprintf(out, size, "opcode %u", main);
+		return;
+	}
+	snprintf(out, size, "opcode %u / xo %u", main, key & 0xFFFF);
+}
+
+void InstructionRegistry::CountUnknown(const uint32_t* words, const uint64_t* valid, size_t count, UnknownOpcodeHistogram& unknown)
+{
+	for (size_t i = 0; i < count; i += 64)
+	{
+		size_t n = count - i < 64 ? count - i : 64;
+		uint64_t pending = ~valid[i / 64] & (n == 64 ? ~0ull : (1ull << n) - 1);
+		while (pending)
+		{
+			unknown.add(words[i + std::countr_zero(pending)]);
+			pending &= pending - 1;
+		}
+	}
+}
+
+
+static inline uint32_t loadBE32(const uint8_t* p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
 
+void InstructionRegistry::DecodeRangeScalar(const uint8_t* src, size_t count, OpcodeID* opcodes, uint32_t* words, uint64_t* valid)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		uint32_t data = loadBE32(src + i * 4);
+		words[i] = data;
+		opcodes[i] = DecodeOpcode(data);
+	}
+
+	if (valid)
+	{
+		for (size_t i = 0; i < count; i += 64)
+		{
+			uint64_t bits = 0;
+			size_t n = count - i < 64 ? count - i : 64;
+			for (size_t j = 0; j < n; j++)
+			{
+				bits |= (uint64_t)(opcodes[i + j] != OPCODE_INVALID) << j;
+			}
+			valid[i / 64] = bits;
+		}
+	}
+}
+
+#if HOST_X86
+TARGET_ATTR("avx2")
+static size_t DecodeRangeAVX2(const uint8_t* src, size_t count, OpcodeID* opcodes, uint32_t* words, uint64_t* valid)
+{
+	using namespace InstructionTableIndex;
+
+	const __m256i swap = _mm256_setr_epi8(
+		3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+		3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+	const __m256i idMask = _mm256_set1_epi32(0xFFFF);
+	const __m256i one = _mm256_set1_epi32(1);
+
+	// whole groups of 64 words, so every word of <valid> is written at once
+	size_t i = 0;
+	uint64_t bits = 0;
+	for (; i + 64 <= count || (i % 64) != 0; i += 8)
+	{
+		__m256i data = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i * 4)), swap);
+		_mm256_storeu_si256((__m256i*)(words + i), data);
+
+		// same as DecodeOpcode, the key and the id come from gathers
+		__m256i key = _mm256_i32gather_epi32((const int*)packedKeys.data(), _mm256_srli_epi32(data, 26), 4);
+		__m256i shift = _mm256_and_si256(_mm256_srli_epi32(key, 16), _mm256_set1_epi32(0x1F));
+		__m256i extMask = _mm256_sub_epi32(_mm256_sllv_epi32(one, _mm256_srli_epi32(key, 24)), one);
+		__m256i ext = _mm256_and_si256(_mm256_srlv_epi32(data, shift), extMask);
+		__m256i slot = _mm256_add_epi32(_mm256_and_si256(key, idMask), ext);
+		__m256i ids = _mm256_and_si256(_mm256_i32gather_epi32((const int*)extIDs.data(), slot, 2), idMask);
+
+		// 8 x 32 -> 8 x 16, packus works per 128 bit lane so the qwords are put back in order
+		__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(ids, ids), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm_storeu_si128((__m128i*)(opcodes + i), _mm256_castsi256_si128(packed));
+
+		uint32_t invalid = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(ids, _mm256_setzero_si256())));
+		bits |= (uint64_t)(~invalid & 0xFF) << (i % 64);
+		if (i % 64 == 56)
+		{
+			if (valid)
+			{
+				valid[i / 64] = bits;
+			}
+			bits = 0;
+		}
+	}
+	return i;
+}
+#endif
+
+bool InstructionRegistry::IsDecodeAccelerated()
+{
+#if HOST_X86
+	return CpuFeatures::get().avx2;
+#else
+	return false;
+#endif
+}
 
-void InstructionRegistry::InitialiseOpCodeKey(uint32_t mainOP, uint32_t extMASK)
+void InstructionRegistry::DecodeRange(const uint8_t* src, size_t count, OpcodeID* opcodes, uint32_t* words, uint64_t* valid)
 {
-	OpcodeKey val = { mainOP, extMASK };
-	m_mainOPs.try_emplace(mainOP, val);
+	size_t done = 0;
+#if HOST_X86
+	static const bool accelerated = IsDecodeAccelerated();
+	if (accelerated)
+	{
+		done = DecodeRangeAVX2(src, count, opcodes, words, valid);
+	}
+#endif
+	DecodeRangeScalar(src + done * 4, count - done, opcodes + done, words + done, valid ? valid + done / 64 : nullptr);
 }
 
-void InstructionRegistry::AddDescriptorToKey(uint32_t mainOP, std::string mnemonic, FormType type, uint32_t extOP)
+#if HOST_X86
+// <flag> in every lane where <def> has <rule> and bit 0 of <condition> is set
+TARGET_ATTR("avx2")
+static inline __m256i ApplyRuleAVX2(__m256i def, uint32_t rule, __m256i condition, uint16_t flag)
 {
-	auto it = m_mainOPs.find(mainOP);
-	if (it == m_mainOPs.end()) { printf("AddDescriptorToKey, Something is wrong :/, did you registerInstructions for this main Opcode? "); BREAKPOINT(); }
-	OpcodeKey& key = it->second;
-	uint32_t shift = __builtin_ctz(key.m_extMASK);
-	InstructionDescriptor desc = { mnemonic, type };
+	const __m256i one = _mm256_set1_epi32(1);
+	__m256i applies = _mm256_and_si256(_mm256_and_si256(_mm256_srli_epi32(def, std::countr_zero(rule)), condition), one);
+	return _mm256_and_si256(_mm256_cmpeq_epi32(applies, one), _mm256_set1_epi32(flag));
+}
 
-	key.m_descriptors.try_emplace(extOP << shift, desc);
+// GetFlags of 8 instructions
+TARGET_ATTR("avx2")
+static inline __m256i GetFlagsAVX2(const OpcodeID* opcodes, const uint32_t* words)
+{
+	const __m256i one = _mm256_set1_epi32(1);
+	__m256i ids = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)opcodes));
+	__m256i word = _mm256_loadu_si256((const __m256i*)words);
+	__m256i def = _mm256_i32gather_epi32((const int*)InstructionTableIndex::opcodeFlags.data(), ids, 4);
+
+	__m256i spr = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(word, 6), _mm256_set1_epi32(0x3E0)),
+		_mm256_and_si256(_mm256_srli_epi32(word, 16), _mm256_set1_epi32(0x1F)));
+	__m256i bo = _mm256_and_si256(_mm256_srli_epi32(word, 21), _mm256_set1_epi32(0x14));
+	__m256i notAlways = _mm256_andnot_si256(_mm256_cmpeq_epi32(bo, _mm256_set1_epi32(0x14)), one);
+	__m256i isXER = _mm256_and_si256(_mm256_cmpeq_epi32(spr, one), one);
+
+	__m256i flags = _mm256_and_si256(def, _mm256_set1_epi32(0xFFFF));
+	flags = _mm256_or_si256(flags, ApplyRuleAVX2(def, RULE_RC, word, INSTR_WRITES_CR));
+	flags = _mm256_or_si256(flags, ApplyRuleAVX2(def, RULE_OE, _mm256_srli_epi32(word, 10), INSTR_WRITES_XER));
+	flags = _mm256_or_si256(flags, ApplyRuleAVX2(def, RULE_LK, word, INSTR_LINK));
+	flags = _mm256_or_si256(flags, ApplyRuleAVX2(def, RULE_BO, notAlways, INSTR_CONDITIONAL));
+	flags = _mm256_or_si256(flags, ApplyRuleAVX2(def, RULE_SPR, _mm256_srli_epi32(spr, 4), INSTR_PRIVILEGED));
+	flags = _mm256_or_si256(flags, ApplyRuleAVX2(def, RULE_MTXER, isXER, INSTR_WRITES_XER));
+	return flags;
 }
 
+// 64 instructions: their flags and one word of every bitmap
+// packs keeps the sign of every 16 bit lane, so shifting the wanted bit to the top and packing
+// two vectors gives one byte per instruction for movemask
+TARGET_ATTR("avx2")
+static void ClassifyGroupAVX2(const OpcodeID* opcodes, const uint32_t* words, uint16_t* flags, uint64_t bits[INSTR_FLAG_COUNT])
+{
+	__m256i v[4];
+	for (int k = 0; k < 4; k++)
+	{
+		__m256i low = GetFlagsAVX2(opcodes + k * 16, words + k * 16);
+		__m256i high = GetFlagsAVX2(opcodes + k * 16 + 8, words + k * 16 + 8);
+		v[k] = _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+		_mm256_storeu_si256((__m256i*)(flags + k * 16), v[k]);
+	}
+	for (uint32_t bit = 0; bit < INSTR_FLAG_COUNT; bit++)
+	{
+		__m128i shift = _mm_cvtsi32_si128(15 - bit);
+		uint64_t word = 0;
+		for (int half = 0; half < 2; half++)
+		{
+			__m256i packed = _mm256_packs_epi16(_mm256_sll_epi16(v[half * 2], shift), _mm256_sll_epi16(v[half * 2 + 1], shift));
+			packed = _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+			word |= (uint64_t)(uint32_t)_mm256_movemask_epi8(packed) << (half * 32);
+		}
+		bits[bit] = word;
+	}
+}
+#endif
 
-// search "MAIN OP: <n>"
-void InstructionRegistry::registerInstructions()
+void InstructionRegistry::ClassifyRange(const OpcodeID* opcodes, const uint32_t* words, size_t count, uint16_t* flags, uint64_t* const* bitmaps)
 {
-	// MAIN OP: 0
-	InitialiseOpCodeKey(0, 0);
-	AddDescriptorToKey(0, "PADDING", FormType::FORM_PADDING);
-
-	// MAIN OP: 7
-	InitialiseOpCodeKey(7, 0);
-	AddDescriptorToKey(7, "mulli", FormType::FORM_D);
-	
-	// MAIN OP: 8
-	InitialiseOpCodeKey(8, 0);
-	AddDescriptorToKey(8, "subfic", FormType::FORM_D);
-
-	// MAIN OP: 10
-	InitialiseOpCodeKey(10, 0);
-	AddDescriptorToKey(10, "cmpli", FormType::FORM_D);
-	// MAIN OP: 11
-	InitialiseOpCodeKey(11, 0);
-	AddDescriptorToKey(11, "cmpi", FormType::FORM_D);
-
-	// MAIN OP: 13
-	InitialiseOpCodeKey(13, 0);
-	AddDescriptorToKey(13, "addic.", FormType::FORM_D);
-
-
-	// MAIN OP: 14
-	// MAIN OP: 15
-	InitialiseOpCodeKey(14, 0);
-	AddDescriptorToKey(14, "addi", FormType::FORM_D);
-	InitialiseOpCodeKey(15, 0);
-	AddDescriptorToKey(15, "addi", FormType::FORM_D);
-
-
-	// MAIN OP: 16
-	InitialiseOpCodeKey(16, 0);
-	AddDescriptorToKey(16, "bcx", FormType::FORM_B);
-
-	// MAIN OP: 17
-	InitialiseOpCodeKey(17, 0);
-	AddDescriptorToKey(17, "sc", FormType::FORM_SC);
-	
-	// MAIN OP: 18
-	InitialiseOpCodeKey(18, 0);
-	AddDescriptorToKey(18, "bx", FormType::FORM_I);
-
-	// MAIN OP: 19
-	InitialiseOpCodeKey(19, 0x7FE);
-	AddDescriptorToKey(19, "bclrx", FormType::FORM_XL, 16);
-	AddDescriptorToKey(19, "bcctrx", FormType::FORM_XL, 528);
-
-	// MAIN OP: 20
-	InitialiseOpCodeKey(20, 0);
-	AddDescriptorToKey(20, "rlwimix", FormType::FORM_M);
-
-	// MAIN OP: 21
-	InitialiseOpCodeKey(21, 0);
-	AddDescriptorToKey(21, "rlwinmx", FormType::FORM_M);
-
-	// MAIN OP: 24
-	InitialiseOpCodeKey(24, 0);
-	AddDescriptorToKey(24, "ori", FormType::FORM_D);
-
-	// MAIN OP: 25
-	InitialiseOpCodeKey(25, 0);
-	AddDescriptorToKey(25, "oris", FormType::FORM_D);
-
-	// MAIN OP: 26
-	InitialiseOpCodeKey(26, 0);
-	AddDescriptorToKey(26, "xori", FormType::FORM_D);
-
-	// MAIN OP: 28
-	InitialiseOpCodeKey(28, 0);
-	AddDescriptorToKey(28, "andi.", FormType::FORM_D);
-
-	// MAIN OP: 30
-	InitialiseOpCodeKey(30, 0xC);
-	AddDescriptorToKey(30, "rldiclx", FormType::FORM_MD, 0);
-	AddDescriptorToKey(30, "rldicrx", FormType::FORM_MD, 1);
-	AddDescriptorToKey(30, "rldimix", FormType::FORM_MD, 3);
-
-	// MAIN OP: 31
-	InitialiseOpCodeKey(31, 0x7FE);
-	AddDescriptorToKey(31, "mfspr", FormType::FORM_XFX, 339);
-	AddDescriptorToKey(31, "mtspr", FormType::FORM_XFX, 467);
-	AddDescriptorToKey(31, "orx", FormType::FORM_X, 444);
-	AddDescriptorToKey(31, "cmpl", FormType::FORM_X, 32);
-	AddDescriptorToKey(31, "cntlzwx", FormType::FORM_X, 26);
-	AddDescriptorToKey(31, "mfmsr", FormType::FORM_X, 83);
-	AddDescriptorToKey(31, "mtmsrd", FormType::FORM_X, 178);
-	AddDescriptorToKey(31, "lwarx", FormType::FORM_X, 20);
-	AddDescriptorToKey(31, "stwcx.", FormType::FORM_X, 150);
-	AddDescriptorToKey(31, "addx", FormType::FORM_XO, 266);
-	AddDescriptorToKey(31, "subfx", FormType::FORM_XO, 40);
-	AddDescriptorToKey(31, "cmp", FormType::FORM_X, 0);
-	AddDescriptorToKey(31, "lbzx", FormType::FORM_X, 87);
-	AddDescriptorToKey(31, "extshx", FormType::FORM_X, 922);
-	AddDescriptorToKey(31, "sync", FormType::FORM_X, 598);
-	AddDescriptorToKey(31, "sld", FormType::FORM_X, 27);
-	AddDescriptorToKey(31, "andc", FormType::FORM_X, 60);
-	AddDescriptorToKey(31, "mftb", FormType::FORM_XFX, 371);
-	AddDescriptorToKey(31, "extswx", FormType::FORM_X, 986);
-	AddDescriptorToKey(31, "negx", FormType::FORM_XO, 104);
-	AddDescriptorToKey(31, "lwzx", FormType::FORM_X, 23);
-	AddDescriptorToKey(31, "lhzx", FormType::FORM_X, 279);
-	AddDescriptorToKey(31, "srawix", FormType::FORM_X, 824);
-	AddDescriptorToKey(31, "addze", FormType::FORM_XO, 202);
-	AddDescriptorToKey(31, "stbx", FormType::FORM_X, 215);
-	AddDescriptorToKey(31, "sthx", FormType::FORM_X, 407);
-	AddDescriptorToKey(31, "andx", FormType::FORM_X, 28);
-	AddDescriptorToKey(31, "ldarx", FormType::FORM_X, 84);
-
-	// MAIN OP: 32
-	InitialiseOpCodeKey(32, 0);
-	AddDescriptorToKey(32, "lwz", FormType::FORM_D);
-
-	// MAIN OP: 34
-	InitialiseOpCodeKey(34, 0);
-	AddDescriptorToKey(34, "lbz", FormType::FORM_D);
-
-
-	// MAIN OP: 36
-	// MAIN OP: 37
-	InitialiseOpCodeKey(36, 0);
-	AddDescriptorToKey(36, "stw", FormType::FORM_D);
-	InitialiseOpCodeKey(37, 0);
-	AddDescriptorToKey(37, "stwu", FormType::FORM_D);
-
-	// MAIN OP: 38
-	InitialiseOpCodeKey(38, 0);
-	AddDescriptorToKey(38, "stb", FormType::FORM_D);
-
-	// MAIN OP: 40
-	InitialiseOpCodeKey(40, 0);
-	AddDescriptorToKey(40, "lhz", FormType::FORM_D);
-
-	// MAIN OP: 44
-	InitialiseOpCodeKey(44, 0);
-	AddDescriptorToKey(44, "sth", FormType::FORM_D);
-
-	// MAIN OP: 58
-	InitialiseOpCodeKey(58, 0x2);
-	AddDescriptorToKey(58, "ld", FormType::FORM_DS, 0);
-	AddDescriptorToKey(58, "ldu", FormType::FORM_DS, 1);
-	AddDescriptorToKey(58, "lwa", FormType::FORM_DS, 2);
-
-	// MAIN OP: 62
-	InitialiseOpCodeKey(62, 0x2);
-	AddDescriptorToKey(62, "std", FormType::FORM_DS, 0);
-	AddDescriptorToKey(62, "stdu", FormType::FORM_DS, 1);
+#if HOST_X86
+	static const bool accelerated = IsDecodeAccelerated();
+#endif
+	for (size_t i = 0; i < count; i += 64)
+	{
+		// one group of 64 instructions fills one word of every bitmap
+		uint64_t bits[INSTR_FLAG_COUNT] = {};
+		size_t n = count - i < 64 ? count - i : 64;
+#if HOST_X86
+		if (accelerated && n == 64)
+		{
+			ClassifyGroupAVX2(opcodes + i, words + i, flags + i, bits);
+		}
+		else
+#endif
+		{
+			for (size_t j = 0; j < n; j++)
+			{
+				uint16_t f = GetFlags(opcodes[i + j], words[i + j]);
+				flags[i + j] = f;
+				for (uint32_t bit = 0; bit < INSTR_FLAG_COUNT; bit++)
+				{
+					bits[bit] |= (uint64_t)((f >> bit) & 1) << j;
+				}
+			}
+		}
+
+		if (bitmaps)
+		{
+			for (uint32_t bit = 0; bit < INSTR_FLAG_COUNT; bit++)
+			{
+				bitmaps[bit][i / 64] = bits[bit];
+			}
+		}
+	}
 }
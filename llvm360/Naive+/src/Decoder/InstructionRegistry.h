@@ -1,7 +1,12 @@
 #pragma once
 #include <cstdint>
-#include <unordered_map>
-#include <string>
+#include <vector>
+#include <cstdio>
+#include <type_traits>
+#include <array>
+#include <bit>
+#include <string_view>
+#include <utility>
 
 #ifdef _WIN32
 #define BREAKPOINT _CrtDbgBreak
@@ -131,16 +136,105 @@ union InstrOperands
 
 
 
+// operand fields, <Start> is the position of the least significant bit (as in the Form unions above)
+// every accessor is constexpr so the extraction is folded into the caller
+template <uint32_t Start, uint32_t Width>
+struct Field
+{
+	static constexpr uint32_t get(uint32_t raw) { return (raw >> Start) & ((1u << Width) - 1); }
+	static constexpr int32_t getSigned(uint32_t raw) { return (int32_t)(raw << (32 - Start - Width)) >> (32 - Width); }
+};
+
+// per form operand extractors, Operands<FORM_D>::decode(word) etc.
+template <FormType F> struct Operands;
+
+template <> struct Operands<FORM_I>
+{
+	int32_t LI; uint32_t AA, LK;	// LI is the byte displacement
+	static constexpr Operands decode(uint32_t raw) { return { Field<2, 24>::getSigned(raw) * 4, Field<1, 1>::get(raw), Field<0, 1>::get(raw) }; }
+};
+
+template <> struct Operands<FORM_B>
+{
+	uint32_t BO, BI; int32_t BD; uint32_t AA, LK;	// BD is the byte displacement
+	static constexpr Operands decode(uint32_t raw) { return { Field<21, 5>::get(raw), Field<16, 5>::get(raw), Field<2, 14>::getSigned(raw) * 4, Field<1, 1>::get(raw), Field<0, 1>::get(raw) }; }
+};
+
+template <> struct Operands<FORM_SC>
+{
+	uint32_t LEV;
+	static constexpr Operands decode(uint32_t raw) { return { Field<5, 7>::get(raw) }; }
+};
+
+template <> struct Operands<FORM_D>
+{
+	uint32_t D, A; int32_t SIMM; uint32_t UIMM; uint32_t crfD, L;	// crfD / L for the compare forms
+	static constexpr Operands decode(uint32_t raw) { return { Field<21, 5>::get(raw), Field<16, 5>::get(raw), Field<0, 16>::getSigned(raw), Field<0, 16>::get(raw), Field<23, 3>::get(raw), Field<21, 1>::get(raw) }; }
+};
+
+template <> struct Operands<FORM_DS>
+{
+	uint32_t D, A; int32_t DS; uint32_t XO;	// DS is the byte displacement
+	static constexpr Operands decode(uint32_t raw) { return { Field<21, 5>::get(raw), Field<16, 5>::get(raw), Field<2, 14>::getSigned(raw) * 4, Field<0, 2>::get(raw) }; }
+};
+
+template <> struct Operands<FORM_X>
+{
+	uint32_t D, A, B, XO, Rc, crfD, L;
+	static constexpr Operands decode(uint32_t raw) { return { Field<21, 5>::get(raw), Field<16, 5>::get(raw), Field<11, 5>::get(raw), Field<1, 10>::get(raw), Field<0, 1>::get(raw), Field<23, 3>::get(raw), Field<21, 1>::get(raw) }; }
+};
+
+template <> struct Operands<FORM_XO>
+{
+	uint32_t D, A, B, OE, XO, Rc;
+	static constexpr Operands decode(uint32_t raw) { return { Field<21, 5>::get(raw), Field<16, 5>::get(raw), Field<11, 5>::get(raw), Field<10, 1>::get(raw), Field<1, 9>::get(raw), Field<0, 1>::get(raw) }; }
+};
+
+template <> struct Operands<FORM_XL>
+{
+	uint32_t BO, BI, XO, LK;
+	static constexpr Operands decode(uint32_t raw) { return { Field<21, 5>::get(raw), Field<16, 5>::get(raw), Field<1, 10>::get(raw), Field<0, 1>::get(raw) }; }
+};
+
+template <> struct Operands<FORM_XFX>
+{
+	uint32_t D, spr, XO;	// spr with its two 5 bit halves already swapped back
+	static constexpr Operands decode(uint32_t raw) { return { Field<21, 5>::get(raw), (Field<11, 5>::get(raw) << 5) | Field<16, 5>::get(raw), Field<1, 10>::get(raw) }; }
+};
+
+template <> struct Operands<FORM_M>
+{
+	uint32_t S, A, SH, MB, ME, Rc;	// SH is rB for rlwnm
+	static constexpr Operands decode(uint32_t raw) { return { Field<21, 5>::get(raw), Field<16, 5>::get(raw), Field<11, 5>::get(raw), Field<6, 5>::get(raw), Field<1, 5>::get(raw), Field<0, 1>::get(raw) }; }
+};
+
+template <> struct Operands<FORM_MD>
+{
+	uint32_t S, A, SH, MB, XO, Rc;	// SH and MB (or ME) with their split high bit put back
+	static constexpr Operands decode(uint32_t raw)
+	{
+		return { Field<21, 5>::get(raw), Field<16, 5>::get(raw), Field<11, 5>::get(raw) | (Field<1, 1>::get(raw) << 5),
+			Field<6, 5>::get(raw) | (Field<5, 1>::get(raw) << 5), Field<2, 3>::get(raw), Field<0, 1>::get(raw) };
+	}
+};
+
+
+// mnemonic and form of an opcode, one per OpcodeID and shared by every instruction with that opcode
 struct InstructionDescriptor
 {
-	std::string mnemonic;
+	const char* mnemonic;
 	FormType m_Type;
 };
 
+// index + 1 into instruction_table
+typedef uint16_t OpcodeID;
+static const OpcodeID OPCODE_INVALID = 0;
+
+// a decoded instruction is only its opcode and the raw word, 
+// the address is implied by its position in the section it was decoded from
 struct Instruction
 {
-	InstructionDescriptor desc;
-	uint32_t address;
+	OpcodeID opcode;
 
 	// raw data and operands
 	union
@@ -150,49 +244,421 @@ struct Instruction
 	};
 
 	Instruction() {}
+	constexpr Instruction(OpcodeID op, uint32_t data) : opcode(op), m_rawData(data) {}
+
+	template <FormType F>
+	constexpr Operands<F> get() const { return Operands<F>::decode(m_rawData); }
 };
+static_assert(sizeof(Instruction) == 8, "Instruction is stored in flat per-section arrays");
+static_assert(std::is_trivially_copyable<Instruction>::value, "Instruction is stored in flat per-section arrays");
+
+
+// classification of a decoded instruction (InstructionRegistry::GetFlags), one bit per kind so
+// analysis passes can test a mask instead of comparing mnemonics
+static const uint16_t INSTR_BRANCH = 1 << 0;
+static const uint16_t INSTR_CONDITIONAL = 1 << 1;	// the branch depends on CR or CTR
+static const uint16_t INSTR_LINK = 1 << 2;			// sets LR
+static const uint16_t INSTR_INDIRECT = 1 << 3;		// the target is in LR or CTR
+static const uint16_t INSTR_LOAD = 1 << 4;
+static const uint16_t INSTR_STORE = 1 << 5;
+static const uint16_t INSTR_WRITES_CR = 1 << 6;
+static const uint16_t INSTR_WRITES_XER = 1 << 7;
+static const uint16_t INSTR_TRAP = 1 << 8;			// trap or system call
+static const uint16_t INSTR_PRIVILEGED = 1 << 9;
+static const uint16_t INSTR_PADDING = 1 << 10;
+static const uint32_t INSTR_FLAG_COUNT = 11;
+
+// flags of instruction_table rows that depend on the word and not only on the opcode
+static const uint32_t RULE_RC = 1 << 16;		// Rc (bit 0) -> INSTR_WRITES_CR
+static const uint32_t RULE_OE = 1 << 17;		// OE (bit 10) -> INSTR_WRITES_XER, OE is inside the 0x7FE extended opcode so XO-form instructions have a row per OE value
+static const uint32_t RULE_LK = 1 << 18;		// LK (bit 0) -> INSTR_LINK
+static const uint32_t RULE_BO = 1 << 19;		// INSTR_CONDITIONAL unless BO is "branch always"
+static const uint32_t RULE_SPR = 1 << 20;		// INSTR_PRIVILEGED for the supervisor SPRs (spr & 0x10)
+static const uint32_t RULE_MTXER = 1 << 21;		// INSTR_WRITES_XER when the SPR is XER
+
+
+// Every instruction the decoder knows, this is the only place an opcode is described
+// rows with the same main opcode must use the same extended opcode mask (a contiguous bit field, 0 if none)
+// the decode tables below are generated from it at compile time
+struct InstructionDef
+{
+	uint32_t mainOP;
+	uint32_t extMASK;
+	uint32_t extOP;
+	InstructionDescriptor desc;
+	uint32_t flags;	// INSTR_* | RULE_*
+};
+
+#define PPC_INSTR(mainOP, extMASK, extOP, mnemonic, form, flags) { mainOP, extMASK, extOP, { mnemonic, form }, flags }
+
+// search "MAIN OP: <n>"
+inline constexpr InstructionDef instruction_table[] =
+{
+	// MAIN OP: 0
+	PPC_INSTR(0, 0, 0, "PADDING", FORM_PADDING, INSTR_PADDING),
+
+	// MAIN OP: 7
+	PPC_INSTR(7, 0, 0, "mulli", FORM_D, 0),
+
+	// MAIN OP: 8
+	PPC_INSTR(8, 0, 0, "subfic", FORM_D, INSTR_WRITES_XER),
+
+	// MAIN OP: 10
+	PPC_INSTR(10, 0, 0, "cmpli", FORM_D, INSTR_WRITES_CR),
+	// MAIN OP: 11
+	PPC_INSTR(11, 0, 0, "cmpi", FORM_D, INSTR_WRITES_CR),
+
+	// MAIN OP: 13
+	PPC_INSTR(13, 0, 0, "addic.", FORM_D, INSTR_WRITES_CR | INSTR_WRITES_XER),
+
+	// MAIN OP: 14
+	// MAIN OP: 15
+	PPC_INSTR(14, 0, 0, "addi", FORM_D, 0),
+	PPC_INSTR(15, 0, 0, "addis", FORM_D, 0),
+
+	// MAIN OP: 16
+	PPC_INSTR(16, 0, 0, "bcx", FORM_B, INSTR_BRANCH | RULE_BO | RULE_LK),
+
+	// MAIN OP: 17
+	PPC_INSTR(17, 0, 0, "sc", FORM_SC, INSTR_TRAP),
+
+	// MAIN OP: 18
+	PPC_INSTR(18, 0, 0, "bx", FORM_I, INSTR_BRANCH | RULE_LK),
+
+	// MAIN OP: 19
+	PPC_INSTR(19, 0x7FE, 16, "bclrx", FORM_XL, INSTR_BRANCH | INSTR_INDIRECT | RULE_BO | RULE_LK),
+	PPC_INSTR(19, 0x7FE, 528, "bcctrx", FORM_XL, INSTR_BRANCH | INSTR_INDIRECT | RULE_BO | RULE_LK),
+
+	// MAIN OP: 20
+	PPC_INSTR(20, 0, 0, "rlwimix", FORM_M, RULE_RC),
+
+	// MAIN OP: 21
+	PPC_INSTR(21, 0, 0, "rlwinmx", FORM_M, RULE_RC),
+
+	// MAIN OP: 24
+	PPC_INSTR(24, 0, 0, "ori", FORM_D, 0),
+
+	// MAIN OP: 25
+	PPC_INSTR(25, 0, 0, "oris", FORM_D, 0),
+
+	// MAIN OP: 26
+	PPC_INSTR(26, 0, 0, "xori", FORM_D, 0),
+
+	// MAIN OP: 28
+	PPC_INSTR(28, 0, 0, "andi.", FORM_D, INSTR_WRITES_CR),
+
+	// MAIN OP: 30
+	PPC_INSTR(30, 0xC, 0, "rldiclx", FORM_MD, RULE_RC),
+	PPC_INSTR(30, 0xC, 1, "rldicrx", FORM_MD, RULE_RC),
+	PPC_INSTR(30, 0xC, 3, "rldimix", FORM_MD, RULE_RC),
+
+	// MAIN OP: 31
+	PPC_INSTR(31, 0x7FE, 339, "mfspr", FORM_XFX, RULE_SPR),
+	PPC_INSTR(31, 0x7FE, 467, "mtspr", FORM_XFX, RULE_SPR | RULE_MTXER),
+	PPC_INSTR(31, 0x7FE, 444, "orx", FORM_X, RULE_RC),
+	PPC_INSTR(31, 0x7FE, 32, "cmpl", FORM_X, INSTR_WRITES_CR),
+	PPC_INSTR(31, 0x7FE, 26, "cntlzwx", FORM_X, RULE_RC),
+	PPC_INSTR(31, 0x7FE, 83, "mfmsr", FORM_X, INSTR_PRIVILEGED),
+	PPC_INSTR(31, 0x7FE, 178, "mtmsrd", FORM_X, INSTR_PRIVILEGED),
+	PPC_INSTR(31, 0x7FE, 20, "lwarx", FORM_X, INSTR_LOAD),
+	PPC_INSTR(31, 0x7FE, 150, "stwcx.", FORM_X, INSTR_STORE | INSTR_WRITES_CR),
+	PPC_INSTR(31, 0x7FE, 266, "addx", FORM_XO, RULE_RC | RULE_OE),
+	PPC_INSTR(31, 0x7FE, 778, "addox", FORM_XO, RULE_RC | RULE_OE),
+	PPC_INSTR(31, 0x7FE, 40, "subfx", FORM_XO, RULE_RC | RULE_OE),
+	PPC_INSTR(31, 0x7FE, 552, "subfox", FORM_XO, RULE_RC | RULE_OE),
+	PPC_INSTR(31, 0x7FE, 0, "cmp", FORM_X, INSTR_WRITES_CR),
+	PPC_INSTR(31, 0x7FE, 87, "lbzx", FORM_X, INSTR_LOAD),
+	PPC_INSTR(31, 0x7FE, 922, "extshx", FORM_X, RULE_RC),
+	PPC_INSTR(31, 0x7FE, 598, "sync", FORM_X, 0),
+	PPC_INSTR(31, 0x7FE, 27, "sld", FORM_X, RULE_RC),
+	PPC_INSTR(31, 0x7FE, 60, "andc", FORM_X, RULE_RC),
+	PPC_INSTR(31, 0x7FE, 371, "mftb", FORM_XFX, 0),
+	PPC_INSTR(31, 0x7FE, 986, "extswx", FORM_X, RULE_RC),
+	PPC_INSTR(31, 0x7FE, 104, "negx", FORM_XO, RULE_RC | RULE_OE),
+	PPC_INSTR(31, 0x7FE, 616, "negox", FORM_XO, RULE_RC | RULE_OE),
+	PPC_INSTR(31, 0x7FE, 23, "lwzx", FORM_X, INSTR_LOAD),
+	PPC_INSTR(31, 0x7FE, 279, "lhzx", FORM_X, INSTR_LOAD),
+	PPC_INSTR(31, 0x7FE, 824, "srawix", FORM_X, INSTR_WRITES_XER | RULE_RC),
+	PPC_INSTR(31, 0x7FE, 202, "addze", FORM_XO, INSTR_WRITES_XER | RULE_RC | RULE_OE),
+	PPC_INSTR(31, 0x7FE, 714, "addzeo", FORM_XO, INSTR_WRITES_XER | RULE_RC | RULE_OE),
+	PPC_INSTR(31, 0x7FE, 215, "stbx", FORM_X, INSTR_STORE),
+	PPC_INSTR(31, 0x7FE, 407, "sthx", FORM_X, INSTR_STORE),
+	PPC_INSTR(31, 0x7FE, 28, "andx", FORM_X, RULE_RC),
+	PPC_INSTR(31, 0x7FE, 84, "ldarx", FORM_X, INSTR_LOAD),
+
+	// MAIN OP: 32
+	PPC_INSTR(32, 0, 0, "lwz", FORM_D, INSTR_LOAD),
+
+	// MAIN OP: 34
+	PPC_INSTR(34, 0, 0, "lbz", FORM_D, INSTR_LOAD),
+
+	// MAIN OP: 36
+	// MAIN OP: 37
+	PPC_INSTR(36, 0, 0, "stw", FORM_D, INSTR_STORE),
+	PPC_INSTR(37, 0, 0, "stwu", FORM_D, INSTR_STORE),
+
+	// MAIN OP: 38
+	PPC_INSTR(38, 0, 0, "stb", FORM_D, INSTR_STORE),
+
+	// MAIN OP: 40
+	PPC_INSTR(40, 0, 0, "lhz", FORM_D, INSTR_LOAD),
+
+	// MAIN OP: 44
+	PPC_INSTR(44, 0, 0, "sth", FORM_D, INSTR_STORE),
+
+	// MAIN OP: 58
+	PPC_INSTR(58, 0x3, 0, "ld", FORM_DS, INSTR_LOAD),
+	PPC_INSTR(58, 0x3, 1, "ldu", FORM_DS, INSTR_LOAD),
+	PPC_INSTR(58, 0x3, 2, "lwa", FORM_DS, INSTR_LOAD),
+
+	// MAIN OP: 62
+	PPC_INSTR(62, 0x3, 0, "std", FORM_DS, INSTR_STORE),
+	PPC_INSTR(62, 0x3, 1, "stdu", FORM_DS, INSTR_STORE),
+};
+
+#undef PPC_INSTR
+
 
 // responsible of indexing opcodes and (if any) extended opcodes
 // also responsible of decoding an instruction 
 // <data> into an <Instruction> using a <InstructionDescriptor>
-struct InstructionRegistry
+//
+// decoding is two array reads: the main opcode selects an OpcodeKey, the masked extended opcode
+// indexes the dense slice of extIDs that belongs to it, every unassigned slot holds OPCODE_INVALID
+// all of it is constexpr data generated from instruction_table, there is nothing to set up at startup
+namespace InstructionTableIndex
 {
 	struct OpcodeKey
 	{
-		uint32_t m_mainOP;
-		uint32_t m_extMASK;
-		std::unordered_map<uint32_t, InstructionDescriptor> m_descriptors;
+		uint32_t m_extMASK = 0;
+		uint32_t m_extShift = 0;
+		uint32_t m_extOffset = 0;	// first slot in extIDs, slot 0 (OPCODE_INVALID) for main opcodes without instructions
 	};
-	std::unordered_map<uint8_t, OpcodeKey> m_mainOPs; // 0 ... 63
-
-
-	InstructionRegistry();
-	void registerInstructions();
-	void InitialiseOpCodeKey(uint32_t m_mainOP, uint32_t m_extMASK);
-	void AddDescriptorToKey(uint32_t mainOP, std::string mnemonic, FormType type, uint32_t extOP = 0);
-
-	Instruction DecodeInstr(uint32_t data, uint32_t address)
-	{
-		InstrOperands operands = InstrOperands(data);
-		Instruction instr;
-		
-		// get OpcodeKey by main Opcode
-		auto it = m_mainOPs.find(operands.DEF.OPCD);
-		if (it == m_mainOPs.end()) { printf("Instruction::DecodeInstr %s : %d", "MAIN OPCODE HAS NO KEY", operands.DEF.OPCD); BREAKPOINT(); }
-		
-		OpcodeKey& key = it->second;
-		uint32_t extOpcode = (data & key.m_extMASK);
-		auto itDesc = key.m_descriptors.find(extOpcode);
-		if (itDesc == key.m_descriptors.end()) { printf("Instruction::DecodeInstr %s %d", "OpCodeKey HAS NO DESCRIPTOR FOR THIS EXTOP", extOpcode >> (__builtin_ctz(key.m_extMASK))); BREAKPOINT(); }
-		
-		InstructionDescriptor& desc = itDesc->second;
-		instr.address = address;
-		instr.desc = desc;
-		instr.m_rawData = data;
+
+	constexpr size_t EntryCount = sizeof(instruction_table) / sizeof(instruction_table[0]);
+	static_assert(EntryCount < 0xFFFF, "OpcodeID doesn't fit in 16 bits");
+
+	constexpr uint32_t extSlots(uint32_t extMASK) { return extMASK ? (extMASK >> std::countr_zero(extMASK)) + 1 : 1; }
+
+	constexpr bool validate()
+	{
+		for (size_t i = 0; i < EntryCount; i++)
+		{
+			const InstructionDef& def = instruction_table[i];
+			if (def.mainOP >= 64 || def.extOP >= extSlots(def.extMASK)) { return false; }
+			// contiguous mask
+			if (def.extMASK && ((def.extMASK >> std::countr_zero(def.extMASK)) & extSlots(def.extMASK))) { return false; }
+			for (size_t j = 0; j < i; j++)
+			{
+				const InstructionDef& other = instruction_table[j];
+				if (other.mainOP == def.mainOP && (other.extMASK != def.extMASK || other.extOP == def.extOP)) { return false; }
+				if (std::string_view(other.desc.mnemonic) == def.desc.mnemonic) { return false; }
+			}
+		}
+		return true;
+	}
+	static_assert(validate(), "instruction_table: main opcode with two masks, duplicate opcode or duplicate mnemonic");
+
+	constexpr std::array<OpcodeKey, 64> buildKeys()
+	{
+		std::array<OpcodeKey, 64> keys{};
+		uint32_t next = 1;
+		for (uint32_t op = 0; op < 64; op++)
+		{
+			for (size_t i = 0; i < EntryCount; i++)
+			{
+				if (instruction_table[i].mainOP == op)
+				{
+					uint32_t mask = instruction_table[i].extMASK;
+					keys[op] = { mask, mask ? (uint32_t)std::countr_zero(mask) : 0, next };
+					next += extSlots(mask);
+					break;
+				}
+			}
+		}
+		return keys;
+	}
+	inline constexpr std::array<OpcodeKey, 64> keys = buildKeys();
+
+	constexpr size_t slotCount()
+	{
+		size_t count = 1;
+		for (const OpcodeKey& key : keys)
+		{
+			if (key.m_extOffset != 0) { count += extSlots(key.m_extMASK); }
+		}
+		return count;
+	}
+
+	// one spare slot at the end, so a 32 bit gather of the last id (DecodeRange) stays inside the array
+	constexpr std::array<OpcodeID, slotCount() + 1> buildExtIDs()
+	{
+		std::array<OpcodeID, slotCount() + 1> ids{};
+		for (size_t i = 0; i < EntryCount; i++)
+		{
+			const InstructionDef& def = instruction_table[i];
+			ids[keys[def.mainOP].m_extOffset + def.extOP] = (OpcodeID)(i + 1);
+		}
+		return ids;
+	}
+	inline constexpr auto extIDs = buildExtIDs();
+
+	// every key packed into 32 bits for the gathers of DecodeRange: 
+	// slot offset in bits 0-15, shift in bits 16-20, width of the extended opcode in bits 24-28
+	constexpr std::array<uint32_t, 64> buildPackedKeys()
+	{
+		std::array<uint32_t, 64> packed{};
+		for (size_t op = 0; op < 64; op++)
+		{
+			uint32_t width = (uint32_t)std::popcount(keys[op].m_extMASK);
+			packed[op] = keys[op].m_extOffset | (keys[op].m_extShift << 16) | (width << 24);
+		}
+		return packed;
+	}
+	inline constexpr auto packedKeys = buildPackedKeys();
+
+	// instruction_table flags by OpcodeID, 0 for OPCODE_INVALID
+	constexpr std::array<uint32_t, EntryCount + 1> buildOpcodeFlags()
+	{
+		std::array<uint32_t, EntryCount + 1> flags{};
+		for (size_t i = 0; i < EntryCount; i++)
+		{
+			flags[i + 1] = instruction_table[i].flags;
+		}
+		return flags;
+	}
+	inline constexpr auto opcodeFlags = buildOpcodeFlags();
+	static_assert(extIDs.size() <= 0x10000, "packedKeys offsets are 16 bits");
+}
+
+// how many words of each unknown opcode (InstructionRegistry::UnknownKey) a decode pass met
+// counters are dense, one per extIDs slot plus one per main opcode without instructions, so counting is an increment
+struct UnknownOpcodeHistogram
+{
+	std::vector<uint32_t> m_counts;
+	size_t m_total = 0;
+
+	UnknownOpcodeHistogram() : m_counts(InstructionTableIndex::extIDs.size() + 64, 0) {}
+
+	void add(uint32_t data)
+	{
+		const InstructionTableIndex::OpcodeKey& key = InstructionTableIndex::keys[data >> 26];
+		size_t slot = key.m_extOffset == 0 ? InstructionTableIndex::extIDs.size() + (data >> 26) : key.m_extOffset + ((data & key.m_extMASK) >> key.m_extShift);
+		m_counts[slot]++;
+		m_total++;
+	}
+	void merge(const UnknownOpcodeHistogram& other);
+	// (UnknownKey, count) of every opcode that was met, most frequent first, ties by key so the order is stable
+	std::vector<std::pair<uint32_t, uint32_t>> sorted() const;
+	// "opcode 31 / xo 854" or "opcode 1" for main opcodes without instructions
+	static void formatKey(uint32_t key, char* out, size_t size);
+};
+
+struct InstructionRegistry
+{
+	static constexpr InstructionDescriptor Unknown = { "unknown", FORM_UNK };
+
+	static constexpr const InstructionDescriptor& GetDescriptor(OpcodeID id) { return id == OPCODE_INVALID ? Unknown : instruction_table[id - 1].desc; }
+	static constexpr const char* GetMnemonic(OpcodeID id) { return GetDescriptor(id).mnemonic; }
+	static constexpr FormType GetForm(OpcodeID id) { return GetDescriptor(id).m_Type; }
+
+	// OPCODE_INVALID for a mnemonic that isn't in the table, meant for compile time (constexpr OpcodeID x = ...)
+	static constexpr OpcodeID FindOpcode(std::string_view mnemonic)
+	{
+		for (size_t i = 0; i < InstructionTableIndex::EntryCount; i++)
+		{
+			if (mnemonic == instruction_table[i].desc.mnemonic) { return (OpcodeID)(i + 1); }
+		}
+		return OPCODE_INVALID;
+	}
+
+	static constexpr OpcodeID DecodeOpcode(uint32_t data)
+	{
+		const InstructionTableIndex::OpcodeKey& key = InstructionTableIndex::keys[data >> 26];
+		return InstructionTableIndex::extIDs[key.m_extOffset + ((data & key.m_extMASK) >> key.m_extShift)];
+	}
+
+	// main opcode in the high half, extended opcode in the low half (0 when the main opcode has no instructions)
+	// it's what the histogram of unknown words is keyed by
+	static constexpr uint32_t UnknownKey(uint32_t data)
+	{
+		const InstructionTableIndex::OpcodeKey& key = InstructionTableIndex::keys[data >> 26];
+		return ((data >> 26) << 16) | ((data & key.m_extMASK) >> key.m_extShift);
+	}
+
+	// unknown words decode to OPCODE_INVALID (the "unknown" descriptor) and are counted in <unknown> when given,
+	// callers skip them, a sweep over data in .text never stops
+	Instruction DecodeInstr(uint32_t data, UnknownOpcodeHistogram* unknown = nullptr) const
+	{
+		Instruction instr(DecodeOpcode(data), data);
+		if (instr.opcode == OPCODE_INVALID && unknown) 
+		{ 
+			unknown->add(data);
+		}
 		return instr;
 	}
+
+	// branch free, it runs once per decoded word
+	static constexpr uint16_t GetFlags(OpcodeID id, uint32_t word)
+	{
+		uint32_t def = InstructionTableIndex::opcodeFlags[id];
+		uint32_t spr = Operands<FORM_XFX>::decode(word).spr;
+		uint32_t flags = def & 0xFFFF;
+		flags |= (((def & RULE_RC) >> 16) & word) * INSTR_WRITES_CR;
+		flags |= (((def & RULE_OE) >> 17) & (word >> 10)) * INSTR_WRITES_XER;
+		flags |= (((def & RULE_LK) >> 18) & word) * INSTR_LINK;
+		flags |= (((def & RULE_BO) >> 19) & (uint32_t)((Field<21, 5>::get(word) & 0x14) != 0x14)) * INSTR_CONDITIONAL;
+		flags |= (((def & RULE_SPR) >> 20) & (spr >> 4)) * INSTR_PRIVILEGED;
+		flags |= (((def & RULE_MTXER) >> 21) & (uint32_t)(spr == 1)) * INSTR_WRITES_XER;
+		return (uint16_t)flags;
+	}
+
+	// b and bc (and their link / absolute forms), the branches whose target is in the instruction
+	static constexpr bool IsDirectBranch(OpcodeID id) { return GetForm(id) == FORM_I || GetForm(id) == FORM_B; }
+
+	// target of the direct branch <word> at guest address <address>
+	static constexpr uint32_t GetBranchTarget(OpcodeID id, uint32_t word, uint32_t address)
+	{
+		if (GetForm(id) == FORM_I)
+		{
+			Operands<FORM_I> op = Operands<FORM_I>::decode(word);
+			return (op.AA ? 0 : address) + (uint32_t)op.LI;
+		}
+		Operands<FORM_B> op = Operands<FORM_B>::decode(word);
+		return (op.AA ? 0 : address) + (uint32_t)op.BD;
+	}
+
+	// GetFlags of <count> decoded instructions, flags[i] receives the flags of instruction i
+	// bitmaps[f] (optional, (count + 63) / 64 words each) receives bit i when instruction i has flag 1 << f
+	static void ClassifyRange(const OpcodeID* opcodes, const uint32_t* words, size_t count, uint16_t* flags, uint64_t* const* bitmaps = nullptr);
+
+	// add the words of a decoded range that aren't known instructions (clear bits of <valid>) to <unknown>
+	static void CountUnknown(const uint32_t* words, const uint64_t* valid, size_t count, UnknownOpcodeHistogram& unknown);
+
+	// Decode <count> big endian words at <src>, opcodes[i] and words[i] receive the OpcodeID and the host order word
+	// unknown words are left as OPCODE_INVALID, nothing is reported
+	// <valid> (optional, (count + 63) / 64 words) receives a bitset of the known instructions
+	// 8 words per iteration with AVX2 when the host has it
+	static void DecodeRange(const uint8_t* src, size_t count, OpcodeID* opcodes, uint32_t* words, uint64_t* valid = nullptr);
+	static void DecodeRangeScalar(const uint8_t* src, size_t count, OpcodeID* opcodes, uint32_t* words, uint64_t* valid = nullptr);
+	static bool IsDecodeAccelerated();
 };
 
+static_assert(InstructionRegistry::DecodeOpcode(0x7C0802A6) == InstructionRegistry::FindOpcode("mfspr"), "mflr r0");
+static_assert(InstructionRegistry::DecodeOpcode(0x4E800020) == InstructionRegistry::FindOpcode("bclrx"), "blr");
+static_assert(InstructionRegistry::DecodeOpcode(0xE8010008) == InstructionRegistry::FindOpcode("ld"), "ld r0, 8(r1)");
+static_assert(InstructionRegistry::DecodeOpcode(0x04000000) == OPCODE_INVALID, "main opcode 1 has no instructions");
+static_assert(InstructionRegistry::UnknownKey(0x04000000) == (1 << 16), "main opcode 1 has no extended opcode");
+static_assert(Operands<FORM_XFX>::decode(0x7C0802A6).spr == 8, "mflr reads LR (spr 8)");
+static_assert(InstructionRegistry::GetFlags(InstructionRegistry::DecodeOpcode(0x4E800020), 0x4E800020) == (INSTR_BRANCH | INSTR_INDIRECT), "blr");
+static_assert(InstructionRegistry::GetFlags(InstructionRegistry::DecodeOpcode(0x4182000C), 0x4182000C) == (INSTR_BRANCH | INSTR_CONDITIONAL), "beq");
+static_assert(InstructionRegistry::GetFlags(InstructionRegistry::DecodeOpcode(0x4BFFFFF1), 0x4BFFFFF1) == (INSTR_BRANCH | INSTR_LINK), "bl");
+static_assert(InstructionRegistry::DecodeOpcode(0x7C642E14) == InstructionRegistry::FindOpcode("addox"), "addo r3, r4, r5");
+static_assert(InstructionRegistry::GetFlags(InstructionRegistry::DecodeOpcode(0x7C642E14), 0x7C642E14) == INSTR_WRITES_XER, "addo r3, r4, r5");
+static_assert(InstructionRegistry::GetFlags(InstructionRegistry::DecodeOpcode(0x7C642A14), 0x7C642A14) == 0, "add r3, r4, r5");
+static_assert(InstructionRegistry::GetBranchTarget(InstructionRegistry::DecodeOpcode(0x4BFFFFF1), 0x4BFFFFF1, 0x82000010) == 0x82000000, "bl -0x10");
+static_assert(InstructionRegistry::GetBranchTarget(InstructionRegistry::DecodeOpcode(0x4182000C), 0x4182000C, 0x82000010) == 0x8200001C, "beq +0xC");
+
 
 
 extern InstructionRegistry g_instrRegistry;
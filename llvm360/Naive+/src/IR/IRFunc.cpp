@@ -1,4 +1,5 @@
 #include "IRFunc.h"
+#include "Decoder/InstructionRegistry.h"
 #include <sstream>
 #include <unordered_set>
 
@@ -11,103 +12,49 @@
 
 
 
-inline uint32_t signExtend(uint32_t value, int size)
-{
-    if (value & (1 << (size - 1))) {
-        return value | (~0 << size);
-    }
-    return value;
-}
-
 bool IRFunc::EmitFunction()
 {
-    bool result;
-    m_irGen->m_builder->SetInsertPoint(getCreateBBinMap(start_address));
-
-    uint32_t idx = this->start_address;
-    if (start_address == 0x82014DA8) DebugBreak();
-
-    // discover start basic blocks
-    while (idx <= this->end_address)
+    const PBinaryHandle::CodeSection* section = m_irGen->m_binary->findCode(start_address);
+    if (section == nullptr || !section->contains(end_address))
     {
-		Instruction instr = m_irGen->instrsList.at(idx);
-		if (strcmp(instr.opcName.c_str(), "b") == 0)
-		{
-            uint32_t target = idx + signExtend(instr.ops[0], 24);
-            // check for tail calls
-            if (!m_irGen->isIRFuncinMap(target))
-            {
-                this->getCreateBBinMap(target);
-                //this->getCreateBBinMap(instr.address + 4);
-            }
-		}
-        if (strcmp(instr.opcName.c_str(), "bc") == 0)
-        {
-            this->getCreateBBinMap(instr.address + (int16_t)(instr.ops[2] << 2));
-            this->getCreateBBinMap(instr.address + 4);
-        }
+        printf("Function %08X is not inside a code section\n", start_address);
+        return false;
+    }
 
+    // switch tables behind the bctr, their cases are blocks of the function
+    Analysis::FindJumpTables(*section, *m_irGen->m_binary->m_image, start_address, end_address + 4, m_jumpTables);
+    has_jumpTable = !m_jumpTables.empty();
 
-        idx += 4;
-    }
+    // leaders, terminators and the edges between blocks, one pass over the branches of the function
+    Analysis::BuildControlFlowGraph(*section, start_address, end_address + 4, m_cfg, &m_jumpTables);
 
-	CodeBlock* currentBlock = codeBlocks.at(start_address);
-    idx = this->start_address;
-	// discover end basic blocks
-    while (idx <= this->end_address)
+    m_blocks.resize(m_cfg.blockCount());
+    for (size_t b = 0; b < m_cfg.blockCount(); b++)
     {
-        Instruction instr = m_irGen->instrsList.at(idx);
-		if (isBBinMap(idx + 4))
-		{
-			currentBlock->end = idx;
-			currentBlock = codeBlocks.at(idx + 4);
-		}
-		if (strcmp(instr.opcName.c_str(), "bclr") == 0)
-		{
-			currentBlock->end = idx;
-		}
-        if(idx == this->end_address)
-        {
-            currentBlock->end = this->end_address;
-        }
-        idx += 4;
+        m_blocks[b] = createBasicBlock(m_cfg.m_blockStart[b]);
     }
 
-    // can be optimized?
-    // TODO
-
     // emit
-    idx = this->start_address;
-    while (idx <= this->end_address)
+    for (uint32_t b = 0; b < m_cfg.blockCount(); b++)
     {
-		if (isBBinMap(idx))
-		{
-			m_irGen->m_builder->SetInsertPoint(codeBlocks.at(idx)->bb_Block);
-
-            CodeBlock* block = codeBlocks.at(idx);
-
-
-            uint32_t blockIdx = block->address;
-            while (blockIdx <= block->end)
+        m_irGen->m_builder->SetInsertPoint(m_blocks[b]);
+        size_t first = section->indexOf(m_cfg.m_blockStart[b]);
+        size_t last = section->indexOf(m_cfg.m_blockEnd[b]);
+        for (size_t i = first; i < last; i++)
+        {
+            uint32_t address = section->m_address + (uint32_t)i * 4;
+            if (!m_irGen->EmitInstruction(Instruction(section->m_opcodes[i], section->m_words[i]), address, this))
             {
-                Instruction instr = m_irGen->instrsList.at(blockIdx);
-
-                if (!m_irGen->EmitInstruction(m_irGen->instrsList.at(blockIdx), this))
-                {
-                    __debugbreak();
-                    return 1;
-                }
-
-                if (blockIdx != this->end_address && blockIdx == block->end && strcmp(instr.opcName.c_str(), "bclr") != 0 )
-                {
-                    m_irGen->m_builder->CreateBr(codeBlocks.at(block->end + 4)->bb_Block);
-                }
-                blockIdx += 4;
-                
+                return false;
             }
+        }
 
-			idx = blockIdx;
-		}
+        // the block falls into the next one unless it ends with a branch that doesn't come back
+        uint16_t flags = section->m_flags[last - 1];
+        if (b + 1 < m_cfg.blockCount() && (!(flags & INSTR_BRANCH) || (flags & INSTR_LINK)))
+        {
+            m_irGen->m_builder->CreateBr(m_blocks[b + 1]);
+        }
     }
 
 
@@ -121,10 +68,6 @@ void IRFunc::genBody()
 
     llvm::FunctionType* mainType = llvm::FunctionType::get(m_irGen->m_builder->getVoidTy(), {m_irGen->XenonStateType->getPointerTo(), m_irGen->m_builder->getInt32Ty()}, false);
     m_irFunc = llvm::Function::Create(mainType, llvm::Function::ExternalLinkage, oss.str(), m_irGen->m_module);
-
-    getCreateBBinMap(start_address);
-    //m_irGen->m_builder->SetInsertPoint(getCreateBBinMap(start_address));
-
 }
 
 llvm::BasicBlock* IRFunc::createBasicBlock(uint32_t address)
@@ -134,21 +77,22 @@ llvm::BasicBlock* IRFunc::createBasicBlock(uint32_t address)
     return llvm::BasicBlock::Create(m_irGen->m_module->getContext(), oss.str(), m_irFunc);
 }
 
-llvm::BasicBlock* IRFunc::getCreateBBinMap(uint32_t address)
+llvm::BasicBlock* IRFunc::getBlock(uint32_t address)
 {
-    if (isBBinMap(address)) {
-        return codeBlocks.at(address)->bb_Block;
+    if (!m_cfg.isLeader(address)) {
+        return nullptr;
     }
-    CodeBlock* block = new CodeBlock();
-    block->bb_Block = createBasicBlock(address);
-	block->address = address;
-    codeBlocks.try_emplace(address, block);
-    return block->bb_Block;
+    return m_blocks[m_cfg.blockOf(address)];
 }
 
-bool IRFunc::isBBinMap(uint32_t address)
+const Analysis::JumpTable* IRFunc::findJumpTable(uint32_t address) const
 {
-    return codeBlocks.find(address) != codeBlocks.end();
+    auto it = std::lower_bound(m_jumpTables.begin(), m_jumpTables.end(), address,
+        [](const Analysis::JumpTable& table, uint32_t addr) { return table.m_branch < addr; });
+    if (it == m_jumpTables.end() || it->m_branch != address) {
+        return nullptr;
+    }
+    return &*it;
 }
 
 
@@ -206,13 +150,11 @@ llvm::Value* IRFunc::getRegister(const std::string& regName, int index1, int ind
     }
 }
 
+// <n> is the SPR number (Operands<FORM_XFX>::spr, its two halves already swapped back)
 llvm::Value* IRFunc::getSPR(uint32_t n)
 {
-    uint32_t spr4 = (n & 0b1111100000) >> 5;
-    uint32_t spr9 = n & 0b0000011111;
-
-    if (spr4 == 1) return this->getRegister("XER");
-    if (spr4 == 8) return this->getRegister("LR");
-    if (spr4 == 9) return this->getRegister("CTR");
+    if (n == 1) return this->getRegister("XER");
+    if (n == 8) return this->getRegister("LR");
+    if (n == 9) return this->getRegister("CTR");
     return NULL;
 }
\ No newline at end of file
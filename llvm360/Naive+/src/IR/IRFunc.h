@@ -2,28 +2,28 @@
 #include <string>
 #include <iomanip>
 #include "IRGenerator.h"
-
-struct CodeBlock
-{
-	uint32_t address;
-    uint32_t end;
-	llvm::BasicBlock* bb_Block;
-};
+#include "Analysis/ControlFlowGraph.h"
 
 class IRFunc {
 public:
     uint32_t start_address;
     uint32_t end_address;
     bool emission_done;
-    std::unordered_map<uint32_t, CodeBlock*> codeBlocks;
+    // blocks of the function being emitted, m_blocks[b] is the llvm block of m_cfg block b
+    Analysis::ControlFlowGraph m_cfg;
+    std::vector<llvm::BasicBlock*> m_blocks;
+    // jump tables of the bctr in the function, sorted by bctr address
+    std::vector<Analysis::JumpTable> m_jumpTables;
     llvm::Function* m_irFunc;
 
     bool EmitFunction();
     void genBody();
 
     llvm::BasicBlock* createBasicBlock(uint32_t address);
-    llvm::BasicBlock* getCreateBBinMap(uint32_t address);
-    bool isBBinMap(uint32_t address);
+    // llvm block that begins at <address>, nullptr if no block of m_cfg starts there
+    llvm::BasicBlock* getBlock(uint32_t address);
+    // table recovered for the bctr at <address>, nullptr when it's dispatched at runtime
+    const Analysis::JumpTable* findJumpTable(uint32_t address) const;
     llvm::Value* getRegister(const std::string& regName, int arrayIndex = -1, int index2 = -1);
     llvm::Value* getSPR(uint32_t n);
 
@@ -1,14 +1,17 @@
 #include "IRGenerator.h"
 #include "InstructionEmitter.h"
+#include "Naive+/Naive+.h"
 #include <format>
 #include <iomanip>
 #include <sstream>
 
 
 
-IRGenerator::IRGenerator(llvm::Module* mod, llvm::IRBuilder<llvm::NoFolder>* builder)
+IRGenerator::IRGenerator(const PBinaryHandle* binary, llvm::Module* mod, llvm::IRBuilder<llvm::NoFolder>* builder)
   : m_builder(builder)
-  , m_module(mod) {
+  , m_module(mod)
+  , m_guestBase(binary->m_guestBase)
+  , m_binary(binary) {
   
 }
 
@@ -74,7 +77,7 @@ void IRGenerator::InitLLVM() {
         m_builder->getInt64Ty(),             
         false,                  
         llvm::GlobalValue::ExternalLinkage, 
-        m_builder->getInt64(0),
+        m_builder->getInt64(m_guestBase),
         "moduleBase"
     );
     module_base->setDLLStorageClass(llvm::GlobalValue::DLLExportStorageClass);
@@ -174,141 +177,103 @@ void IRGenerator::exportFunctionArray()
 }
 
 void IRGenerator::Initialize() {
+   seedFunctions();
    InitLLVM();
 }
 
 bool first = true;
 
 #define DEBUG_COMMENT(x) m_builder->CreateAdd(m_builder->getInt32(0), m_builder->getInt32(0), x);
-#define DEBUG_CALLBACK() m_builder->CreateCall(dBCallBackFunc, { &*func->m_irFunc->arg_begin(), m_builder->getInt32(instr.address), m_builder->CreateGlobalStringPtr(instr.opcName) });
+#define DEBUG_CALLBACK() m_builder->CreateCall(dBCallBackFunc, { &*func->m_irFunc->arg_begin(), m_builder->getInt32(address), m_builder->CreateGlobalStringPtr(InstructionRegistry::GetMnemonic(instr.opcode)) });
 
-bool IRGenerator::EmitInstruction(Instruction instr, IRFunc* func) {
-    // EEHHE can't use a std::string in a switch statement sooo...
-    // let's map all the instruction names (as i already needed to do with a switch statement)
-    // in a vector, so i can look up the instr opcode name in that vector and call the instruction
-    // emitter
-    // all emitter functions take as parameter <Instruction, IRGenerator>
+// all emitter functions take as parameter <Instruction, guest address, IRFunc>
+typedef void (*InstructionEmitterFn)(Instruction, uint32_t, IRFunc*);
+typedef std::array<InstructionEmitterFn, InstructionTableIndex::EntryCount + 1> EmitterTable;
 
-	// Debug, help to find the instruction and debug IR code
-    std::ostringstream oss;
-    oss << std::hex << std::uppercase << std::setfill('0');
-    oss << "------ " << std::setw(8) << instr.address << ":   " << instr.opcName;
+#define EMITTER(mnemonic, emitter) \
+    static_assert(InstructionRegistry::FindOpcode(mnemonic) != OPCODE_INVALID, mnemonic " is not in instruction_table"); \
+    table[InstructionRegistry::FindOpcode(mnemonic)] = emitter;
 
-    for (size_t i = 0; i < instr.ops.size(); ++i) {
-        oss << " " << std::setw(2) << static_cast<int>(instr.ops.at(i));
-    }
-    oss << " ------";
-    DEBUG_COMMENT(oss.str().c_str())
+// emitter of every OpcodeID, nullptr for the instructions that aren't implemented
+// the emitters of instructions instruction_table has no row for yet (lwzu, mullw, ...) aren't reachable
+static EmitterTable BuildEmitterTable()
+{
+    EmitterTable table{};
+    // <name>_e = <name>_emitter
+    EMITTER("mulli", mulli_e)
+    EMITTER("subfic", subfic_e)
+    EMITTER("cmpli", cmpli_e)
+    EMITTER("cmpi", cmpi_e)
+    EMITTER("addic.", addic_e)
+    EMITTER("addi", addi_e)
+    EMITTER("addis", addis_e)
+    EMITTER("bcx", bcx_e)
+    EMITTER("bx", bx_e)
+    EMITTER("bclrx", bclr_e)
+    EMITTER("bcctrx", bcctrx_e)
+    EMITTER("rlwimix", rlwimi_e)
+    EMITTER("rlwinmx", rlwinm_e)
+    EMITTER("ori", ori_e)
+    EMITTER("oris", oris_e)
+    EMITTER("xori", xori_e)
+    EMITTER("andi.", andiRC_e)
+    EMITTER("rldiclx", rldicl_e)
+    EMITTER("mfspr", mfspr_e)
+    EMITTER("mtspr", mtspr_e)
+    EMITTER("orx", orx_e)
+    EMITTER("cmpl", cmpl_e)
+    EMITTER("cntlzwx", cntlzw_e)
+    EMITTER("addx", add_e)
+    EMITTER("addox", add_e)
+    EMITTER("subfx", subf_e)
+    EMITTER("subfox", subf_e)
+    EMITTER("cmp", cmpw_e)
+    EMITTER("lbzx", lbzx_e)
+    EMITTER("extshx", extsh_e)
+    EMITTER("andc", andc_e)
+    EMITTER("extswx", extsw_e)
+    EMITTER("negx", neg_e)
+    EMITTER("negox", neg_e)
+    EMITTER("lwzx", lwzx_e)
+    EMITTER("lhzx", lhzx_e)
+    EMITTER("srawix", srawi_e)
+    EMITTER("addze", addze_e)
+    EMITTER("addzeo", addze_e)
+    EMITTER("sthx", sthx_e)
+    EMITTER("andx", and_e)
+    EMITTER("lwz", lwz_e)
+    EMITTER("lbz", lbz_e)
+    EMITTER("stw", stw_e)
+    EMITTER("stwu", stwu_e)
+    EMITTER("stb", stb_e)
+    EMITTER("lhz", lhz_e)
+    EMITTER("sth", sth_e)
+    EMITTER("ld", ld_e)
+    EMITTER("ldu", ldu_e)
+    EMITTER("lwa", lwa_e)
+    EMITTER("std", std_e)
+    EMITTER("stdu", stdu_e)
+    return table;
+}
+
+#undef EMITTER
 
+bool IRGenerator::EmitInstruction(Instruction instr, uint32_t address, IRFunc* func) {
+    static const EmitterTable emitters = BuildEmitterTable();
+
+	// Debug, help to find the instruction and debug IR code
     if (m_dbCallBack)
     {
+        std::string comment = std::format("------ {:08X}:   {} {:08X} ------", address, InstructionRegistry::GetMnemonic(instr.opcode), instr.m_rawData);
+        DEBUG_COMMENT(comment.c_str())
         DEBUG_CALLBACK();
     }
 
-        // <name>_e = <name>_emitter
-    static std::unordered_map<std::string, std::function<void(Instruction, IRFunc*)>>
-        instructionMap =
-    {
-         {"nop", nop_e },
-         {"twi", twi_e },
-         {"tdi", tdi_e},
-         {"mfspr", mfspr_e },
-         {"mfcr", mfcr_e}, //
-         {"stw", stw_e },
-         {"stwu", stwu_e },
-         {"lis", addis_e }, // it's a simplified mnemonic
-         {"addis", addis_e },
-         {"li", addi_e },
-         {"addi", addi_e },
-         {"lwz", lwz_e },
-         {"lwzu", lwzu_e },
-         {"lwzx", lwzx_e},
-         {"mtspr", mtspr_e },
-         {"or", orx_e },
-         {"orRC", orx_e},
-         {"sth", sth_e },
-         {"sthu", sthu_e},
-         {"sthx", sthx_e},
-         {"b", b_e },
-         {"bl", bl_e },
-         {"bclr", bclr_e },
-         {"bcctrl", bcctrl_e},
-         {"lhz", lhz_e },
-         {"lhzu", lhzu_e},
-         {"lha", lha_e},
-         {"lhzx", lhzx_e},
-         {"cmpw", cmpw_e},
-         {"bc", bcx_e},
-         {"add", add_e},
-         {"ori", ori_e},
-         {"cmpwi", cmpi_e},
-         {"cmpdi", cmpi_e},
-         {"neg", neg_e},
-         {"and", and_e},
-         {"xor", xor_e},
-         {"rlwinmRC", rlwinm_e},
-         {"rlwinm", rlwinm_e},
-         {"mullw", mullw_e},
-         {"mullwRC", mullw_e},
-         {"srawi", srawi_e},
-         {"divw", divwx_e},
-         {"andc", andc_e},
-         {"subf", subf_e},
-         {"subfe", subfe_e},
-         {"subfRC", subf_e},
-         {"subfeRC", subfe_e},
-         {"stwx", stwx_e},
-         {"cmplwi", cmpli_e},
-         {"mulli", mulli_e},
-         {"std", std_e},
-         {"stdu", stdu_e},
-         {"lbz", lbz_e},
-         {"lbzu", lbzu_e},
-         {"lbzx", lbzx_e},
-         {"bcctr", bcctr_e},
-         {"xori", xori_e},
-         {"nor", nor_e},
-         {"cntlzw", cntlzw_e},
-         {"andiRC", andiRC_e},
-         {"stb", stb_e},
-         {"stbu", stbu_e},
-         {"extsw", extsw_e},
-         {"extswRC", extsw_e},
-         {"extsh", extsh_e}, 
-         {"extshRC", extsh_e}, 
-         {"extsb", extsb_e}, //
-         {"extsbRC", extsb_e}, //
-         {"cmplw", cmpl_e}, //
-         {"ld", ld_e},
-         {"adde", adde_e}, //
-         {"addic", addic_e},
-         {"addicRC", addic_e}, //
-         {"slw", slw_e}, //
-         {"adde", adde_e}, //
-         {"addze", addze_e},
-         {"addzeRC", addze_e},
-         {"oris", oris_e},
-         {"rlwimi", rlwimi_e},
-         {"subfic", subfic_e},
-         {"rldicl", rldicl_e},
-         {"lwa", lwa_e},
-         {"divdu", divdu_e},
-         {"divwu", divwux_e},
-         {"mulld", mulld_e},
-         {"dcbt", dcbt_e},
-         {"dcbtst", dcbtst_e},
-         {"ldu", ldu_e},
-
-         {"cmpldi", cmpli_e},
-    };
-
-
-  if (instructionMap.find(instr.opcName) != instructionMap.end()) {
-    instructionMap[instr.opcName](instr, func);
-    return true;
-  } else {
-        printf("Instruction:   %s  not Implemented\n", instr.opcName.c_str());
-  }
+    if (InstructionEmitterFn emitter = emitters[instr.opcode]) {
+        emitter(instr, address, func);
+        return true;
+    }
+    printf("Instruction:   %s  not Implemented\n", InstructionRegistry::GetMnemonic(instr.opcode));
 
   writeIRtoFile();
 
@@ -371,6 +336,25 @@ IRFunc* IRGenerator::getCreateFuncInMap(uint32_t address)
     return func;
 }
 
+IRFunc* IRGenerator::getFuncInMap(uint32_t address)
+{
+    auto it = m_function_map.find(address);
+    if (it == m_function_map.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+void IRGenerator::seedFunctions()
+{
+    m_function_map.reserve(m_function_map.size() + m_binary->m_functions.size());
+    for (const PBinaryHandle::Function& function : m_binary->m_functions)
+    {
+        IRFunc* func = getCreateFuncInMap(function.m_address);
+        func->end_address = function.m_end - 4;
+    }
+}
+
 bool IRGenerator::isIRFuncinMap(uint32_t address)
 {
     return m_function_map.find(address) != m_function_map.end();
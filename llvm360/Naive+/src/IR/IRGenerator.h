@@ -12,11 +12,12 @@
 #include "llvm/IR/Intrinsics.h"
 
 
-#include "Decoder/Instruction.h"
+#include "Decoder/InstructionRegistry.h"
 #include <Windows.h>
 #include <map>
 
 class IRFunc;
+struct PBinaryHandle;
 
 
 
@@ -29,10 +30,16 @@ public:
   //XexImage *m_xexImage;
   bool m_dbCallBack;
   bool m_dumpIRConsole;
+  // host address of guest 0 when the image lives in the loader's GuestWindow at its preferred base (0 = read moduleBase at runtime)
+  // taken from the handle (PBinaryHandle::m_guestBase)
+  uint64_t m_guestBase = 0;
+  // decoded image, the blocks of every function are built from its code sections
+  const PBinaryHandle* m_binary = nullptr;
 
-  IRGenerator(llvm::Module* mod, llvm::IRBuilder<llvm::NoFolder>* builder);
+  IRGenerator(const PBinaryHandle* binary, llvm::Module* mod, llvm::IRBuilder<llvm::NoFolder>* builder);
   void Initialize();
-  bool EmitInstruction(Instruction instr, IRFunc* func);
+  // <address> is the guest address of <instr>, decoded instructions only know it from their position in the section
+  bool EmitInstruction(Instruction instr, uint32_t address, IRFunc* func);
   void InitLLVM();
   void writeIRtoFile();
   void CxtSwapFunc();
@@ -64,11 +71,15 @@ public:
 
   void initFuncBody(IRFunc* func);
   IRFunc* getCreateFuncInMap(uint32_t address);
+  // function that starts at <address>, nullptr if there is none
+  IRFunc* getFuncInMap(uint32_t address);
+  // create a function for every entry of the discovered function table (PBinaryHandle::m_functions) with its bounds,
+  // emission only looks functions up
+  void seedFunctions();
   bool isIRFuncinMap(uint32_t address);
 
   llvm::Function* mainFn;
   std::unordered_map<uint32_t, IRFunc*> m_function_map;
-  std::unordered_map<uint32_t, Instruction> instrsList;
 };
 
 
@@ -2,6 +2,7 @@
 #include "IRGenerator.h"
 #include "IRFunc.h"
 #include <unordered_set>
+#include <algorithm>
 
 
 //
@@ -99,11 +100,12 @@ inline bool isBoBit(uint32_t value, uint32_t idx) {
 
 inline llvm::Value* getBOOperation(IRFunc* func, Instruction instr, llvm::Value* bi)
 {
+    uint32_t BO = instr.get<FORM_B>().BO;
     llvm::Value* should_branch{};
     // NOTE, remember to cast "bools" with int1Ty, cause if i do CreateNot with an 32 bit value it will mess up the cmp result
 
     // 0000y Decrement the CTR, then branch if the decremented CTR[M–63] is not 0 and the condition is FALSE.
-    if (instr.ops[0] == 0)
+    if (BO == 0)
     {
         BUILD->CreateStore(BUILD->CreateSub(ctrVal(), i32Const(1), "sub"), func->getRegister("CTR"));
         llvm::Value* isCTRnz = BUILD->CreateICmpNE(ctrVal(), i32Const(0), "ctrnz");
@@ -112,21 +114,21 @@ inline llvm::Value* getBOOperation(IRFunc* func, Instruction instr, llvm::Value*
         return should_branch;
     }
     // 001zy
-    if (isBoBit(instr.ops[0], 2) &&
-        !isBoBit(instr.ops[0], 3) && !isBoBit(instr.ops[0], 4))
+    if (isBoBit(BO, 2) &&
+        !isBoBit(BO, 3) && !isBoBit(BO, 4))
     {
 		// TODO: optmize this
         should_branch = BUILD->CreateAnd(BUILD->CreateNot(bi, "not"), i1Const(1), "shBr");
         return should_branch;
     }
     // 0b011zy (Branch if condition is TRUE)
-    if (isBoBit(instr.ops[0], 2) && isBoBit(instr.ops[0], 3) && !isBoBit(instr.ops[0], 4))
+    if (isBoBit(BO, 2) && isBoBit(BO, 3) && !isBoBit(BO, 4))
     {
         should_branch = BUILD->CreateAnd(bi, i1Const(1), "shBr");
         return should_branch;
     }
     // 0b1z00y
-    if (!isBoBit(instr.ops[0], 1) && !isBoBit(instr.ops[0], 2) && isBoBit(instr.ops[0], 4))
+    if (!isBoBit(BO, 1) && !isBoBit(BO, 2) && isBoBit(BO, 4))
     {
         BUILD->CreateStore(BUILD->CreateSub(ctrVal(), i32Const(1), "sub"), func->getRegister("CTR"));
         llvm::Value* isCTRnz = BUILD->CreateICmpNE(ctrVal(), i32Const(0), "ctrnz");
@@ -134,7 +136,7 @@ inline llvm::Value* getBOOperation(IRFunc* func, Instruction instr, llvm::Value*
         return should_branch;
     }
     // 1z01y Decrement the CTR, then branch if the decremented CTR[M–63] = 0
-    if (isBoBit(instr.ops[0], 1) && !isBoBit(instr.ops[0], 2) && isBoBit(instr.ops[0], 4))
+    if (isBoBit(BO, 1) && !isBoBit(BO, 2) && isBoBit(BO, 4))
     {
         BUILD->CreateStore(BUILD->CreateSub(ctrVal(), i32Const(1), "sub"), func->getRegister("CTR"));
         llvm::Value* isCTRz = BUILD->CreateICmpEQ(ctrVal(), i32Const(0), "ctrnz");
@@ -165,10 +167,10 @@ inline void setCRField(IRFunc* func, uint32_t index, llvm::Value* field)
     BUILD->CreateStore(updatedCR, func->getRegister("CR"));
 }
 
-inline void UpdateCR_CmpZero(IRFunc* func, Instruction instr, const char* name, llvm::Value* val)
+inline void UpdateCR_CmpZero(IRFunc* func, Instruction instr, llvm::Value* val)
 {
-    // RC
-    if (strcmp(instr.opcName.c_str(), name) == 0)
+    // RC, the record forms and andi. / addic.
+    if (InstructionRegistry::GetFlags(instr.opcode, instr.m_rawData) & INSTR_WRITES_CR)
     {
         llvm::Value* LT = zExt32(BUILD->CreateICmpSLT(val, i64Const(0), "lt"));
         llvm::Value* GT = zExt32(BUILD->CreateICmpSGT(val, i64Const(0), "gt"));
@@ -216,12 +218,17 @@ inline llvm::Value* SubCarried(IRFunc* func, llvm::Value* v1, llvm::Value* v2)
 
 inline llvm::Value* guestToHost(IRFunc* func, llvm::Value* guest)
 {
+    // the image sits in the guest window, the offset is a link time constant
+    if (func->m_irGen->m_guestBase != 0)
+    {
+        return BUILD->CreateAdd(guest, i64Const(func->m_irGen->m_guestBase), "fEa");
+    }
     return BUILD->CreateAdd(guest, BUILD->CreateLoad(func->m_irGen->module_base->getValueType(), func->m_irGen->module_base, "m_bV"), "fEa");
 }
 
-inline void updateRA_EA(IRFunc* func, Instruction instr, llvm::Value* eaVal)
+inline void updateRA_EA(IRFunc* func, uint32_t ra, llvm::Value* eaVal)
 {
-    BUILD->CreateStore(eaVal, func->getRegister("RR", instr.ops[2])); // update rA
+    BUILD->CreateStore(eaVal, func->getRegister("RR", ra)); // update rA
 }
 
 inline llvm::Value* EA_HostPtr(IRFunc* func, llvm::Value* guestEa)
@@ -235,10 +242,11 @@ inline llvm::Value* getEA_D(IRFunc* func, uint32_t displ, uint32_t gpr)
     return zExt64(trcTo32(BUILD->CreateAdd(b, i64Const((int64_t)((int16_t)(displ))), "ea")));
 }
 
-inline llvm::Value* getEA_DWORD_D(IRFunc* func, uint32_t displ, uint32_t gpr)
+// <displ> is the byte displacement of the DS form
+inline llvm::Value* getEA_DWORD_D(IRFunc* func, int32_t displ, uint32_t gpr)
 {
     llvm::Value* regValue = gprVal(gpr);
-    return zExt64(trcTo32(BUILD->CreateAdd(regValue, i64Const((int64_t)((int16_t)(displ << 2))), "ea")));
+    return zExt64(trcTo32(BUILD->CreateAdd(regValue, i64Const((int64_t)displ), "ea")));
 }
 
 inline llvm::Value* getEA_R(IRFunc* func, uint32_t gpr1, uint32_t gpr2)
@@ -252,39 +260,39 @@ inline llvm::Value* getEA_R(IRFunc* func, uint32_t gpr1, uint32_t gpr2)
 // INSTRUCTIONS Emitters
 //
 
-inline void nop_e(Instruction instr, IRFunc* func)
+inline void nop_e(Instruction instr, uint32_t address, IRFunc* func)
 {
 	// best instruction ever
 
     // lil hack
-    if (instr.address == func->end_address && func->m_irGen->isIRFuncinMap(instr.address + 4))
+    if (address == func->end_address && func->m_irGen->isIRFuncinMap(address + 4))
     {
         BUILD->CreateRetVoid();
     }
     return;
 }
 
-inline void dcbt_e(Instruction instr, IRFunc* func)
+inline void dcbt_e(Instruction instr, uint32_t address, IRFunc* func)
 {
     // no-op
     return;
 }
 
-inline void dcbtst_e(Instruction instr, IRFunc* func)
+inline void dcbtst_e(Instruction instr, uint32_t address, IRFunc* func)
 {
     // no-op
     return;
 }
 
 
-inline void twi_e(Instruction instr, IRFunc* func)
+inline void twi_e(Instruction instr, uint32_t address, IRFunc* func)
 {
     // temp stub
     DebugBreak();
     return;
 }
 
-inline void tdi_e(Instruction instr, IRFunc* func)
+inline void tdi_e(Instruction instr, uint32_t address, IRFunc* func)
 {
     // temp stub
     DebugBreak();
@@ -292,129 +300,156 @@ inline void tdi_e(Instruction instr, IRFunc* func)
 }
 
 
-inline void mfspr_e(Instruction instr, IRFunc* func)
+inline void mfspr_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto lrValue = BUILD->CreateLoad(BUILD->getInt64Ty(), func->getSPR(instr.ops[1]), "load_spr");
-    BUILD->CreateStore(lrValue, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_XFX> op = instr.get<FORM_XFX>();
+    auto lrValue = BUILD->CreateLoad(BUILD->getInt64Ty(), func->getSPR(op.spr), "load_spr");
+    BUILD->CreateStore(lrValue, func->getRegister("RR", op.D));
 }
 
-inline void mtspr_e(Instruction instr, IRFunc* func)
+inline void mtspr_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto rrValue = trcTo32(gprVal(instr.ops[1]));
-    BUILD->CreateStore(rrValue, func->getSPR(instr.ops[0]));
+    Operands<FORM_XFX> op = instr.get<FORM_XFX>();
+    auto rrValue = trcTo32(gprVal(op.D));
+    BUILD->CreateStore(rrValue, func->getSPR(op.spr));
 }
 
-inline void mfcr_e(Instruction instr, IRFunc* func)
+inline void mfcr_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    BUILD->CreateStore(crVal(), func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    BUILD->CreateStore(crVal(), func->getRegister("RR", op.D));
 }
 
-inline void bl_e(Instruction instr, IRFunc* func)
+inline void bl_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    uint32_t target = instr.address + signExtend(instr.ops[0], 24);
-	IRFunc* targetFunc = func->m_irGen->getCreateFuncInMap(target);
-    func->m_irGen->initFuncBody(targetFunc);
+    uint32_t target = InstructionRegistry::GetBranchTarget(instr.opcode, instr.m_rawData, address);
+    // every bl target was discovered and seeded before emission (IRGenerator::seedFunctions)
+    IRFunc* targetFunc = func->m_irGen->getFuncInMap(target);
+    if (targetFunc == nullptr)
+    {
+        printf("bl at %08X: %08X is not a discovered function\n", address, target);
+        DebugBreak();
+        return;
+    }
+    if (targetFunc->m_irFunc == nullptr) func->m_irGen->initFuncBody(targetFunc);
 
     // outdated:
     // 
     // update link register with the llvm return address of the next ir instruction
-    // this is an interesting one, since i really don't have a good way to "store the instr.address + 4" in LR and make it work,
-    // here is what i do, i create a new basic block for the address of the next instruction (so instr.address + 4 bytes) and store it
+    // this is an interesting one, since i really don't have a good way to "store the address + 4" in LR and make it work,
+    // here is what i do, i create a new basic block for the address of the next instruction (so address + 4 bytes) and store it
     // in LR, so when LR is used to return, it branch to the basic block so the next instruction
     // i think there is a better way to handle this but.. it should work fine for now :}
-    // llvm::BlockAddress* lr_BB = func->getCreateBBinMap(instr.address + 4); fix it
+    // llvm::BlockAddress* lr_BB = func->getBlock(address + 4); fix it
 
 
     auto argIter = func->m_irFunc->arg_begin();
     llvm::Argument* arg1 = &*argIter;
     llvm::Argument* arg2 = &*(++argIter);
 
-    BUILD->CreateStore(i32Const(instr.address + 4), func->getRegister("LR"));
-	BUILD->CreateCall(targetFunc->m_irFunc, {arg1, i32Const(instr.address + 4)});
+    BUILD->CreateStore(i32Const(address + 4), func->getRegister("LR"));
+	BUILD->CreateCall(targetFunc->m_irFunc, {arg1, i32Const(address + 4)});
 
 
-    uint32_t lrAddr = instr.address + 4;
-    Instruction lrInstr = func->m_irGen->instrsList.at(lrAddr);
-
-    while (strcmp(lrInstr.opcName.c_str(), "nop") == 0)
+    // skip the nops (ori r0, r0, 0) after the call
+    const PBinaryHandle::CodeSection* section = func->m_irGen->m_binary->findCode(address);
+    size_t next = section->indexOf(address + 4);
+    while (next < section->m_count && section->m_words[next] == 0x60000000)
     {
-        lrAddr += 4;
-        lrInstr = func->m_irGen->instrsList.at(lrAddr);
+        next++;
     }
+    uint32_t lrAddr = section->m_address + (uint32_t)next * 4;
 
     // check if the lr target is a function, if yes, restore execution flow to that
-    if (func->m_irGen->isIRFuncinMap(lrAddr))
+    if (IRFunc* lrFunc = func->m_irGen->getFuncInMap(lrAddr))
     {
-        IRFunc* lrFunc = func->m_irGen->getCreateFuncInMap(lrAddr);
-        func->m_irGen->initFuncBody(lrFunc);
+        if (lrFunc->m_irFunc == nullptr) func->m_irGen->initFuncBody(lrFunc);
         BUILD->CreateCall(lrFunc->m_irFunc, { arg1, i32Const(lrAddr)});
         BUILD->CreateRetVoid();
     }
 }
 
-inline void b_e(Instruction instr, IRFunc* func)
+// leave the function for <target> of the branch at <address>: a tail call when it starts a function, otherwise
+// through the runtime like a bctr with CTR = target
+inline void branchOut(IRFunc* func, uint32_t address, uint32_t target)
 {
-    uint32_t target = instr.address + signExtend(instr.ops[0], 24);
-    // tail call
-    if(func->m_irGen->isIRFuncinMap(target))
-    {
-        auto argIter = func->m_irFunc->arg_begin();
-        llvm::Argument* arg1 = &*argIter;
-        llvm::Argument* arg2 = &*(++argIter);
+    auto argIter = func->m_irFunc->arg_begin();
+    llvm::Argument* arg1 = &*argIter;
+    llvm::Argument* arg2 = &*(++argIter);
 
-        IRFunc* tailCall = func->m_irGen->getCreateFuncInMap(target);
-		if (tailCall->m_irFunc == nullptr) func->m_irGen->initFuncBody(tailCall);
+    if (IRFunc* tailCall = func->m_irGen->getFuncInMap(target))
+    {
+        if (tailCall->m_irFunc == nullptr) func->m_irGen->initFuncBody(tailCall);
         BUILD->CreateCall(tailCall->m_irFunc, { arg1, arg2 });
         BUILD->CreateRetVoid();
         return;
     }
 
-    llvm::BasicBlock* target_BB = func->getCreateBBinMap(target);
+    BUILD->CreateStore(i32Const(target), func->getRegister("CTR"));
+    BUILD->CreateCall(func->m_irGen->bcctrlFunc, { arg1, i32Const(address + 4) });
+    BUILD->CreateRetVoid();
+}
+
+inline void b_e(Instruction instr, uint32_t address, IRFunc* func)
+{
+    uint32_t target = InstructionRegistry::GetBranchTarget(instr.opcode, instr.m_rawData, address);
+    llvm::BasicBlock* target_BB = func->getBlock(target);
+    if (target_BB == nullptr)
+    {
+        // tail branch
+        branchOut(func, address, target);
+        return;
+    }
     BUILD->CreateBr(target_BB);
 }
 
-inline void bclr_e(Instruction instr, IRFunc* func)
+// bx and bcctrx share their opcode with the link forms
+inline void bx_e(Instruction instr, uint32_t address, IRFunc* func)
+{
+    if (instr.get<FORM_I>().LK)
+    {
+        bl_e(instr, address, func);
+        return;
+    }
+    b_e(instr, address, func);
+}
+
+inline void bclr_e(Instruction instr, uint32_t address, IRFunc* func)
 {
 	BUILD->CreateRetVoid();
 }
 
-inline void bcctrl_e(Instruction instr, IRFunc* func)
+inline void bcctrl_e(Instruction instr, uint32_t address, IRFunc* func)
 {
     auto argIter = func->m_irFunc->arg_begin();
     llvm::Argument* arg1 = &*argIter;
     llvm::Argument* arg2 = &*(++argIter);
 
-    BUILD->CreateCall(func->m_irGen->bcctrlFunc, { arg1, i32Const(instr.address + 4) });
-}
-
-inline void bcctr_e(Instruction instr, IRFunc* func)
-{
-    //if (func->has_jumpTable)
-    //{
-    //    for (JumpTable* table : func->jumpTables)
-    //    {
-    //        if (instr.address >= table->start_Address && instr.address <= table->end_Address)
-    //        {
-    //            llvm::SwitchInst* Switch = BUILD->CreateSwitch(ctrVal(), func->getCreateBBinMap(table->targets[0]), table->targets.size());
-    //            std::unordered_set<uint32_t> processedValues; // do not allow duplicates
-    //            for (uint32_t target : table->targets)
-    //            {
-    //                if (processedValues.find(target) == processedValues.end())
-    //                {
-    //                    Switch->addCase(i32Const(target), func->getCreateBBinMap(target));
-    //                    processedValues.insert(target);
-    //                }
-    //            }
-    //            return;
-    //        }
-    //    }
-    //}
+    BUILD->CreateCall(func->m_irGen->bcctrlFunc, { arg1, i32Const(address + 4) });
+}
+
+inline void bcctr_e(Instruction instr, uint32_t address, IRFunc* func)
+{
+    // switch over the targets of a recovered jump table, anything else in CTR still goes through the runtime
+    if (const Analysis::JumpTable* table = func->findJumpTable(address))
+    {
+        std::vector<uint32_t> targets = table->m_targets;
+        std::sort(targets.begin(), targets.end());
+        targets.erase(std::unique(targets.begin(), targets.end()), targets.end()); // do not allow duplicates
+
+        llvm::BasicBlock* fallback = llvm::BasicBlock::Create(BUILD->getContext(), "bcctr_runtime", func->m_irFunc);
+        llvm::SwitchInst* Switch = BUILD->CreateSwitch(ctrVal(), fallback, targets.size());
+        for (uint32_t target : targets)
+        {
+            Switch->addCase(i32Const(target), func->getBlock(target));
+        }
+        BUILD->SetInsertPoint(fallback);
+    }
 
-    DebugBreak();
     auto argIter = func->m_irFunc->arg_begin();
     llvm::Argument* arg1 = &*argIter;
     llvm::Argument* arg2 = &*(++argIter);
-    BUILD->CreateCall(func->m_irGen->bcctrlFunc, { arg1, i32Const(instr.address + 4) });
+    BUILD->CreateCall(func->m_irGen->bcctrlFunc, { arg1, i32Const(address + 4) });
 
     // here i also make a return, because this is the form that do not save LR
     // so when the runtime handler return it will return to the next address of this
@@ -423,184 +458,219 @@ inline void bcctr_e(Instruction instr, IRFunc* func)
     return;
 }
 
-inline void stfd_e(Instruction instr, IRFunc* func)
+inline void bcctrx_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto frValue = BUILD->CreateLoad(BUILD->getDoubleTy(), func->getRegister("FR", instr.ops[0]), "load_fr");
-    BUILD->CreateStore(frValue, EA_HostPtr(func, getEA_D(func, instr.ops[1], instr.ops[2]))); // address needs to be a pointer (pointer to an address in memory)
+    if (instr.get<FORM_XL>().LK)
+    {
+        bcctrl_e(instr, address, func);
+        return;
+    }
+    bcctr_e(instr, address, func);
+}
+
+inline void stfd_e(Instruction instr, uint32_t address, IRFunc* func)
+{
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    auto frValue = BUILD->CreateLoad(BUILD->getDoubleTy(), func->getRegister("FR", op.D), "load_fr");
+    BUILD->CreateStore(frValue, EA_HostPtr(func, getEA_D(func, op.UIMM, op.A))); // address needs to be a pointer (pointer to an address in memory)
 }
 
-inline void addi_e(Instruction instr, IRFunc* func)
+inline void addi_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* im = sExt64(BUILD->getInt16(instr.ops[2]));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    llvm::Value* im = sExt64(BUILD->getInt16(op.UIMM));
     llvm::Value* rrValue;
-    if (instr.ops[1] != 0)
+    if (op.A != 0)
     {
-		rrValue = gprVal(instr.ops[1]);
+		rrValue = gprVal(op.A);
 	}
 	else
 	{
 		rrValue = i64Const(0);
 	}
-    llvm::Value* val = instr.ops[1] ? BUILD->CreateAdd(rrValue, im, "val") : im;
-    BUILD->CreateStore(val, func->getRegister("RR", instr.ops[0]));
+    llvm::Value* val = op.A ? BUILD->CreateAdd(rrValue, im, "val") : im;
+    BUILD->CreateStore(val, func->getRegister("RR", op.D));
 }
 
-inline void addic_e(Instruction instr, IRFunc* func)
+inline void addic_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* im = sExt64(BUILD->getInt16(instr.ops[2]));
-    llvm::Value* rrValue = gprVal(instr.ops[1]);
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    llvm::Value* im = sExt64(BUILD->getInt16(op.UIMM));
+    llvm::Value* rrValue = gprVal(op.A);
     
     llvm::Value* val = BUILD->CreateAdd(rrValue, im, "val");
-    BUILD->CreateStore(val, func->getRegister("RR", instr.ops[0]));
+    BUILD->CreateStore(val, func->getRegister("RR", op.D));
 
 
 	StoreCA(func, AddCarried(func, rrValue, im));
-    UpdateCR_CmpZero(func, instr, "addicRC", val);
+    UpdateCR_CmpZero(func, instr, val);
 }
 
 
 
 // add immediate shifted
 // if rA = 0 then it will use value 0 and not the content of rA (because lis use 0)
-inline void addis_e(Instruction instr, IRFunc* func)
+inline void addis_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    int16_t imm = static_cast<int16_t>(instr.ops[2]);
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    int16_t imm = static_cast<int16_t>(op.UIMM);
     int64_t shiftedImm = static_cast<int64_t>(imm) << 16;
 
     llvm::Value* shift = i64Const(shiftedImm);
     llvm::Value* rrValue;
-    if (instr.ops[1] != 0)
+    if (op.A != 0)
     {
-        rrValue = gprVal(instr.ops[1]);
+        rrValue = gprVal(op.A);
     }
     else
     {
         rrValue = i64Const(0);
     }
-	llvm::Value* val = instr.ops[1] ? BUILD->CreateAdd(rrValue, shift, "val") : shift;
-    BUILD->CreateStore(val, func->getRegister("RR", instr.ops[0]));
+	llvm::Value* val = op.A ? BUILD->CreateAdd(rrValue, shift, "val") : shift;
+    BUILD->CreateStore(val, func->getRegister("RR", op.D));
 }
 
-inline void adde_e(Instruction instr, IRFunc* func)
+inline void adde_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* ab = BUILD->CreateAdd(gprVal(instr.ops[1]), gprVal(instr.ops[2]), "val");
+    Operands<FORM_XO> op = instr.get<FORM_XO>();
+    llvm::Value* ab = BUILD->CreateAdd(gprVal(op.A), gprVal(op.B), "val");
 	llvm::Value* abXer = BUILD->CreateAdd(ab, zExt64(getCA(func)), "valXer");
-    BUILD->CreateStore(abXer, func->getRegister("RR", instr.ops[0]));
+    BUILD->CreateStore(abXer, func->getRegister("RR", op.D));
 }
 
-inline void addze_e(Instruction instr, IRFunc* func)
+inline void addze_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* ab = BUILD->CreateAdd(gprVal(instr.ops[1]), zExt64(getCA(func)), "val");
-    BUILD->CreateStore(ab, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_XO> op = instr.get<FORM_XO>();
+    llvm::Value* ab = BUILD->CreateAdd(gprVal(op.A), zExt64(getCA(func)), "val");
+    BUILD->CreateStore(ab, func->getRegister("RR", op.D));
 
     // XER CA and RC
-    StoreCA(func, AddCarried(func, gprVal(instr.ops[1]), getCA(func)));
-    UpdateCR_CmpZero(func, instr, "addzeRC", ab);
+    StoreCA(func, AddCarried(func, gprVal(op.A), getCA(func)));
+    UpdateCR_CmpZero(func, instr, ab);
 }
 
-inline void add_e(Instruction instr, IRFunc* func)
+inline void add_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* val = BUILD->CreateAdd(gprVal(instr.ops[1]), gprVal(instr.ops[2]), "val");
-    BUILD->CreateStore(val, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_XO> op = instr.get<FORM_XO>();
+    llvm::Value* val = BUILD->CreateAdd(gprVal(op.A), gprVal(op.B), "val");
+    BUILD->CreateStore(val, func->getRegister("RR", op.D));
 }
 
-inline void bcx_e(Instruction instr, IRFunc* func)
+inline void bcx_e(Instruction instr, uint32_t address, IRFunc* func)
 {
+    Operands<FORM_B> op = instr.get<FORM_B>();
     // first check how to manage the branch condition
     // if "should_branch" == True then
-    llvm::Value* bi = BUILD->CreateTrunc(extractCRBit(func, instr.ops[1]), BUILD->getInt1Ty(), "tr");
+    llvm::Value* bi = BUILD->CreateTrunc(extractCRBit(func, op.BI), BUILD->getInt1Ty(), "tr");
     llvm::Value* should_branch = getBOOperation(func, instr, bi);
 
     
     // compute condition BBs
-    llvm::BasicBlock* b_true = func->getCreateBBinMap(instr.address + (int16_t)(instr.ops[2] << 2));
-    llvm::BasicBlock* b_false = func->getCreateBBinMap(instr.address + 4);
+    uint32_t target = InstructionRegistry::GetBranchTarget(instr.opcode, instr.m_rawData, address);
+    llvm::BasicBlock* b_true = func->getBlock(target);
+    llvm::BasicBlock* b_false = func->getBlock(address + 4);
+    if (b_true == nullptr)
+    {
+        // conditional tail branch, leave the function from a block of its own
+        b_true = llvm::BasicBlock::Create(BUILD->getContext(), "bc_out", func->m_irFunc);
+        BUILD->CreateCondBr(should_branch, b_true, b_false);
+        BUILD->SetInsertPoint(b_true);
+        branchOut(func, address, target);
+        return;
+    }
 
     BUILD->CreateCondBr(should_branch, b_true, b_false);
 }
 
-inline void extsw_e(Instruction instr, IRFunc* func)
+inline void extsw_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* val = sExt64(trcTo32(gprVal(instr.ops[1])));
-    BUILD->CreateStore(val, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "extswRC", val);
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    llvm::Value* val = sExt64(trcTo32(gprVal(op.D)));
+    BUILD->CreateStore(val, func->getRegister("RR", op.A));
+    UpdateCR_CmpZero(func, instr, val);
 }
 
-inline void extsh_e(Instruction instr, IRFunc* func)
+inline void extsh_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* val = sExt64(trcTo16(gprVal(instr.ops[1])));
-    BUILD->CreateStore(val, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "extshRC", val);
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    llvm::Value* val = sExt64(trcTo16(gprVal(op.D)));
+    BUILD->CreateStore(val, func->getRegister("RR", op.A));
+    UpdateCR_CmpZero(func, instr, val);
 }
 
-inline void extsb_e(Instruction instr, IRFunc* func)
+inline void extsb_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* val = sExt64(trcTo8(gprVal(instr.ops[1])));
-	BUILD->CreateStore(val, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "extsbRC", val);
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    llvm::Value* val = sExt64(trcTo8(gprVal(op.D)));
+	BUILD->CreateStore(val, func->getRegister("RR", op.A));
+    UpdateCR_CmpZero(func, instr, val);
 }
 
-inline void cmpli_e(Instruction instr, IRFunc* func)
+inline void cmpli_e(Instruction instr, uint32_t address, IRFunc* func)
 {
+    Operands<FORM_D> op = instr.get<FORM_D>();
     llvm::Value* a;
-    if(instr.ops[1] = 0)
+    if (op.L == 0)
     {
-        llvm::Value* low32Bits = trcTo32(gprVal(instr.ops[2]));
+        llvm::Value* low32Bits = trcTo32(gprVal(op.A));
         a = zExt64(low32Bits);
     } 
     else
     {
-        a = gprVal(instr.ops[2]);
+        a = gprVal(op.A);
     }
 
-    UpdateCR_CmpValue(func, instr, a, i64Const(instr.ops[3]), instr.ops[0]);
+    UpdateCR_CmpValue(func, instr, a, i64Const(op.UIMM), op.crfD);
 }
 
 
-inline void cmpl_e(Instruction instr, IRFunc* func)
+inline void cmpl_e(Instruction instr, uint32_t address, IRFunc* func)
 {
+    Operands<FORM_X> op = instr.get<FORM_X>();
     llvm::Value* a;
     llvm::Value* b;
-    if (instr.ops[1] == 0)
+    if (op.L == 0)
     {
-        llvm::Value* low32Bits = trcTo32(gprVal(instr.ops[2]));
+        llvm::Value* low32Bits = trcTo32(gprVal(op.A));
         a = zExt64(low32Bits);
-        llvm::Value* low32Bitsb = trcTo32(gprVal(instr.ops[3]));
+        llvm::Value* low32Bitsb = trcTo32(gprVal(op.B));
         b = zExt64(low32Bitsb);
     }
     else
     {
-        a = gprVal(instr.ops[2]);
-        b = gprVal(instr.ops[3]);
+        a = gprVal(op.A);
+        b = gprVal(op.B);
     }
 
-    UpdateCR_CmpValue(func, instr, a, b, instr.ops[0]);
+    UpdateCR_CmpValue(func, instr, a, b, op.crfD);
 }
 
 
-inline void cmpw_e(Instruction instr, IRFunc* func)
+inline void cmpw_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* rA = gprVal(instr.ops[2]);
-    llvm::Value* rB = gprVal(instr.ops[3]);
-    if(instr.ops[1] != 1)
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    llvm::Value* rA = gprVal(op.A);
+    llvm::Value* rB = gprVal(op.B);
+    if(op.L != 1)
     {
         rA = sExt64(trcTo32(rA));
         rB = sExt64(trcTo32(rB));
     }
     // update CR
-    UpdateCR_CmpValue(func, instr, rA, rB, instr.ops[0]);
+    UpdateCR_CmpValue(func, instr, rA, rB, op.crfD);
 }
 
-inline void cmpi_e(Instruction instr, IRFunc* func)
+inline void cmpi_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* rA = gprVal(instr.ops[2]);
-    llvm::Value* imm = sExt64(sign16(instr.ops[3]));
-    if (instr.ops[1] == 0)
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    llvm::Value* rA = gprVal(op.A);
+    llvm::Value* imm = sExt64(sign16(op.SIMM));
+    if (op.L == 0)
     {
         rA = sExt64(trcTo32(rA));
         imm = sExt64(imm);
     }
-    UpdateCR_CmpValue(func, instr, rA, imm, instr.ops[0]);
+    UpdateCR_CmpValue(func, instr, rA, imm, op.crfD);
 }
 
 
@@ -610,75 +680,88 @@ inline void cmpi_e(Instruction instr, IRFunc* func)
 
 // Load Word
 
-inline void lwa_e(Instruction instr, IRFunc* func)
+inline void lwa_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    BUILD->CreateStore(sExt64(Load32(getEA_D(func, instr.ops[1], instr.ops[2]))), func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_DS> op = instr.get<FORM_DS>();
+    BUILD->CreateStore(sExt64(Load32(getEA_D(func, op.DS, op.A))), func->getRegister("RR", op.D));
 }
-inline void lwz_e(Instruction instr, IRFunc* func)
+inline void lwz_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    BUILD->CreateStore(zExt64(Load32(getEA_D(func, instr.ops[1], instr.ops[2]))), func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    BUILD->CreateStore(zExt64(Load32(getEA_D(func, op.UIMM, op.A))), func->getRegister("RR", op.D));
 }
-inline void lwzu_e(Instruction instr, IRFunc* func)
+inline void lwzu_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* ea = getEA_D(func, instr.ops[1], instr.ops[2]);
-    BUILD->CreateStore(zExt64(Load32(ea)), func->getRegister("RR", instr.ops[0]));
-    updateRA_EA(func, instr, ea);
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    llvm::Value* ea = getEA_D(func, op.UIMM, op.A);
+    BUILD->CreateStore(zExt64(Load32(ea)), func->getRegister("RR", op.D));
+    updateRA_EA(func, op.A, ea);
 }
-inline void lwzx_e(Instruction instr, IRFunc* func)
+inline void lwzx_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    BUILD->CreateStore(zExt64(Load32(getEA_R(func, instr.ops[1], instr.ops[2]))), func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    BUILD->CreateStore(zExt64(Load32(getEA_R(func, op.A, op.B))), func->getRegister("RR", op.D));
 }
 
 // Load Half-Word
 
-inline void lhz_e(Instruction instr, IRFunc* func)
+inline void lhz_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    BUILD->CreateStore(zExt64(Load16(getEA_D(func, instr.ops[1], instr.ops[2]))), func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    BUILD->CreateStore(zExt64(Load16(getEA_D(func, op.UIMM, op.A))), func->getRegister("RR", op.D));
 }
-inline void lhzu_e(Instruction instr, IRFunc* func)
+inline void lhzu_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* ea = getEA_D(func, instr.ops[1], instr.ops[2]);
-    BUILD->CreateStore(zExt64(Load16(ea)), func->getRegister("RR", instr.ops[0]));
-    updateRA_EA(func, instr, ea);
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    llvm::Value* ea = getEA_D(func, op.UIMM, op.A);
+    BUILD->CreateStore(zExt64(Load16(ea)), func->getRegister("RR", op.D));
+    updateRA_EA(func, op.A, ea);
 }
-inline void lha_e(Instruction instr, IRFunc* func)
+inline void lha_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    BUILD->CreateStore(sExt64(Load16(getEA_D(func, instr.ops[1], instr.ops[2]))), func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    BUILD->CreateStore(sExt64(Load16(getEA_D(func, op.UIMM, op.A))), func->getRegister("RR", op.D));
 }
-inline void lhzx_e(Instruction instr, IRFunc* func)
+inline void lhzx_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    BUILD->CreateStore(zExt64(Load16(getEA_R(func, instr.ops[1], instr.ops[2]))), func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    BUILD->CreateStore(zExt64(Load16(getEA_R(func, op.A, op.B))), func->getRegister("RR", op.D));
 }
 
 // Load Byte
 
-inline void lbz_e(Instruction instr, IRFunc* func)
+inline void lbz_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    BUILD->CreateStore(zExt64(Load8(getEA_D(func, instr.ops[1], instr.ops[2]))), func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    BUILD->CreateStore(zExt64(Load8(getEA_D(func, op.UIMM, op.A))), func->getRegister("RR", op.D));
 }
-inline void lbzu_e(Instruction instr, IRFunc* func)
+inline void lbzu_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* ea = getEA_D(func, instr.ops[1], instr.ops[2]);
-    BUILD->CreateStore(zExt64(Load8(ea)), func->getRegister("RR", instr.ops[0]));
-    updateRA_EA(func, instr, ea);
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    llvm::Value* ea = getEA_D(func, op.UIMM, op.A);
+    BUILD->CreateStore(zExt64(Load8(ea)), func->getRegister("RR", op.D));
+    updateRA_EA(func, op.A, ea);
 }
-inline void lbzx_e(Instruction instr, IRFunc* func)
+inline void lbzx_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    BUILD->CreateStore(zExt64(Load8(getEA_R(func, instr.ops[1], instr.ops[2]))), func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    BUILD->CreateStore(zExt64(Load8(getEA_R(func, op.A, op.B))), func->getRegister("RR", op.D));
 }
 
 // Load Double-Word
 
-inline void ld_e(Instruction instr, IRFunc* func)
+inline void ld_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    BUILD->CreateStore(Load64(getEA_DWORD_D(func, instr.ops[1], instr.ops[2])), func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_DS> op = instr.get<FORM_DS>();
+    BUILD->CreateStore(Load64(getEA_DWORD_D(func, op.DS, op.A)), func->getRegister("RR", op.D));
 }
 
-inline void ldu_e(Instruction instr, IRFunc* func)
+inline void ldu_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* ea = getEA_DWORD_D(func, instr.ops[1], instr.ops[2]);
-    BUILD->CreateStore(Load64(ea), func->getRegister("RR", instr.ops[0]));
-    updateRA_EA(func, instr, ea);
+    Operands<FORM_DS> op = instr.get<FORM_DS>();
+    llvm::Value* ea = getEA_DWORD_D(func, op.DS, op.A);
+    BUILD->CreateStore(Load64(ea), func->getRegister("RR", op.D));
+    updateRA_EA(func, op.A, ea);
 }
 
 
@@ -688,73 +771,84 @@ inline void ldu_e(Instruction instr, IRFunc* func)
 
 // Store Word
 
-inline void stw_e(Instruction instr, IRFunc* func)
+inline void stw_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    Store32(gprVal(instr.ops[0]), getEA_D(func, instr.ops[1], instr.ops[2]));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    Store32(gprVal(op.D), getEA_D(func, op.UIMM, op.A));
 }
-inline void stwu_e(Instruction instr, IRFunc* func)
+inline void stwu_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* ea = getEA_D(func, instr.ops[1], instr.ops[2]);
-    Store32(gprVal(instr.ops[0]), ea)
-    updateRA_EA(func, instr, ea);
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    llvm::Value* ea = getEA_D(func, op.UIMM, op.A);
+    Store32(gprVal(op.D), ea)
+    updateRA_EA(func, op.A, ea);
 }
-inline void stwx_e(Instruction instr, IRFunc* func)
+inline void stwx_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    Store32(gprVal(instr.ops[0]), getEA_R(func, instr.ops[1], instr.ops[2]));
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    Store32(gprVal(op.D), getEA_R(func, op.A, op.B));
 }
 
 
 // Store Half-Word
 
-inline void sth_e(Instruction instr, IRFunc* func)
+inline void sth_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    Store16(gprVal(instr.ops[0]), getEA_D(func, instr.ops[1], instr.ops[2]));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    Store16(gprVal(op.D), getEA_D(func, op.UIMM, op.A));
 }
-inline void sthu_e(Instruction instr, IRFunc* func)
+inline void sthu_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* ea = getEA_D(func, instr.ops[1], instr.ops[2]);
-    Store16(gprVal(instr.ops[0]), ea);
-    updateRA_EA(func, instr, ea);
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    llvm::Value* ea = getEA_D(func, op.UIMM, op.A);
+    Store16(gprVal(op.D), ea);
+    updateRA_EA(func, op.A, ea);
 }
-inline void sthx_e(Instruction instr, IRFunc* func)
+inline void sthx_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    Store16(gprVal(instr.ops[0]), getEA_R(func, instr.ops[1], instr.ops[2]));
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    Store16(gprVal(op.D), getEA_R(func, op.A, op.B));
 }
 
 // Store Byte
 
-inline void stb_e(Instruction instr, IRFunc* func)
+inline void stb_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    Store8(gprVal(instr.ops[0]), getEA_D(func, instr.ops[1], instr.ops[2]));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    Store8(gprVal(op.D), getEA_D(func, op.UIMM, op.A));
 }
-inline void stbu_e(Instruction instr, IRFunc* func)
+inline void stbu_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* ea = getEA_D(func, instr.ops[1], instr.ops[2]);
-    Store8(gprVal(instr.ops[0]), ea);
-    updateRA_EA(func, instr, ea);
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    llvm::Value* ea = getEA_D(func, op.UIMM, op.A);
+    Store8(gprVal(op.D), ea);
+    updateRA_EA(func, op.A, ea);
 }
 
 
 // Store Double-Word
 
-inline void std_e(Instruction instr, IRFunc* func)
+inline void std_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    Store64(gprVal(instr.ops[0]), getEA_DWORD_D(func, instr.ops[1], instr.ops[2]));
+    Operands<FORM_DS> op = instr.get<FORM_DS>();
+    Store64(gprVal(op.D), getEA_DWORD_D(func, op.DS, op.A));
 }
-inline void stdu_e(Instruction instr, IRFunc* func)
+inline void stdu_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* ea = getEA_DWORD_D(func, instr.ops[1], instr.ops[2]);
-    Store64(gprVal(instr.ops[0]), ea);
-    updateRA_EA(func, instr, ea);
+    Operands<FORM_DS> op = instr.get<FORM_DS>();
+    llvm::Value* ea = getEA_DWORD_D(func, op.DS, op.A);
+    Store64(gprVal(op.D), ea);
+    updateRA_EA(func, op.A, ea);
 }
 
 
 
-inline void slw_e(Instruction instr, IRFunc* func)
+inline void slw_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* sh = BUILD->CreateAnd(trcTo8(gprVal(instr.ops[2])), i8Const(0x3F), "and");
-    llvm::Value* v = BUILD->CreateSelect(BUILD->CreateICmpULT(gprVal(instr.ops[2]), i64Const(32), "ULT"), trcTo32(BUILD->CreateShl(gprVal(instr.ops[1]), zExt64(sh), "shl")), i32Const(0), "sel");
-    BUILD->CreateStore(zExt64(v), func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    llvm::Value* sh = BUILD->CreateAnd(trcTo8(gprVal(op.B)), i8Const(0x3F), "and");
+    llvm::Value* v = BUILD->CreateSelect(BUILD->CreateICmpULT(gprVal(op.B), i64Const(32), "ULT"), trcTo32(BUILD->CreateShl(gprVal(op.D), zExt64(sh), "shl")), i32Const(0), "sel");
+    BUILD->CreateStore(zExt64(v), func->getRegister("RR", op.A));
     /*if (i.X.Rc) {
         f.UpdateCR(0, v);
     }*/
@@ -763,53 +857,57 @@ inline void slw_e(Instruction instr, IRFunc* func)
 #define DMASK(b, e) (((0xFFFFFFFF << ((31 + (b)) - (e))) >> (b)))
 #define QMASK(b, e) ((0xFFFFFFFFFFFFFFFF << ((63 + (b)) - (e))) >> (b))
 // please optimize this
-inline void rlwinm_e(Instruction instr, IRFunc* func)
+inline void rlwinm_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    uint32_t mask = (instr.ops[3] <= instr.ops[4]) ? (DMASK(instr.ops[3], instr.ops[4])) : (DMASK(0, instr.ops[4]) | DMASK(3, 31));
+    Operands<FORM_M> op = instr.get<FORM_M>();
+    uint32_t mask = (op.MB <= op.ME) ? (DMASK(op.MB, op.ME)) : (DMASK(0, op.ME) | DMASK(3, 31));
 
-    uint32_t width = 32 - instr.ops[2];
-    llvm::Value* lhs = BUILD->CreateShl(gprVal(instr.ops[1]), instr.ops[2], "lhs");
-    llvm::Value* rhs = BUILD->CreateLShr(gprVal(instr.ops[1]), width, "rhs");
+    uint32_t width = 32 - op.SH;
+    llvm::Value* lhs = BUILD->CreateShl(gprVal(op.S), op.SH, "lhs");
+    llvm::Value* rhs = BUILD->CreateLShr(gprVal(op.S), width, "rhs");
     llvm::Value* rotl = BUILD->CreateOr(lhs, rhs, "rotl");
     
     auto masked = trcTo32(BUILD->CreateAnd(rotl, i64Const(mask), "and"));
-    BUILD->CreateStore(zExt64(masked), func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "rlwinmRC", zExt64(masked));
+    BUILD->CreateStore(zExt64(masked), func->getRegister("RR", op.A));
+    UpdateCR_CmpZero(func, instr, zExt64(masked));
 }
 
-inline void rlwimi_e(Instruction instr, IRFunc* func)
+inline void rlwimi_e(Instruction instr, uint32_t address, IRFunc* func)
 {
+    Operands<FORM_M> op = instr.get<FORM_M>();
     // n <- SH
     // r <- ROTL32((RS)[32:63], n)
     // m <- MASK(MB+32, ME+32)
     // RA <- r&m | (RA)&¬m
-    uint32_t width = 32 - instr.ops[2];
-    llvm::Value* lhs = BUILD->CreateShl(gprVal(instr.ops[1]), instr.ops[2], "lhs");
-    llvm::Value* rhs = BUILD->CreateLShr(gprVal(instr.ops[1]), width, "rhs");
+    uint32_t width = 32 - op.SH;
+    llvm::Value* lhs = BUILD->CreateShl(gprVal(op.S), op.SH, "lhs");
+    llvm::Value* rhs = BUILD->CreateLShr(gprVal(op.S), width, "rhs");
     llvm::Value* rotl = BUILD->CreateOr(lhs, rhs, "rotl");
-    uint64_t mask = XEMASK(instr.ops[3] + 32, instr.ops[4] + 32);
+    uint64_t mask = XEMASK(op.MB + 32, op.ME + 32);
     if (mask == 0xFFFFFFFFFFFFFFFFull)
     {
         DebugBreak();
     }
-    llvm::Value* result = BUILD->CreateOr(BUILD->CreateAnd(trcTo32(rotl), i32Const(mask), "and"), BUILD->CreateAnd(trcTo32(gprVal(instr.ops[0])), i32Const(~mask), "and"), "or");
-    BUILD->CreateStore(result, func->getRegister("RR", instr.ops[0]));
+    llvm::Value* result = BUILD->CreateOr(BUILD->CreateAnd(trcTo32(rotl), i32Const(mask), "and"), BUILD->CreateAnd(trcTo32(gprVal(op.A)), i32Const(~mask), "and"), "or");
+    BUILD->CreateStore(result, func->getRegister("RR", op.A));
 }
 
-inline void rldicl_e(Instruction instr, IRFunc* func)
+inline void rldicl_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    uint32_t width = 64 - instr.ops[2];
-    llvm::Value* lhs = BUILD->CreateShl(gprVal(instr.ops[1]), instr.ops[2], "lhs");
-    llvm::Value* rhs = BUILD->CreateLShr(gprVal(instr.ops[1]), width, "rhs");
+    Operands<FORM_MD> op = instr.get<FORM_MD>();
+    uint32_t width = 64 - op.SH;
+    llvm::Value* lhs = BUILD->CreateShl(gprVal(op.S), op.SH, "lhs");
+    llvm::Value* rhs = BUILD->CreateLShr(gprVal(op.S), width, "rhs");
     llvm::Value* rotl = BUILD->CreateOr(lhs, rhs, "rotl");
-    uint64_t mask = QMASK(instr.ops[3], 63);
+    uint64_t mask = QMASK(op.MB, 63);
     llvm::Value* result = BUILD->CreateAnd(rotl, i64Const(mask), "and");
-    BUILD->CreateStore(result, func->getRegister("RR", instr.ops[0]));
+    BUILD->CreateStore(result, func->getRegister("RR", op.A));
 }
 
 
-inline void srawi_e(Instruction instr, IRFunc* func) 
+inline void srawi_e(Instruction instr, uint32_t address, IRFunc* func) 
 {
+    Operands<FORM_X> op = instr.get<FORM_X>();
     // n <- SH
     // r <- ROTL32((RS)[32:63], 64-n)
     // m <- MASK(n+32, 63)
@@ -820,9 +918,9 @@ inline void srawi_e(Instruction instr, IRFunc* func)
     // if n >= 32: rA <- 64 sign bits of rS, XER[CA] = sign bit of lo_32(rS)
    
 
-    llvm::Value* v = trcTo32(gprVal(instr.ops[1]));
+    llvm::Value* v = trcTo32(gprVal(op.D));
     llvm::Value* ca;
-    if (!instr.ops[2]) // if shift is 0 don't calculate the other shis
+    if (!op.B) // if shift is 0 don't calculate the other shis
     {
         // No shift, just a fancy sign extend and CA clearer.
         v = sExt64(v);
@@ -832,7 +930,7 @@ inline void srawi_e(Instruction instr, IRFunc* func)
     {
         // CA is set if any bits are shifted out of the right and if the result
         // is negative.
-        uint32_t mask = (uint32_t)XEMASK(64 - instr.ops[2], 63);
+        uint32_t mask = (uint32_t)XEMASK(64 - op.B, 63);
 
         if (mask == 1) 
         {
@@ -843,94 +941,111 @@ inline void srawi_e(Instruction instr, IRFunc* func)
                 BUILD->CreateICmpNE(BUILD->CreateAnd(v, i32Const(mask), "and"), i32Const(0), "cmp"), "and");
         }
 
-        //v = f.Sha(v, (int8_t)instr.ops[2]), v = sExt64(v);
-        v = BUILD->CreateAShr(v, i32Const(instr.ops[2]), "ashr"), v = sExt64(v);
+        //v = f.Sha(v, (int8_t)op.B), v = sExt64(v);
+        v = BUILD->CreateAShr(v, i32Const(op.B), "ashr"), v = sExt64(v);
     }
 
     StoreCA(func, ca);
 
-    BUILD->CreateStore(v, func->getRegister("RR", instr.ops[0]));
+    BUILD->CreateStore(v, func->getRegister("RR", op.A));
     /*if (i.X.Rc) {
         f.UpdateCR(0, v);
     }*/
 }
 
 // AHHHHHHH instrinsic
-inline void cntlzw_e(Instruction instr, IRFunc* func)
+inline void cntlzw_e(Instruction instr, uint32_t address, IRFunc* func)
 {
+    Operands<FORM_X> op = instr.get<FORM_X>();
     llvm::Function* CtlzFunc = llvm::Intrinsic::getDeclarationIfExists(func->m_irGen->m_module, llvm::Intrinsic::ctlz, { i32_T });
     llvm::Value* IsZeroUndef = i1Const(false);  // Do not allow undef
-    llvm::Value* LeadingZeros = BUILD->CreateCall(CtlzFunc, { trcTo32(gprVal(instr.ops[1])), IsZeroUndef}, "call");
-    BUILD->CreateStore(LeadingZeros, func->getRegister("RR", instr.ops[0]));
+    llvm::Value* LeadingZeros = BUILD->CreateCall(CtlzFunc, { trcTo32(gprVal(op.D)), IsZeroUndef}, "call");
+    BUILD->CreateStore(LeadingZeros, func->getRegister("RR", op.A));
 }
 
 //
 //// bitwise operators
 //
 
-inline void orx_e(Instruction instr, IRFunc* func)
+inline void orx_e(Instruction instr, uint32_t address, IRFunc* func)
 {
+    Operands<FORM_X> op = instr.get<FORM_X>();
     // The contents of rS are ORed with the contents of rB and the result is placed into rA.
-    llvm::Value* value = BUILD->CreateOr(gprVal(instr.ops[1]), gprVal(instr.ops[2]), "or");
-    BUILD->CreateStore(value, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "orRC", value);
+    llvm::Value* value = BUILD->CreateOr(gprVal(op.D), gprVal(op.B), "or");
+    BUILD->CreateStore(value, func->getRegister("RR", op.A));
+    UpdateCR_CmpZero(func, instr, value);
 }
 
-inline void ori_e(Instruction instr, IRFunc* func)
+inline void ori_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto im64 = i64Const(instr.ops[2]);
-    auto orResult = BUILD->CreateOr(gprVal(instr.ops[1]), im64, "or");
-    BUILD->CreateStore(orResult, func->getRegister("RR", instr.ops[0]));
+    // nop is ori r0, r0, 0
+    if (instr.m_rawData == 0x60000000)
+    {
+        nop_e(instr, address, func);
+        return;
+    }
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    auto im64 = i64Const(op.UIMM);
+    auto orResult = BUILD->CreateOr(gprVal(op.D), im64, "or");
+    BUILD->CreateStore(orResult, func->getRegister("RR", op.A));
 }
 
-inline void oris_e(Instruction instr, IRFunc* func)
+inline void oris_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto im64 = zExt64(i32Const(instr.ops[2] << 16));
-    auto orResult = BUILD->CreateOr(gprVal(instr.ops[1]), im64, "or");
-    BUILD->CreateStore(orResult, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    auto im64 = zExt64(i32Const(op.UIMM << 16));
+    auto orResult = BUILD->CreateOr(gprVal(op.D), im64, "or");
+    BUILD->CreateStore(orResult, func->getRegister("RR", op.A));
 }
 
-inline void and_e(Instruction instr, IRFunc* func)
+inline void and_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto andResult = BUILD->CreateAnd(gprVal(instr.ops[1]), gprVal(instr.ops[2]), "and");
-    BUILD->CreateStore(andResult, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    auto andResult = BUILD->CreateAnd(gprVal(op.D), gprVal(op.B), "and");
+    BUILD->CreateStore(andResult, func->getRegister("RR", op.A));
 }
 
-inline void andc_e(Instruction instr, IRFunc* func)
+inline void andc_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto andResult = BUILD->CreateAnd(gprVal(instr.ops[1]), BUILD->CreateNot(gprVal(instr.ops[2]), "not"), "and");
-    BUILD->CreateStore(andResult, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    auto andResult = BUILD->CreateAnd(gprVal(op.D), BUILD->CreateNot(gprVal(op.B), "not"), "and");
+    BUILD->CreateStore(andResult, func->getRegister("RR", op.A));
 }
 
-inline void andiRC_e(Instruction instr, IRFunc* func)
+inline void andiRC_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto andResult = BUILD->CreateAnd(gprVal(instr.ops[1]), zExt64(i16Const(instr.ops[2])), "and");
-    BUILD->CreateStore(andResult, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "andiRC", andResult);
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    auto andResult = BUILD->CreateAnd(gprVal(op.D), zExt64(i16Const(op.UIMM)), "and");
+    BUILD->CreateStore(andResult, func->getRegister("RR", op.A));
+    UpdateCR_CmpZero(func, instr, andResult);
 }
 
-inline void xor_e(Instruction instr, IRFunc* func)
+inline void xor_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto xorResult = BUILD->CreateXor(gprVal(instr.ops[1]), gprVal(instr.ops[2]), "xor");
-    BUILD->CreateStore(xorResult, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    auto xorResult = BUILD->CreateXor(gprVal(op.D), gprVal(op.B), "xor");
+    BUILD->CreateStore(xorResult, func->getRegister("RR", op.A));
 }
 
-inline void xori_e(Instruction instr, IRFunc* func)
+inline void xori_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto xorResult = BUILD->CreateXor(gprVal(instr.ops[1]), zExt64(i16Const( instr.ops[2])), "xor");
-    BUILD->CreateStore(xorResult, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    auto xorResult = BUILD->CreateXor(gprVal(op.D), zExt64(i16Const( op.UIMM)), "xor");
+    BUILD->CreateStore(xorResult, func->getRegister("RR", op.A));
 }
 
-inline void neg_e(Instruction instr, IRFunc* func)
+inline void neg_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* negVal = BUILD->CreateNeg(gprVal(instr.ops[1]), "neg");
-    BUILD->CreateStore(negVal, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_XO> op = instr.get<FORM_XO>();
+    llvm::Value* negVal = BUILD->CreateNeg(gprVal(op.A), "neg");
+    BUILD->CreateStore(negVal, func->getRegister("RR", op.D));
 }
 
-inline void nor_e(Instruction instr, IRFunc* func)
+inline void nor_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* norVal = BUILD->CreateNeg(BUILD->CreateOr(gprVal(instr.ops[1]), gprVal(instr.ops[2]), "or"), "neg");
-    BUILD->CreateStore(norVal, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_X> op = instr.get<FORM_X>();
+    llvm::Value* norVal = BUILD->CreateNeg(BUILD->CreateOr(gprVal(op.D), gprVal(op.B), "or"), "neg");
+    BUILD->CreateStore(norVal, func->getRegister("RR", op.A));
 }
 
 
@@ -939,83 +1054,92 @@ inline void nor_e(Instruction instr, IRFunc* func)
 //// MATH
 //
 
-inline void mullw_e(Instruction instr, IRFunc* func)
+inline void mullw_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto mulResult = trcTo32(BUILD->CreateMul(gprVal(instr.ops[1]), gprVal(instr.ops[2]), "Mul"));
-    BUILD->CreateStore(mulResult, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "mullwRC", zExt64(mulResult));
+    Operands<FORM_XO> op = instr.get<FORM_XO>();
+    auto mulResult = trcTo32(BUILD->CreateMul(gprVal(op.A), gprVal(op.B), "Mul"));
+    BUILD->CreateStore(mulResult, func->getRegister("RR", op.D));
+    UpdateCR_CmpZero(func, instr, zExt64(mulResult));
 }
 
-inline void mulld_e(Instruction instr, IRFunc* func)
+inline void mulld_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto mulResult = trcTo64(BUILD->CreateMul(gprVal(instr.ops[1]), gprVal(instr.ops[2]), "Mul"));
-    BUILD->CreateStore(mulResult, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_XO> op = instr.get<FORM_XO>();
+    auto mulResult = trcTo64(BUILD->CreateMul(gprVal(op.A), gprVal(op.B), "Mul"));
+    BUILD->CreateStore(mulResult, func->getRegister("RR", op.D));
 }
 
-inline void mulli_e(Instruction instr, IRFunc* func)
+inline void mulli_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    auto mulResult = BUILD->CreateMul(gprVal(instr.ops[1]), sign64(instr.ops[2]), "Mul");
-    BUILD->CreateStore(mulResult, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    auto mulResult = BUILD->CreateMul(gprVal(op.A), sign64(op.SIMM), "Mul");
+    BUILD->CreateStore(mulResult, func->getRegister("RR", op.D));
 }
 
 
-inline void divwx_e(Instruction instr, IRFunc* func) 
+inline void divwx_e(Instruction instr, uint32_t address, IRFunc* func) 
 {
-    llvm::Value* divisor = trcTo32(gprVal(instr.ops[2]));
-    llvm::Value* v = BUILD->CreateSDiv(trcTo32(gprVal(instr.ops[1])), divisor, "div");
+    Operands<FORM_XO> op = instr.get<FORM_XO>();
+    llvm::Value* divisor = trcTo32(gprVal(op.B));
+    llvm::Value* v = BUILD->CreateSDiv(trcTo32(gprVal(op.A)), divisor, "div");
     v = zExt64(v);
-    BUILD->CreateStore(v, func->getRegister("RR", instr.ops[0]));
+    BUILD->CreateStore(v, func->getRegister("RR", op.D));
     /*if (i.XO.Rc) {
         f.UpdateCR(0, v);
     }*/
 }
 
-inline void divwux_e(Instruction instr, IRFunc* func)
+inline void divwux_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* divisor = trcTo32(gprVal(instr.ops[2]));
-    llvm::Value* v = BUILD->CreateUDiv(trcTo32(gprVal(instr.ops[1])), divisor, "div");
+    Operands<FORM_XO> op = instr.get<FORM_XO>();
+    llvm::Value* divisor = trcTo32(gprVal(op.B));
+    llvm::Value* v = BUILD->CreateUDiv(trcTo32(gprVal(op.A)), divisor, "div");
     v = zExt64(v);
-    BUILD->CreateStore(v, func->getRegister("RR", instr.ops[0]));
+    BUILD->CreateStore(v, func->getRegister("RR", op.D));
     /*if (i.XO.Rc) {
         f.UpdateCR(0, v);
     }*/
 }
 
-inline void divdu_e(Instruction instr, IRFunc* func)
+inline void divdu_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* divisor = gprVal(instr.ops[2]);
-    llvm::Value* v = BUILD->CreateUDiv(gprVal(instr.ops[1]), divisor, "div");
-    BUILD->CreateStore(v, func->getRegister("RR", instr.ops[0]));
+    Operands<FORM_XO> op = instr.get<FORM_XO>();
+    llvm::Value* divisor = gprVal(op.B);
+    llvm::Value* v = BUILD->CreateUDiv(gprVal(op.A), divisor, "div");
+    BUILD->CreateStore(v, func->getRegister("RR", op.D));
     /*if (i.XO.Rc) {
         f.UpdateCR(0, v);
     }*/
 }
 
-inline void subf_e(Instruction instr, IRFunc* func)
+inline void subf_e(Instruction instr, uint32_t address, IRFunc* func)
 {
+    Operands<FORM_XO> op = instr.get<FORM_XO>();
     // in docs the operation is:
     // rD ← ~ (rA) + (rB) + 1
     // but can be simplified to -> rB - rA, THEY ARE SWAPPED
-    llvm::Value* v = BUILD->CreateSub(gprVal(instr.ops[2]), gprVal(instr.ops[1]), "sub");
-    BUILD->CreateStore(v, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "subfRC", v);
+    llvm::Value* v = BUILD->CreateSub(gprVal(op.B), gprVal(op.A), "sub");
+    BUILD->CreateStore(v, func->getRegister("RR", op.D));
+    UpdateCR_CmpZero(func, instr, v);
 }
 
-inline void subfe_e(Instruction instr, IRFunc* func)
+inline void subfe_e(Instruction instr, uint32_t address, IRFunc* func)
 {
+    Operands<FORM_XO> op = instr.get<FORM_XO>();
     // in docs the operation is:
     // rD ← ~ (rA) + (rB) + 1
     // but can be simplified to -> rB - rA, THEY ARE SWAPPED
-    llvm::Value* v = BUILD->CreateSub(gprVal(instr.ops[2]), gprVal(instr.ops[1]), "sub");
+    llvm::Value* v = BUILD->CreateSub(gprVal(op.B), gprVal(op.A), "sub");
     llvm::Value* vXer = BUILD->CreateAdd(v, zExt64(getCA(func)), "valXer");
-    BUILD->CreateStore(vXer, func->getRegister("RR", instr.ops[0]));
-    UpdateCR_CmpZero(func, instr, "subfeRC", v);
+    BUILD->CreateStore(vXer, func->getRegister("RR", op.D));
+    UpdateCR_CmpZero(func, instr, v);
 }
 
-inline void subfic_e(Instruction instr, IRFunc* func)
+inline void subfic_e(Instruction instr, uint32_t address, IRFunc* func)
 {
-    llvm::Value* imm = i64Const(static_cast<int16_t>(instr.ops[2]));
-    llvm::Value* v = BUILD->CreateSub(imm, gprVal(instr.ops[1]), "sub");
-    BUILD->CreateStore(v, func->getRegister("RR", instr.ops[0]));
-    StoreCA(func, SubCarried(func, gprVal(instr.ops[1]), imm));
+    Operands<FORM_D> op = instr.get<FORM_D>();
+    llvm::Value* imm = i64Const(static_cast<int16_t>(op.UIMM));
+    llvm::Value* v = BUILD->CreateSub(imm, gprVal(op.A), "sub");
+    BUILD->CreateStore(v, func->getRegister("RR", op.D));
+    StoreCA(func, SubCarried(func, gprVal(op.A), imm));
 }
\ No newline at end of file
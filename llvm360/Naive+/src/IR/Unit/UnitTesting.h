@@ -9,7 +9,6 @@
 // i can view the register dump via the runtime CpuContext dumper
 //
 
-#define UNIT(instrName, func, ops) \
-	Instruction instr; \
-	instr.ops = ops; \
-	instrName##_e(instr, func); \
+#define UNIT(instrName, func, word) \
+	Instruction instr(InstructionRegistry::DecodeOpcode(word), word); \
+	instrName##_e(instr, 0, func); \
@@ -3,6 +3,11 @@
 #include "Loader/ImageLoader.h"
 #include <Loader/XEXImage.h>
 #include <Loader/PEImage.h>
+#include <filesystem>
+#include <algorithm>
+#include <bit>
+#include "ThreadPool.h"
+#include "Analysis/FunctionDiscovery.h"
 
 //void unitTest(IRGenerator* gen)
 //{
@@ -90,12 +95,226 @@ void PBinaryHandle::RecompileBinary()
 
 void PBinaryHandle::LoadBinary()
 {
-    auto bin = XLoader::ImageLoader::load(this->m_imagePath);
+    XLoader::LoadOptions options;
+    options.useGuestWindow = true;
+    options.lazy = true;
+    std::shared_ptr<XLoader::IImage> bin = XLoader::ImageLoader::load(this->m_imagePath, options);
     if (bin == nullptr)
     {
         LOG_ERROR("PBinaryHandle::LoadBinary", "Failed to load binary image");
         return;
     }
+    AttachImage(bin);
+}
+
+using CodeSection = PBinaryHandle::CodeSection;
+using Function = PBinaryHandle::Function;
+
+// a section is split in a few tasks per pool thread so the pool can balance them, but never below DecodeChunkMin words
+// so a task outweighs handing it out
+static const size_t DecodeTasksPerThread = 4;
+static const size_t DecodeChunkMin = 4096;
+
+// words decoded by one task for a section of <count> words, a multiple of 64 so every task owns whole words of the bitsets
+static size_t DecodeChunkSize(size_t count)
+{
+    size_t tasks = ThreadPool::global().getConcurrency() * DecodeTasksPerThread;
+    size_t chunk = ((count + tasks - 1) / tasks + 63) & ~(size_t)63;
+    return std::max(chunk, DecodeChunkMin);
+}
+
+using XrefIndex = PBinaryHandle::XrefIndex;
+
+// one reference before the index is sorted into parallel arrays
+struct XrefEntry
+{
+    uint32_t target;
+    uint32_t source;
+    XrefIndex::Kind kind;
+
+    bool operator<(const XrefEntry& other) const
+    {
+        return target != other.target ? target < other.target : source < other.source;
+    }
+};
+
+// how far after a lis the addi / ori that completes the address is looked for
+static const size_t XrefAddressWindow = 8;
+
+// Direct branches and lis-built addresses of the instructions [begin, end) of <code>, the whole section must be decoded
+// address references are kept whatever they point to, AttachImage drops the ones outside the code sections
+static void CollectXrefs(const CodeSection& code, size_t begin, size_t end, std::vector<XrefEntry>& out)
+{
+    static constexpr OpcodeID OpAddis = InstructionRegistry::FindOpcode("addis");
+    static constexpr OpcodeID OpAddi = InstructionRegistry::FindOpcode("addi");
+    static constexpr OpcodeID OpOri = InstructionRegistry::FindOpcode("ori");
+
+    for (size_t i = begin; i < end; i++)
+    {
+        OpcodeID opcode = code.m_opcodes[i];
+        uint32_t word = code.m_words[i];
+        uint32_t source = code.m_address + (uint32_t)i * 4;
+
+        if (InstructionRegistry::IsDirectBranch(opcode))
+        {
+            uint16_t flags = code.m_flags[i];
+            XrefIndex::Kind kind = (flags & INSTR_LINK) ? XrefIndex::XREF_CALL
+                : (flags & INSTR_CONDITIONAL) ? XrefIndex::XREF_CONDITIONAL : XrefIndex::XREF_BRANCH;
+            out.push_back({ InstructionRegistry::GetBranchTarget(opcode, word, source), source, kind });
+            continue;
+        }
+
+        // lis rD, hi followed by addi rX, rD, lo or ori rX, rD, lo before any branch or other lis of rD
+        if (opcode != OpAddis || Operands<FORM_D>::decode(word).A != 0)
+            continue;
+        uint32_t reg = Operands<FORM_D>::decode(word).D;
+        uint32_t high = word << 16;
+        size_t last = std::min(code.m_count, i + 1 + XrefAddressWindow);
+        for (size_t j = i + 1; j < last && !(code.m_flags[j] & INSTR_BRANCH); j++)
+        {
+            Operands<FORM_D> op = Operands<FORM_D>::decode(code.m_words[j]);
+            if (code.m_opcodes[j] == OpAddi && op.A == reg)
+            {
+                out.push_back({ high + (uint32_t)op.SIMM, source, XrefIndex::XREF_ADDRESS });
+                break;
+            }
+            // ori has its source register in the D field
+            if (code.m_opcodes[j] == OpOri && op.D == reg)
+            {
+                out.push_back({ high | op.UIMM, source, XrefIndex::XREF_ADDRESS });
+                break;
+            }
+            if (code.m_opcodes[j] == OpAddis && op.D == reg)
+                break;
+        }
+    }
+}
+
+// Decode <count> words at <src> into <code>, the section is split by address range over the global ThreadPool
+// words that aren't known instructions stay OPCODE_INVALID and are counted in <unknown> when given
+// once every chunk is decoded a second pass collects the references of the section into <xrefs> (unsorted) when given
+static void DecodeSection(const uint8_t* src, size_t count, CodeSection& code, UnknownOpcodeHistogram* unknown = nullptr,
+    std::vector<XrefEntry>* xrefs = nullptr)
+{
+    code.m_count = count;
+    code.m_opcodes.resize(count);
+    code.m_words.resize(count);
+    code.m_valid.resize((count + 63) / 64);
+    code.m_flags.resize(count);
+    uint64_t* flagBits[INSTR_FLAG_COUNT];
+    for (uint32_t bit = 0; bit < INSTR_FLAG_COUNT; bit++)
+    {
+        code.m_flagBits[bit].resize((count + 63) / 64);
+        flagBits[bit] = code.m_flagBits[bit].data();
+    }
+
+    size_t chunkSize = DecodeChunkSize(count);
+    size_t chunks = (count + chunkSize - 1) / chunkSize;
+    std::vector<UnknownOpcodeHistogram> chunkUnknown(unknown ? chunks : 0);
+    ThreadPool::global().parallelFor(chunks, [&](size_t chunk)
+    {
+        size_t begin = chunk * chunkSize;
+        size_t size = std::min(chunkSize, count - begin);
+        InstructionRegistry::DecodeRange(src + begin * 4, size, code.m_opcodes.data() + begin, code.m_words.data() + begin,
+            code.m_valid.data() + begin / 64);
+
+        uint64_t* chunkBits[INSTR_FLAG_COUNT];
+        for (uint32_t bit = 0; bit < INSTR_FLAG_COUNT; bit++)
+        {
+            chunkBits[bit] = flagBits[bit] + begin / 64;
+        }
+        InstructionRegistry::ClassifyRange(code.m_opcodes.data() + begin, code.m_words.data() + begin, size,
+            code.m_flags.data() + begin, chunkBits);
+
+        if (unknown)
+        {
+            InstructionRegistry::CountUnknown(code.m_words.data() + begin, code.m_valid.data() + begin / 64, size, chunkUnknown[chunk]);
+        }
+    });
+
+    for (const UnknownOpcodeHistogram& histogram : chunkUnknown)
+    {
+        unknown->merge(histogram);
+    }
+
+    if (xrefs)
+    {
+        // lis / addi pairs may straddle two chunks, so this can't run in the decode tasks
+        std::vector<std::vector<XrefEntry>> chunkXrefs(chunks);
+        ThreadPool::global().parallelFor(chunks, [&](size_t chunk)
+        {
+            size_t begin = chunk * chunkSize;
+            CollectXrefs(code, begin, std::min(begin + chunkSize, count), chunkXrefs[chunk]);
+        });
+        for (const std::vector<XrefEntry>& entries : chunkXrefs)
+        {
+            xrefs->insert(xrefs->end(), entries.begin(), entries.end());
+        }
+    }
+}
+
+// Sort the references of every code section into <index>, address references that don't land in a code section are dropped
+static void BuildXrefIndex(std::vector<XrefEntry>& entries, const std::vector<CodeSection>& code, XrefIndex& index)
+{
+    auto inCode = [&](uint32_t address)
+    {
+        for (const CodeSection& section : code)
+        {
+            if (section.contains(address))
+                return true;
+        }
+        return false;
+    };
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [&](const XrefEntry& entry)
+    {
+        return entry.kind == XrefIndex::XREF_ADDRESS && ((entry.target & 3) != 0 || !inCode(entry.target));
+    }), entries.end());
+    std::sort(entries.begin(), entries.end());
+
+    index.m_targets.resize(entries.size());
+    index.m_sources.resize(entries.size());
+    index.m_kinds.resize(entries.size());
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        index.m_targets[i] = entries[i].target;
+        index.m_sources[i] = entries[i].source;
+        index.m_kinds[i] = entries[i].kind;
+    }
+}
+
+// decoder coverage of <totalWords> and the most frequent unknown opcodes of <unknown>, at most <limit> lines
+static void LogUnknownOpcodes(const UnknownOpcodeHistogram& unknown, size_t totalWords, size_t limit)
+{
+    std::vector<std::pair<uint32_t, uint32_t>> entries = unknown.sorted();
+    LOG_INFO("PBinaryHandle::AttachImage", "Decoder coverage %.2f%%, %zu of %zu words skipped, %zu unknown opcodes",
+        100.0 * (totalWords - unknown.m_total) / totalWords, unknown.m_total, totalWords, entries.size());
+    for (size_t i = 0; i < entries.size() && i < limit; i++)
+    {
+        char name[32];
+        UnknownOpcodeHistogram::formatKey(entries[i].first, name, sizeof(name));
+        LOG_DEBUG("PBinaryHandle::AttachImage", "    %-20s %8u words", name, entries[i].second);
+    }
+    if (entries.size() > limit)
+    {
+        LOG_DEBUG("PBinaryHandle::AttachImage", "    ... %zu more unknown opcodes", entries.size() - limit);
+    }
+}
+
+void PBinaryHandle::AttachImage(std::shared_ptr<XLoader::IImage> bin)
+{
+    this->m_image = bin;
+    this->m_contentHash = bin->getContentHash().toString();
+    // the offset only becomes a constant of the translated code when every process gets the same one, a window that fell
+    // back to another address differs from run to run
+    this->m_guestBase = 0;
+    if (bin->getGuestBase() != nullptr && XLoader::GuestWindow::get()->isAtPreferredBase())
+    {
+        this->m_guestBase = (uint64_t)bin->getGuestBase();
+    }
+    if (this->m_guestBase == 0)
+    {
+        LOG_WARNING("PBinaryHandle::AttachImage", "Image is not at its preferred guest address, translated code will read moduleBase at runtime");
+    }
     if (this->m_type == BIN_UNKNOWN) {
         if (dynamic_cast<XLoader::XEXImage*>(bin.get()) != nullptr){
             this->m_type = BIN_XEX;
@@ -104,12 +323,17 @@ void PBinaryHandle::LoadBinary()
             this->m_type = BIN_PE;
         }
         else{
-            LOG_ERROR("PBinaryHandle::LoadBinary", "Unknown binary type");
+            LOG_ERROR("PBinaryHandle::AttachImage", "Unknown binary type");
             return;
         }
     }
 
 
+    // unknown words of every decoded section, reported once at the end
+    UnknownOpcodeHistogram unknown;
+    size_t totalWords = 0;
+    std::vector<XrefEntry> xrefs;
+
     for(const auto& sec : bin->getSections())
     {
         
@@ -142,24 +366,78 @@ void PBinaryHandle::LoadBinary()
         
        
 
-        const uint8_t* secDataPtr = (const uint8_t*)bin->getMemoryData() + (virtualAddr);
-	    uint32_t address = start;
+        // lazy images only build the pages of the sections that are asked for
+        const uint8_t* secDataPtr = bin->getSectionData(*sec);
+        if (secDataPtr == nullptr)
+        {
+            LOG_ERROR("PBinaryHandle::AttachImage", "Section %s is outside the image", sec->getName().c_str());
+            continue;
+        }
+        CodeSection& code = this->m_code.emplace_back();
+        code.m_name = sec->getName();
+        code.m_address = start;
+
+        UnknownOpcodeHistogram sectionUnknown;
+        auto decodeStart = std::chrono::steady_clock::now();
+        DecodeSection(secDataPtr, (end - start) / 4, code, &sectionUnknown, &xrefs);
+        double decodeNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - decodeStart).count();
+        size_t count = code.m_count;
+        code.m_unknownCount = sectionUnknown.m_total;
+        totalWords += count;
+        unknown.merge(sectionUnknown);
 
-        InstructionRegistry& registry = g_instrRegistry;
-        while (address <= end)
+        if (sectionUnknown.m_total > 0)
         {
-            // get and byteswap
-            uint32_t data = __bswap_32( (uint32_t) * (uint32_t*)(secDataPtr + (address - start)) );
-            Instruction instruction = registry.DecodeInstr(data, address);
-            //if (instructionSize == 0)
-            //{
-		    //    LOG_ERROR("PBinaryHandle::LoadBinary", "Failed to decode instruction at %08X", address);
-            //    break;
-            //}
-            //this->m_binInstr.push_back(instruction);
-             
-            address += 4;
+            LOG_WARNING("PBinaryHandle::AttachImage", "%zu words of %s are not known instructions, skipped", sectionUnknown.m_total, sec->getName().c_str());
         }
+        LOG_INFO("PBinaryHandle::AttachImage", "Decoded %zu instructions of %s in %.2f ms (%.2f ns/instruction)",
+            count, sec->getName().c_str(), decodeNs / 1e6, decodeNs / (count ? count : 1));
+
+        auto population = [](const std::vector<uint64_t>& bits)
+        {
+            size_t total = 0;
+            for (uint64_t word : bits)
+            {
+                total += std::popcount(word);
+            }
+            return total;
+        };
+        LOG_DEBUG("PBinaryHandle::AttachImage", "%s: %zu branches (%zu indirect), %zu loads, %zu stores",
+            sec->getName().c_str(), population(code.m_flagBits[std::countr_zero(INSTR_BRANCH)]),
+            population(code.m_flagBits[std::countr_zero(INSTR_INDIRECT)]),
+            population(code.m_flagBits[std::countr_zero(INSTR_LOAD)]), population(code.m_flagBits[std::countr_zero(INSTR_STORE)]));
+    }
+
+    BuildXrefIndex(xrefs, this->m_code, this->m_xrefs);
+    LOG_DEBUG("PBinaryHandle::AttachImage", "Cross reference index: %zu references", this->m_xrefs.size());
+
+    // exact function bounds from .pdata, most retail images have an entry for nearly every function
+    auto functionsStart = std::chrono::steady_clock::now();
+    const std::vector<XLoader::FunctionEntry>& functions = bin->getFunctions();
+    LOG_INFO("PBinaryHandle::AttachImage", "%zu functions from .pdata in %.2f ms", functions.size(),
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - functionsStart).count());
+
+    // the function table is finished here, emission only looks functions up
+    std::vector<Function> seeds;
+    seeds.push_back({ bin->getEntryPoint(), 0, Function::FUNCTION_ENTRY });
+    for (uint32_t address : bin->getExports())
+    {
+        seeds.push_back({ address, 0, Function::FUNCTION_EXPORT });
+    }
+    for (const XLoader::FunctionEntry& entry : functions)
+    {
+        seeds.push_back({ entry.address, entry.getEnd(), Function::FUNCTION_PDATA });
+    }
+    auto discoveryStart = std::chrono::steady_clock::now();
+    Analysis::DiscoveryStats discovery = Analysis::DiscoverFunctions(this->m_code, this->m_xrefs, std::move(seeds), this->m_functions);
+    LOG_INFO("PBinaryHandle::AttachImage", "%zu functions (%zu seeds, %zu found through calls) in %.2f ms, %zu rounds, %zu instructions walked",
+        this->m_functions.size(), discovery.seeds, discovery.discovered,
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - discoveryStart).count(),
+        discovery.rounds, discovery.instructions);
+
+    if (unknown.m_total > 0)
+    {
+        LogUnknownOpcodes(unknown, totalWords, 16);
     }
 }
 
@@ -185,14 +463,196 @@ PBinaryHandle* TranslateBinary(std::wstring path, bool useCache, bool isKernel)
         return handle;
     }
 
-	LOG_ERROR("TranslateBinary", "Caching NYI");
     // the cache is very simple in practice, it's just a way to store already recompiled modules, 
     // it doesn't matter where they are located 
 	// so all cached binaries will be located in ./cache/<hash>
+    // the loader hashes the file before decompressing anything, so a hit costs one pass over the file
+    bool cached = false;
+    XLoader::LoadOptions options;
+    options.useGuestWindow = true;
+    options.lazy = true;
+    options.cacheLookup = [&](const XLoader::Hash128& hash)
+    {
+        handle->m_contentHash = hash.toString();
+        std::error_code error;
+        cached = std::filesystem::exists(std::filesystem::path("cache") / handle->m_contentHash, error);
+        return cached;
+    };
 
+    std::shared_ptr<XLoader::IImage> bin = XLoader::ImageLoader::load(path, options);
+    if (cached)
+    {
+        LOG_INFO("TranslateBinary", "Using cached translation ./cache/%s", handle->m_contentHash.c_str());
+        return handle;
+    }
+    if (bin == nullptr)
+    {
+        LOG_ERROR("TranslateBinary", "Failed to load binary image");
+        return handle;
+    }
+
+    handle->AttachImage(bin);
+    handle->RecompileBinary();
 	return handle;
 }
 
+std::vector<PBinaryHandle*> TranslateBinaries(std::vector<std::wstring> paths)
+{
+    XLoader::LoadOptions options;
+    options.useGuestWindow = true;
+    options.lazy = true;
+
+    double batchMs = 0.0;
+    std::vector<XLoader::BatchLoadResult> results = XLoader::ImageLoader::loadBatch(paths, options, &batchMs);
+
+    std::vector<PBinaryHandle*> handles;
+    double sumMs = 0.0;
+    for (XLoader::BatchLoadResult& result : results)
+    {
+        PBinaryHandle* handle = new PBinaryHandle();
+        handle->m_imagePath = result.path;
+        handle->m_type = BIN_UNKNOWN;
+        handle->m_ID = -1;
+        sumMs += result.loadMs;
+
+        if (result.image == nullptr)
+        {
+            LOG_ERROR("TranslateBinaries", "Failed to load %ls", result.path.c_str());
+        }
+        else
+        {
+            LOG_INFO("TranslateBinaries", "%ls: %.2f ms", result.path.c_str(), result.loadMs);
+            handle->AttachImage(std::move(result.image));
+            handle->RecompileBinary();
+        }
+        handles.push_back(handle);
+    }
+
+    LOG_INFO("TranslateBinaries", "loaded %zu images in %.2f ms (%.2f ms one after the other)", results.size(), batchMs, sumMs);
+    return handles;
+}
+
+void BenchmarkLoader(std::wstring path, int iterations, bool verifyDigests)
+{
+    XLoader::LoadOptions options;
+    options.verifyDigests = verifyDigests;
+
+    double bestMs = 0.0;
+    double totalMs = 0.0;
+    size_t payloadSize = 0;
+    size_t imageSize = 0;
+
+    for (int i = 0; i < iterations; i++)
+    {
+        auto bin = XLoader::ImageLoader::load(path, options);
+        if (bin == nullptr)
+        {
+            LOG_ERROR("BenchmarkLoader", "Failed to load binary image");
+            return;
+        }
+
+        const XLoader::LoadStats& stats = bin->getLoadStats();
+        payloadSize = stats.payloadSize;
+        imageSize = stats.imageSize;
+        totalMs += stats.decompressMs;
+        if (i == 0 || stats.decompressMs < bestMs)
+        {
+            bestMs = stats.decompressMs;
+        }
+
+        LOG_INFO("BenchmarkLoader", "run %d: load %.2f ms, decompress %.2f ms (%.1f MB/s in, %.1f MB/s out)",
+            i, stats.totalMs, stats.decompressMs,
+            payloadSize / 1048576.0 / (stats.decompressMs / 1000.0),
+            imageSize / 1048576.0 / (stats.decompressMs / 1000.0));
+        LOG_INFO("BenchmarkLoader", "run %d: content hash %.2f ms (%.1f MB/s) %s",
+            i, stats.hashMs, stats.fileSize / 1048576.0 / (stats.hashMs / 1000.0), bin->getContentHash().toString().c_str());
+        if (stats.verifiedBytes > 0 || stats.digestMismatches > 0)
+        {
+            LOG_INFO("BenchmarkLoader", "run %d: verify %.2f ms/MB (%.2f ms cpu), %.2f ms after decompression, %s",
+                i, stats.verifyCpuMs / (imageSize / 1048576.0), stats.verifyCpuMs, stats.verifyWaitMs,
+                bin->isVerified() ? "all digests match" : "DIGEST MISMATCH");
+        }
+    }
+
+    if (iterations > 0)
+    {
+        LOG_INFO("BenchmarkLoader", "%zu bytes -> %zu bytes, best %.2f ms (%.1f MB/s out), average %.2f ms",
+            payloadSize, imageSize, bestMs, imageSize / 1048576.0 / (bestMs / 1000.0), totalMs / iterations);
+    }
+}
+
+void BenchmarkDecoder(std::wstring path, int iterations)
+{
+    PBinaryHandle* handle = new PBinaryHandle();
+    handle->m_imagePath = path;
+    handle->m_type = BIN_UNKNOWN;
+    handle->m_ID = -1;
+    handle->LoadBinary();
+    if (handle->m_code.empty())
+    {
+        LOG_ERROR("BenchmarkDecoder", "Nothing was decoded");
+        delete handle;
+        return;
+    }
+
+    for (const CodeSection& code : handle->m_code)
+    {
+        const XLoader::Section* sec = nullptr;
+        for (const auto& candidate : handle->m_image->getSections())
+        {
+            if (candidate->getName() == code.m_name)
+            {
+                sec = candidate.get();
+            }
+        }
+        const uint8_t* src = sec ? handle->m_image->getSectionData(*sec) : nullptr;
+        if (src == nullptr)
+        {
+            continue;
+        }
+        size_t count = code.m_count;
+        CodeSection out;
+
+        // best of <iterations> for every path, the outputs must match what AttachImage produced
+        const char* names[3] = { "scalar", InstructionRegistry::IsDecodeAccelerated() ? "AVX2" : "batch (scalar)", "parallel" };
+        double bestMs[3] = { 0.0, 0.0, 0.0 };
+        for (int mode = 0; mode < 3; mode++)
+        {
+            out.m_opcodes.assign(count, 0);
+            out.m_words.assign(count, 0);
+            for (int i = 0; i < iterations; i++)
+            {
+                auto start = std::chrono::steady_clock::now();
+                if (mode == 0)
+                    InstructionRegistry::DecodeRangeScalar(src, count, out.m_opcodes.data(), out.m_words.data());
+                else if (mode == 1)
+                    InstructionRegistry::DecodeRange(src, count, out.m_opcodes.data(), out.m_words.data());
+                else
+                    DecodeSection(src, count, out);
+                double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                if (i == 0 || ms < bestMs[mode])
+                {
+                    bestMs[mode] = ms;
+                }
+            }
+            if (out.m_opcodes != code.m_opcodes || out.m_words != code.m_words || (mode == 2 && (out.m_valid != code.m_valid || out.m_flags != code.m_flags)))
+            {
+                LOG_ERROR("BenchmarkDecoder", "%s: %s output differs", code.m_name.c_str(), names[mode]);
+            }
+        }
+
+        double mb = count * 4 / 1048576.0;
+        LOG_INFO("BenchmarkDecoder", "%s: %zu instructions, scalar %.3f ms (%.0f MB/s), %s %.3f ms (%.0f MB/s), %.1fx",
+            code.m_name.c_str(), count, bestMs[0], mb / (bestMs[0] / 1000.0),
+            names[1], bestMs[1], mb / (bestMs[1] / 1000.0), bestMs[0] / bestMs[1]);
+        size_t chunkSize = DecodeChunkSize(count);
+        LOG_INFO("BenchmarkDecoder", "%s: parallel on %zu threads (%zu tasks of %zu words) %.3f ms (%.0f MB/s), %.1fx over %s",
+            code.m_name.c_str(), ThreadPool::global().getConcurrency(), (count + chunkSize - 1) / chunkSize, chunkSize,
+            bestMs[2], mb / (bestMs[2] / 1000.0), bestMs[1] / bestMs[2], names[1]);
+    }
+    delete handle;
+}
+
 int main(int argc, char* argv[])
 {
    
@@ -0,0 +1,217 @@
+#include "AESDecryptor.h"
+#include "AES.h"
+#include "CpuFeatures.h"
+#include <cstring>
+
+namespace XLoader
+{
+    //
+    // AES-NI / VAES kernels
+    //
+
+#if HOST_X86
+    TARGET_ATTR("aes,sse2")
+    static inline __m128i expandKeyStep(__m128i key, __m128i assist) {
+        assist = _mm_shuffle_epi32(assist, _MM_SHUFFLE(3, 3, 3, 3));
+        key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+        key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+        key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+        return _mm_xor_si128(key, assist);
+    }
+
+    TARGET_ATTR("aes,sse2")
+    static void expandDecryptKeyNI(const uint8_t key[16], uint8_t dk[11][16]) {
+        __m128i ek[11];
+        ek[0] = _mm_loadu_si128((const __m128i*)key);
+        ek[1] = expandKeyStep(ek[0], _mm_aeskeygenassist_si128(ek[0], 0x01));
+        ek[2] = expandKeyStep(ek[1], _mm_aeskeygenassist_si128(ek[1], 0x02));
+        ek[3] = expandKeyStep(ek[2], _mm_aeskeygenassist_si128(ek[2], 0x04));
+        ek[4] = expandKeyStep(ek[3], _mm_aeskeygenassist_si128(ek[3], 0x08));
+        ek[5] = expandKeyStep(ek[4], _mm_aeskeygenassist_si128(ek[4], 0x10));
+        ek[6] = expandKeyStep(ek[5], _mm_aeskeygenassist_si128(ek[5], 0x20));
+        ek[7] = expandKeyStep(ek[6], _mm_aeskeygenassist_si128(ek[6], 0x40));
+        ek[8] = expandKeyStep(ek[7], _mm_aeskeygenassist_si128(ek[7], 0x80));
+        ek[9] = expandKeyStep(ek[8], _mm_aeskeygenassist_si128(ek[8], 0x1B));
+        ek[10] = expandKeyStep(ek[9], _mm_aeskeygenassist_si128(ek[9], 0x36));
+
+        // equivalent inverse cipher: reversed order, InvMixColumns on the middle rounds
+        _mm_store_si128((__m128i*)dk[0], ek[10]);
+        for (int i = 1; i < 10; i++) {
+            _mm_store_si128((__m128i*)dk[i], _mm_aesimc_si128(ek[10 - i]));
+        }
+        _mm_store_si128((__m128i*)dk[10], ek[0]);
+    }
+
+    TARGET_ATTR("aes,sse2")
+    static inline __m128i decryptBlockNI(__m128i x, const __m128i* rk) {
+        x = _mm_xor_si128(x, rk[0]);
+        for (int r = 1; r < 10; r++) {
+            x = _mm_aesdec_si128(x, rk[r]);
+        }
+        return _mm_aesdeclast_si128(x, rk[10]);
+    }
+
+    TARGET_ATTR("aes,sse2")
+    static void decryptECB_NI(const uint8_t dk[11][16], const uint8_t* src, uint8_t* dst, size_t blocks) {
+        __m128i rk[11];
+        for (int i = 0; i < 11; i++) {
+            rk[i] = _mm_load_si128((const __m128i*)dk[i]);
+        }
+        for (size_t i = 0; i < blocks; i++) {
+            __m128i x = _mm_loadu_si128((const __m128i*)(src + i * 16));
+            _mm_storeu_si128((__m128i*)(dst + i * 16), decryptBlockNI(x, rk));
+        }
+    }
+
+    // CBC decryption has no dependency between blocks, 8 blocks are kept in flight to hide aesdec latency
+    TARGET_ATTR("aes,sse2")
+    static void decryptCBC_NI(const uint8_t dk[11][16], const uint8_t* src, uint8_t* dst, size_t blocks, uint8_t iv[16]) {
+        __m128i rk[11];
+        for (int i = 0; i < 11; i++) {
+            rk[i] = _mm_load_si128((const __m128i*)dk[i]);
+        }
+        __m128i prev = _mm_loadu_si128((const __m128i*)iv);
+
+        size_t i = 0;
+        for (; i + 8 <= blocks; i += 8) {
+            const __m128i* in = (const __m128i*)(src + i * 16);
+            __m128i c[8], x[8];
+            for (int j = 0; j < 8; j++) {
+                c[j] = _mm_loadu_si128(in + j);
+                x[j] = _mm_xor_si128(c[j], rk[0]);
+            }
+            for (int r = 1; r < 10; r++) {
+                for (int j = 0; j < 8; j++) {
+                    x[j] = _mm_aesdec_si128(x[j], rk[r]);
+                }
+            }
+            for (int j = 0; j < 8; j++) {
+                x[j] = _mm_aesdeclast_si128(x[j], rk[10]);
+            }
+
+            __m128i* out = (__m128i*)(dst + i * 16);
+            _mm_storeu_si128(out, _mm_xor_si128(x[0], prev));
+            for (int j = 1; j < 8; j++) {
+                _mm_storeu_si128(out + j, _mm_xor_si128(x[j], c[j - 1]));
+            }
+            prev = c[7];
+        }
+
+        for (; i < blocks; i++) {
+            __m128i c = _mm_loadu_si128((const __m128i*)(src + i * 16));
+            __m128i x = decryptBlockNI(c, rk);
+            _mm_storeu_si128((__m128i*)(dst + i * 16), _mm_xor_si128(x, prev));
+            prev = c;
+        }
+
+        _mm_storeu_si128((__m128i*)iv, prev);
+    }
+
+    // VAES: two blocks per ymm register, 8 blocks per iteration
+    TARGET_ATTR("vaes,avx2,aes")
+    static void decryptCBC_VAES(const uint8_t dk[11][16], const uint8_t* src, uint8_t* dst, size_t blocks, uint8_t iv[16]) {
+        __m256i rk[11];
+        for (int i = 0; i < 11; i++) {
+            rk[i] = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)dk[i]));
+        }
+        __m128i prev = _mm_loadu_si128((const __m128i*)iv);
+
+        size_t i = 0;
+        for (; i + 8 <= blocks; i += 8) {
+            const uint8_t* in = src + i * 16;
+            __m256i c[4], p[4], x[4];
+            for (int j = 0; j < 4; j++) {
+                c[j] = _mm256_loadu_si256((const __m256i*)(in + j * 32));
+            }
+            // previous ciphertext of each lane, loaded before anything is stored so in-place works
+            p[0] = _mm256_inserti128_si256(_mm256_castsi128_si256(prev), _mm256_castsi256_si128(c[0]), 1);
+            for (int j = 1; j < 4; j++) {
+                p[j] = _mm256_loadu_si256((const __m256i*)(in + j * 32 - 16));
+            }
+            prev = _mm256_extracti128_si256(c[3], 1);
+
+            for (int j = 0; j < 4; j++) {
+                x[j] = _mm256_xor_si256(c[j], rk[0]);
+            }
+            for (int r = 1; r < 10; r++) {
+                for (int j = 0; j < 4; j++) {
+                    x[j] = _mm256_aesdec_epi128(x[j], rk[r]);
+                }
+            }
+            for (int j = 0; j < 4; j++) {
+                x[j] = _mm256_aesdeclast_epi128(x[j], rk[10]);
+                _mm256_storeu_si256((__m256i*)(dst + i * 16 + j * 32), _mm256_xor_si256(x[j], p[j]));
+            }
+        }
+
+        _mm_storeu_si128((__m128i*)iv, prev);
+        if (i < blocks) {
+            decryptCBC_NI(dk, src + i * 16, dst + i * 16, blocks - i, iv);
+        }
+    }
+#endif
+
+
+    //
+    // AESDecryptor
+    //
+
+    AESDecryptor::AESDecryptor(const uint8_t key[16]) {
+        m_kernel = Kernel::Portable;
+        m_rounds = rijndaelKeySetupDec(m_rk, key, 128);
+        memset(m_dk, 0, sizeof(m_dk));
+
+#if HOST_X86
+        const CpuFeatures& cpu = CpuFeatures::get();
+        if (cpu.aes) {
+            expandDecryptKeyNI(key, m_dk);
+            m_kernel = cpu.vaes ? Kernel::VAES : Kernel::AESNI;
+        }
+#endif
+    }
+
+    const char* AESDecryptor::getKernelName(Kernel kernel) {
+        switch (kernel) {
+        case Kernel::AESNI: return "AES-NI";
+        case Kernel::VAES: return "VAES";
+        default: return "portable";
+        }
+    }
+
+    void AESDecryptor::decryptECB(const uint8_t* src, uint8_t* dst, size_t blocks) const {
+#if HOST_X86
+        if (m_kernel != Kernel::Portable) {
+            decryptECB_NI(m_dk, src, dst, blocks);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < blocks; i++) {
+            rijndaelDecrypt(m_rk, m_rounds, src + i * 16, dst + i * 16);
+        }
+    }
+
+    void AESDecryptor::decryptCBC(const uint8_t* src, uint8_t* dst, size_t size, uint8_t iv[16]) const {
+        size_t blocks = size / 16;
+
+#if HOST_X86
+        if (m_kernel == Kernel::VAES) {
+            decryptCBC_VAES(m_dk, src, dst, blocks, iv);
+            return;
+        }
+        if (m_kernel == Kernel::AESNI) {
+            decryptCBC_NI(m_dk, src, dst, blocks, iv);
+            return;
+        }
+#endif
+
+        uint8_t cipher[16];
+        for (size_t i = 0; i < blocks; i++) {
+            memcpy(cipher, src + i * 16, 16);
+            rijndaelDecrypt(m_rk, m_rounds, cipher, dst + i * 16);
+            for (int j = 0; j < 16; j++) {
+                dst[i * 16 + j] ^= iv[j];
+            }
+            memcpy(iv, cipher, 16);
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+namespace XLoader
+{
+    // AES-128 decryption as used by XEX2 (ECB for the session key, CBC for the image payload)
+    // picks a VAES / AES-NI kernel at runtime and falls back to the rijndael tables in AES.cpp
+    class AESDecryptor {
+    public:
+        enum class Kernel {
+            Portable,
+            AESNI,
+            VAES
+        };
+
+        explicit AESDecryptor(const uint8_t key[16]);
+
+        // decrypt <blocks> independent 16 byte blocks
+        void decryptECB(const uint8_t* src, uint8_t* dst, size_t blocks) const;
+
+        // decrypt <size> bytes (multiple of 16) in CBC mode, <src> and <dst> may be the same buffer
+        // <iv> is updated with the last ciphertext block, so consecutive calls continue the same chain
+        void decryptCBC(const uint8_t* src, uint8_t* dst, size_t size, uint8_t iv[16]) const;
+
+        Kernel getKernel() const { return m_kernel; }
+        static const char* getKernelName(Kernel kernel);
+
+    private:
+        Kernel m_kernel;
+
+        // rijndael decryption schedule (portable path)
+        uint32_t m_rk[44];
+        int m_rounds;
+
+        // AES-NI decryption schedule, round 0 is the last encryption round key
+        alignas(16) uint8_t m_dk[11][16];
+    };
+}
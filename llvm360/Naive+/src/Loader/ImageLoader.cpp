@@ -1,13 +1,20 @@
 #include "ImageLoader.h"
 #include "PEImage.h"
 #include "XEXImage.h"
-#include <fstream>
+#include "MappedFile.h"
+#include "XISO/XISOReader.h"
+#include "AES/AESDecryptor.h"
+#include "LZX/LZXDecoder.h"
+#include "SHA1/SHA1.h"
+#include "ThreadPool.h"
+#include "table/ImportTable.h"
 #include <memory>
 #include <cstring>
-#ifndef _WIN32
-#include <locale>
-#include <codecvt>
-#endif
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 namespace XLoader
 {
@@ -48,34 +55,154 @@ namespace XLoader
         size_t m_offset;
     };
 
+    static double elapsedMs(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Commit <size> bytes for an image, at <guestAddress> inside the guest window when asked to
+    // an image that can't be placed (no window, overlapping another image) still loads, just not at its real address
+    static bool allocateImageMemory(ImageMemory& memory, size_t size, uint32_t guestAddress, bool useGuestWindow) {
+        if (useGuestWindow) {
+            GuestWindow* window = GuestWindow::get();
+            if (window && memory.allocateAt(*window, guestAddress, size)) {
+                printf("  Placed at guest 0x%08X (host %p)\n", guestAddress, (void*)memory.data());
+                return true;
+            }
+            printf("  Could not place the image at guest 0x%08X, using a private allocation\n", guestAddress);
+        }
+        return memory.allocate(size);
+    }
+
+    // IImage implementation
+    const std::vector<FunctionEntry>& IImage::getFunctions() {
+        std::call_once(m_functionsOnce, [this]() { loadFunctionTable(); });
+        return m_functions;
+    }
+
+    const FunctionEntry* IImage::findFunction(uint32_t address) {
+        const std::vector<FunctionEntry>& functions = getFunctions();
+        auto it = std::upper_bound(functions.begin(), functions.end(), address,
+            [](uint32_t addr, const FunctionEntry& entry) { return addr < entry.address; });
+        if (it == functions.begin() || !(it - 1)->contains(address)) {
+            return nullptr;
+        }
+        return &*(it - 1);
+    }
+
+    const std::vector<uint32_t>& IImage::getExports() {
+        std::call_once(m_exportsOnce, [this]() { loadExports(); });
+        return m_exports;
+    }
+
+    // .pdata is an array of big endian { begin address, packed lengths } records, the packed word holds
+    // the prolog length (bits 0-7), the function length in instructions (bits 8-29), a 32 bit flag and an exception flag
+    void IImage::loadFunctionTable() {
+        const Section* pdata = nullptr;
+        for (const auto& section : getSections()) {
+            if (section->getName() == ".pdata") {
+                pdata = section.get();
+                break;
+            }
+        }
+        if (!pdata) {
+            return;
+        }
+
+        const uint8_t* data = getSectionData(*pdata);
+        if (!data) {
+            printf("  .pdata is outside the image\n");
+            return;
+        }
+
+        uint32_t base = getBaseAddress();
+        auto inCode = [&](uint32_t address, uint32_t size) {
+            for (const auto& section : getSections()) {
+                uint32_t start = base + section->getVirtualAddress();
+                if (section->isExecutable() && address >= start && address - start <= section->getVirtualSize()
+                    && size <= section->getVirtualSize() - (address - start)) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        size_t count = pdata->getVirtualSize() / 8;
+        size_t rejected = 0;
+        m_functions.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            const uint8_t* record = data + i * 8;
+            uint32_t begin = ((uint32_t)record[0] << 24) | ((uint32_t)record[1] << 16) | ((uint32_t)record[2] << 8) | record[3];
+            uint32_t packed = ((uint32_t)record[4] << 24) | ((uint32_t)record[5] << 16) | ((uint32_t)record[6] << 8) | record[7];
+            if (begin == 0 && packed == 0) {
+                continue;   // the table is zero padded to the section size
+            }
+
+            FunctionEntry entry;
+            entry.address = begin;
+            entry.size = ((packed >> 8) & 0x3FFFFF) * 4;
+            entry.prologSize = packed & 0xFF;
+            entry.hasHandler = (packed >> 31) != 0;
+            if (entry.size == 0 || (begin & 3) != 0 || !inCode(begin, entry.size)) {
+                rejected++;
+                continue;
+            }
+            m_functions.push_back(entry);
+        }
+
+        // the linker emits the table sorted, this only costs a pass when it is
+        auto byAddress = [](const FunctionEntry& a, const FunctionEntry& b) { return a.address < b.address; };
+        if (!std::is_sorted(m_functions.begin(), m_functions.end(), byAddress)) {
+            std::sort(m_functions.begin(), m_functions.end(), byAddress);
+        }
+        m_functions.erase(std::unique(m_functions.begin(), m_functions.end(),
+            [](const FunctionEntry& a, const FunctionEntry& b) { return a.address == b.address; }), m_functions.end());
+
+        printf("  .pdata: %zu functions (%zu records rejected)\n", m_functions.size(), rejected);
+    }
+
     // ImageLoader implementation
-    std::unique_ptr<IImage> ImageLoader::load(const std::wstring& path) {
-        // Open file
-        #ifdef _WIN32
-        std::ifstream file(path, std::ios::binary | std::ios::ate);
-        #else
-        std::ifstream file(std::wstring_convert<std::codecvt_utf8<wchar_t>>().to_bytes(path), std::ios::binary | std::ios::ate);
-        #endif
-        if (!file.is_open()) {
+    std::unique_ptr<IImage> ImageLoader::load(const std::wstring& path, const LoadOptions& options) {
+        // Map the file, nothing is read until the headers are parsed
+        // and sections that can be used as they are on disk are mapped copy-on-write into the image
+        std::shared_ptr<MappedFile> file = MappedFile::open(path);
+        if (!file) {
             printf("Failed to open file\n");
             return nullptr;
         }
 
-        // Get file size
-        size_t fileSize = file.tellg();
-        file.seekg(0, std::ios::beg);
+        std::unique_ptr<IImage> image = loadFromMemory(file->data(), file->size(), file.get(), options);
+        if (image && options.lazy) {
+            image->m_file = file;
+        }
+        return image;
+    }
 
-        // Read file data
-        std::vector<uint8_t> buffer(fileSize);
-        if (!file.read(reinterpret_cast<char*>(buffer.data()), fileSize)) {
-            printf("Failed to read file\n");
+    std::unique_ptr<IImage> ImageLoader::loadFromContainer(const XISOReader& container, const std::string& innerPath, const LoadOptions& options) {
+        const XISOReader::Entry* entry = container.find(innerPath);
+        if (!entry || entry->isDirectory) {
+            printf("%s not found in container\n", innerPath.c_str());
             return nullptr;
         }
 
-        return loadFromMemory(buffer.data(), fileSize);
+        // the entry is a range of the container mapping, parsed in place like a loose file
+        const std::shared_ptr<const MappedFile>& file = container.getFile();
+        std::unique_ptr<IImage> image = loadFromMemory(container.getData(*entry), entry->size, file.get(), options);
+        if (image && options.lazy) {
+            image->m_file = file;
+        }
+        return image;
     }
 
-    std::unique_ptr<IImage> ImageLoader::loadFromMemory(const uint8_t* data, size_t size) {
+    std::unique_ptr<IImage> ImageLoader::loadFromMemory(const uint8_t* data, size_t size, const MappedFile* file, const LoadOptions& options) {
+        // fingerprint the raw file first, a cached translation makes everything after this unnecessary
+        auto hashStart = std::chrono::steady_clock::now();
+        Hash128 contentHash = XXH3::hash128(data, size);
+        double hashMs = elapsedMs(hashStart);
+        if (options.cacheLookup && options.cacheLookup(contentHash)) {
+            printf("Content hash %s is cached, skipping the load\n", contentHash.toString().c_str());
+            return nullptr;
+        }
+
         ImageType type = detectType(data, size);
 
         std::unique_ptr<IImage> image;
@@ -95,14 +222,63 @@ namespace XLoader
             return nullptr;
         }
 
-        if (!image->load(data, size)) {
+        if (!image->load(data, size, file, options)) {
             printf("Failed to load image\n");
             return nullptr;
         }
+        image->m_contentHash = contentHash;
+        image->m_stats.hashMs = hashMs;
+        image->m_stats.totalMs += hashMs;
 
         return image;
     }
 
+    std::vector<BatchLoadResult> ImageLoader::loadBatch(const std::vector<std::wstring>& paths, const LoadOptions& options, double* totalMs) {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<BatchLoadResult> results(paths.size());
+        std::vector<std::shared_ptr<MappedFile>> files(paths.size());
+        ThreadPool& pool = ThreadPool::global();
+
+        // mapping only touches the page tables, the sizes decide the order the images are loaded in
+        pool.parallelFor(paths.size(), [&](size_t i) {
+            auto openStart = std::chrono::steady_clock::now();
+            results[i].path = paths[i];
+            files[i] = MappedFile::open(paths[i]);
+            results[i].loadMs = elapsedMs(openStart);
+        });
+
+        // biggest first, so the longest load isn't the one left running alone at the end
+        std::vector<size_t> order(paths.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            size_t sizeA = files[a] ? files[a]->size() : 0;
+            size_t sizeB = files[b] ? files[b]->size() : 0;
+            return sizeA > sizeB;
+        });
+
+        pool.parallelFor(order.size(), [&](size_t n) {
+            size_t i = order[n];
+            if (!files[i]) {
+                printf("Failed to open file\n");
+                return;
+            }
+            auto loadStart = std::chrono::steady_clock::now();
+            results[i].image = loadFromMemory(files[i]->data(), files[i]->size(), files[i].get(), options);
+            results[i].loadMs += elapsedMs(loadStart);
+            if (results[i].image && options.lazy) {
+                results[i].image->m_file = files[i];
+            }
+            files[i].reset();
+        });
+
+        if (totalMs) {
+            *totalMs = elapsedMs(start);
+        }
+        return results;
+    }
+
     ImageType ImageLoader::detectType(const uint8_t* data, size_t size) {
         if (size < 4) {
             return ImageType::Unknown;
@@ -132,13 +308,14 @@ namespace XLoader
 
     // PE Image implementation
     PEImage::~PEImage() {
-        if (m_memoryData) {
-            delete[] m_memoryData;
-        }
     }
 
-    bool PEImage::load(const uint8_t* data, size_t size) {
+    bool PEImage::load(const uint8_t* data, size_t size, const MappedFile* file, const LoadOptions& options) {
         printf("Loading PE image...\n");
+        auto start = std::chrono::steady_clock::now();
+        m_stats = LoadStats();
+        m_stats.fileSize = size;
+        m_useGuestWindow = options.useGuestWindow;
 
         if (!loadHeaders(data, size)) {
             printf("Failed to load PE headers\n");
@@ -150,13 +327,22 @@ namespace XLoader
             return false;
         }
 
-        buildMemoryImage(data, size);
+        auto buildStart = std::chrono::steady_clock::now();
+        if (!buildMemoryImage(data, size, file)) {
+            printf("Failed to build PE memory image\n");
+            return false;
+        }
+        m_stats.decompressMs = elapsedMs(buildStart);
+        m_stats.payloadSize = size;
+        m_stats.imageSize = m_memory.size();
 
         if (!loadImports(data, size)) {
             printf("Failed to load PE imports\n");
             return false;
         }
 
+        m_stats.totalMs = elapsedMs(start);
+
         printf("PE image loaded successfully\n");
         printf("  Base address: 0x%08X\n", m_baseAddress);
         printf("  Entry point: 0x%08X\n", m_entryPoint);
@@ -270,22 +456,30 @@ namespace XLoader
         return true;
     }
 
-    void PEImage::buildMemoryImage(const uint8_t* data, size_t size) {
-        // Allocate memory for the image
-        m_memorySize = m_optHeader.sizeOfImage;
-        m_memoryData = new uint8_t[m_memorySize];
-        std::memset(m_memoryData, 0, m_memorySize);
-
+    const uint8_t* PEImage::materialize(size_t offset, size_t size) {
+        if (offset > m_memory.size() || size > m_memory.size() - offset) {
+            return nullptr;
+        }
+        return m_memory.data() + offset;
+    }
 
+    bool PEImage::buildMemoryImage(const uint8_t* data, size_t size, const MappedFile* file) {
+        // Allocate memory for the image, it's already zero filled
+        if (!allocateImageMemory(m_memory, m_optHeader.sizeOfImage, m_optHeader.imageBase, m_useGuestWindow)) {
+            printf("Failed to allocate %u bytes for the PE image\n", m_optHeader.sizeOfImage);
+            return false;
+        }
 
-        // copy everything
-        std::memcpy(m_memoryData, data, size);
+        // copy everything (mapped copy-on-write when it comes from a file)
+        if (!m_memory.load(0, data, std::min(size, m_memory.size()), file)) {
+            return false;
+        }
 
 
         // Copy headers
         //size_t headerSize = m_optHeader.sizeOfHeaders;
         //if (headerSize > size) headerSize = size;
-        //std::memcpy(m_memoryData, data, headerSize);
+        //std::memcpy(m_memory.data(), data, headerSize);
 
         // Copy sections
         //for (const auto& section : m_sections) {
@@ -297,13 +491,15 @@ namespace XLoader
         //
         //        if (section->getPhysicalAddress() + copySize <= size) {
         //            std::memcpy(
-        //                m_memoryData + section->getVirtualAddress(),
+        //                m_memory.data() + section->getVirtualAddress(),
         //                data + section->getPhysicalAddress(),
         //                copySize
         //            );
         //        }
         //    }
         //}
+
+        return true;
     }
 
     bool PEImage::loadImports(const uint8_t* data, size_t size) {
@@ -314,7 +510,7 @@ namespace XLoader
             auto& importDir = m_optHeader.dataDirectories[1];
             if (importDir.VirtualAddress != 0 && importDir.Size != 0) {
                 // Would parse import descriptors here
-                printf("Import directory found at RVA 0x%08lX\n", importDir.VirtualAddress);
+                printf("Import directory found at RVA 0x%08X\n", (uint32_t)importDir.VirtualAddress);
             }
         }
 
@@ -322,9 +518,59 @@ namespace XLoader
     }
 
     // XEX Image implementation
+
+    // State of an image loaded with LoadOptions::lazy
+    // basic / uncompressed images are built one unit (a page descriptor range, or 64KB without digests) at a time
+    // when a page of it is first accessed, LZX images are decoded front to back by a background thread
+    struct XEXImage::LazyState {
+        static const size_t PageSize = 0x1000;
+        static const size_t UnitSize = 0x10000;
+        enum PageState : uint8_t { PageAbsent = 0, PageReady = 1 };
+
+        // data portion of a basic compression block
+        struct Run {
+            size_t imageOffset;
+            size_t streamOffset;
+            size_t size;
+        };
+
+        struct Unit {
+            size_t offset;
+            size_t size;
+            bool hasDigest;
+            uint8_t digest[20];
+        };
+
+        const uint8_t* payload = nullptr;
+        size_t payloadSize = 0;
+        const MappedFile* file = nullptr;
+
+        std::vector<Run> runs;
+        std::vector<Unit> units;
+        std::vector<std::atomic<uint8_t>> pages;
+        std::mutex fillMutex;
+        size_t digestUnits = 0;
+        std::atomic<size_t> verifiedUnits{ 0 };
+        std::atomic<size_t> mismatches{ 0 };
+
+        // background LZX decode
+        bool background = false;
+        std::thread decoder;
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t decoded = 0;
+        bool finished = false;
+        bool failed = false;
+        std::atomic<bool> cancel{ false };
+    };
+
+    XEXImage::XEXImage() : m_baseAddress(0), m_entryPoint(0), m_header(), m_loaderInfo(), m_executionInfo(),
+        m_compressionType(XEXCompressionType::None), m_encryptionType(XEXEncryptionType::None), m_normalInfo(), m_verifyDigests(true), m_verified(false), m_useGuestWindow(false), m_lazyLoad(false) {}
+
     XEXImage::~XEXImage() {
-        if (m_memoryData) {
-            free(m_memoryData);
+        if (m_lazy && m_lazy->background) {
+            m_lazy->cancel = true;
+            m_lazy->decoder.join();
         }
     }
 
@@ -339,18 +585,44 @@ namespace XLoader
             ((*val & 0x000000FF) << 24);
     }
 
-    bool XEXImage::load(const uint8_t* data, size_t size) {
+    bool XEXImage::load(const uint8_t* data, size_t size, const MappedFile* file, const LoadOptions& options) {
         printf("Loading XEX2 image...\n");
+        auto start = std::chrono::steady_clock::now();
+        m_stats = LoadStats();
+        m_stats.fileSize = size;
+        m_verifyDigests = options.verifyDigests;
+        m_useGuestWindow = options.useGuestWindow;
+        m_lazyLoad = options.lazy;
+        m_verified = false;
 
         if (!loadHeaders(data, size)) {
             printf("Failed to load XEX headers\n");
             return false;
         }
 
-        if (!decompressImage(data, size)) {
+        auto decompressStart = std::chrono::steady_clock::now();
+        if (!decompressImage(data, size, file)) {
             printf("Failed to decompress XEX image\n");
+            m_verifier.reset();
             return false;
         }
+        m_stats.decompressMs = elapsedMs(decompressStart);
+        m_stats.payloadSize = size - m_header.exeOffset;
+        m_stats.imageSize = m_memory.size();
+
+        // a lazy LZX image is still being decoded, its digests are checked by the decoder thread
+        bool decoding = m_lazy && m_lazy->background;
+        if (m_verifier && !decoding) {
+            auto waitStart = std::chrono::steady_clock::now();
+            m_stats.digestMismatches = m_verifier->finish();
+            m_stats.verifyWaitMs = elapsedMs(waitStart);
+            m_stats.verifyCpuMs = m_verifier->getCpuMs();
+            m_stats.verifiedBytes = m_verifier->getVerifiedBytes();
+            m_verified = (m_stats.digestMismatches == 0);
+            printf("  Verified %zu page ranges (%zu mismatches, SHA-1 %s)\n",
+                m_verifier->getRangeCount(), m_stats.digestMismatches, SHA1::isAccelerated() ? "SHA-NI" : "portable");
+            m_verifier.reset();
+        }
 
         if (!extractPEImage()) {
             printf("Failed to extract PE from XEX\n");
@@ -362,6 +634,8 @@ namespace XLoader
             return false;
         }
 
+        m_stats.totalMs = elapsedMs(start);
+
         printf("XEX2 image loaded successfully\n");
         printf("  Base address: 0x%08X\n", m_baseAddress);
         printf("  Entry point: 0x%08X\n", m_entryPoint);
@@ -402,7 +676,7 @@ namespace XLoader
         }
 
         // Decrypt session key
-        decryptSessionKey();
+        decryptSessionKey(data, size);
 
         return true;
     }
@@ -461,7 +735,7 @@ namespace XLoader
         return true;
     }
 
-    void XEXImage::decryptSessionKey() {
+    void XEXImage::decryptSessionKey(const uint8_t* data, size_t size) {
         // XEX2 retail key
         static const uint8_t retailKey[16] = {
             0x20, 0xB1, 0x85, 0xA5, 0x9D, 0x28, 0xFD, 0xC3,
@@ -471,28 +745,65 @@ namespace XLoader
         // XEX2 devkit key (all zeros)
         static const uint8_t devkitKey[16] = { 0 };
 
+        // The session key is the file key decrypted (AES-128-ECB) with one of the two keys
+        uint8_t retailSessionKey[16];
+        uint8_t devkitSessionKey[16];
+        AESDecryptor(retailKey).decryptECB(m_loaderInfo.fileKey, retailSessionKey, 1);
+        AESDecryptor(devkitKey).decryptECB(m_loaderInfo.fileKey, devkitSessionKey, 1);
+
         // Determine which key to use based on execution info
-        const uint8_t* keyToUse = devkitKey;
-        if (m_executionInfo.titleId != 0) {
-            keyToUse = retailKey;
-            printf("  Using retail key for decryption\n");
+        bool useRetail = m_executionInfo.titleId != 0;
+
+        // with normal compression the first block has a known SHA-1, pick the key that reproduces it
+        if (m_encryptionType != XEXEncryptionType::None && m_compressionType == XEXCompressionType::Normal &&
+            m_header.exeOffset <= size && m_normalInfo.firstBlock.blockSize <= size - m_header.exeOffset) {
+            size_t blockSize = m_normalInfo.firstBlock.blockSize;
+            std::vector<uint8_t> block(std::min((blockSize + 15) & ~(size_t)15, size - m_header.exeOffset) & ~(size_t)15);
+            uint8_t digest[20];
+            for (int pass = 0; pass < 2 && block.size() >= blockSize; pass++) {
+                uint8_t iv[16] = { 0 };
+                AESDecryptor(pass == 0 ? retailSessionKey : devkitSessionKey).decryptCBC(data + m_header.exeOffset, block.data(), block.size(), iv);
+                SHA1::hash(block.data(), blockSize, digest);
+                if (memcmp(digest, m_normalInfo.firstBlock.blockHash, 20) == 0) {
+                    useRetail = (pass == 0);
+                    break;
+                }
+            }
         }
-        else {
-            printf("  Using devkit key for decryption\n");
+
+        // if the payload starts with the PE header, pick the key that decrypts it to "MZ"
+        if (m_encryptionType != XEXEncryptionType::None &&
+            (m_compressionType == XEXCompressionType::None || m_compressionType == XEXCompressionType::Basic) &&
+            m_header.exeOffset <= size && size - m_header.exeOffset >= 16) {
+            uint8_t block[16];
+            uint8_t iv[16] = { 0 };
+            AESDecryptor(retailSessionKey).decryptCBC(data + m_header.exeOffset, block, 16, iv);
+            if (block[0] == 'M' && block[1] == 'Z') {
+                useRetail = true;
+            }
+            else {
+                memset(iv, 0, sizeof(iv));
+                AESDecryptor(devkitSessionKey).decryptCBC(data + m_header.exeOffset, block, 16, iv);
+                if (block[0] == 'M' && block[1] == 'Z') {
+                    useRetail = false;
+                }
+            }
         }
 
-        // Note: Actual AES decryption would happen here
-        // For now, just copy the file key as session key (placeholder)
-        memcpy(m_sessionKey, m_loaderInfo.fileKey, 16);
+        memcpy(m_sessionKey, useRetail ? retailSessionKey : devkitSessionKey, 16);
+        m_decryptor = std::make_unique<AESDecryptor>(m_sessionKey);
 
-        printf("  Session key decrypted\n");
+        printf("  Using %s key for decryption\n", useRetail ? "retail" : "devkit");
+        printf("  Session key decrypted (%s)\n", AESDecryptor::getKernelName(m_decryptor->getKernel()));
     }
 
-    bool XEXImage::decompressBasic(const uint8_t* data, size_t size) {
+    bool XEXImage::decompressBasic(const uint8_t* data, size_t size, const MappedFile* file) {
         // Calculate uncompressed size
         uint32_t uncompressedSize = 0;
+        uint32_t zeroSize = 0;
         for (const auto& block : m_compressionBlocks) {
             uncompressedSize += block.dataSize + block.zeroSize;
+            zeroSize += block.zeroSize;
         }
 
         if (uncompressedSize > 128 * 1024 * 1024) { // 128MB sanity check
@@ -501,63 +812,278 @@ namespace XLoader
         }
 
         // Allocate memory for uncompressed data
-        m_memoryData = (uint8_t*)malloc(uncompressedSize);
-        if (!m_memoryData) {
+        // the image is an anonymous mapping, zero runs are never touched and stay on the shared zero page
+        if (!allocateImage(uncompressedSize)) {
             printf("Failed to allocate %u bytes for decompression\n", uncompressedSize);
             return false;
         }
-        m_memorySize = uncompressedSize;
-        memset(m_memoryData, 0, m_memorySize);
 
         // Source data starts at exe offset
         const uint8_t* src = data + m_header.exeOffset;
-        uint8_t* dst = m_memoryData;
+        uint8_t* dst = m_memory.data();
+
+        if (m_lazyLoad) {
+            // only record where each data portion goes, the pages are filled by materialize()
+            startLazy(src, size - m_header.exeOffset, file);
+            size_t streamOffset = 0;
+            size_t imageOffset = 0;
+            for (const auto& block : m_compressionBlocks) {
+                if (block.dataSize > 0) {
+                    if (m_header.exeOffset + streamOffset + block.dataSize > size) {
+                        printf("Compression block exceeds file size\n");
+                        return false;
+                    }
+                    m_lazy->runs.push_back({ imageOffset, streamOffset, block.dataSize });
+                }
+                streamOffset += block.dataSize;
+                imageOffset += block.dataSize + block.zeroSize;
+            }
+            printf("  %u bytes of basic compression (%zu data runs) built on demand\n", uncompressedSize, m_lazy->runs.size());
+            return true;
+        }
+        startPageVerification();
+
+        // the data portions are contiguous in the file and form a single CBC stream,
+        // they are collected here and decrypted in parallel afterwards
+        std::vector<CipherRun> cipherRuns;
 
         // Process each compression block
         for (const auto& block : m_compressionBlocks) {
             // Copy data portion
             if (block.dataSize > 0) {
+                if ((size_t)(src - data) + block.dataSize > size) {
+                    printf("Compression block exceeds file size\n");
+                    return false;
+                }
+
                 if (m_encryptionType == XEXEncryptionType::None) {
-                    // No encryption, direct copy
-                    memcpy(dst, src, block.dataSize);
+                    // No encryption, mapped from the file when the run covers whole pages, copied otherwise
+                    if (!m_memory.load(dst - m_memory.data(), src, block.dataSize, file)) {
+                        return false;
+                    }
                 }
                 else {
-                    // With encryption, would decrypt here
-                    // For now, just copy (placeholder)
-                    memcpy(dst, src, block.dataSize);
+                    cipherRuns.push_back({ (size_t)(src - (data + m_header.exeOffset)), dst, block.dataSize });
                 }
                 src += block.dataSize;
                 dst += block.dataSize;
             }
 
-            // Skip zero portion (already zeroed)
+            // Skip zero portion (never written)
             dst += block.zeroSize;
         }
 
-        printf("  Decompressed %u bytes from basic compression\n", uncompressedSize);
+        if (!cipherRuns.empty()) {
+            decryptRuns(data + m_header.exeOffset, cipherRuns);
+        }
+
+        printf("  Decompressed %u bytes from basic compression (%u zero, %zu mapped)\n",
+            uncompressedSize, zeroSize, m_memory.mappedBytes());
         return true;
     }
 
     bool XEXImage::decompressNormal(const uint8_t* data, size_t size) {
-        printf("Normal compression not yet implemented\n");
-        return false;
+        if (m_header.exeOffset > size) {
+            printf("Image data exceeds file size\n");
+            return false;
+        }
+        const uint8_t* payload = data + m_header.exeOffset;
+        const size_t payloadSize = size - m_header.exeOffset;
+
+        if (!std::make_unique<LZXDecoder>(m_normalInfo.windowSize)->isValid()) {
+            printf("Invalid LZX window size 0x%X\n", m_normalInfo.windowSize);
+            return false;
+        }
+
+        if (!allocateImage(m_loaderInfo.imageSize)) {
+            printf("Failed to allocate %u bytes for decompression\n", m_loaderInfo.imageSize);
+            return false;
+        }
+        startPageVerification();
+
+        if (m_lazyLoad) {
+            startLazyDecode(payload, payloadSize);
+            printf("  LZX decompression of %zu bytes continues in the background\n", m_memory.size());
+            return true;
+        }
+        return decodeNormal(payload, payloadSize);
+    }
+
+    bool XEXImage::decodeNormal(const uint8_t* payload, size_t payloadSize) {
+        auto lzx = std::make_unique<LZXDecoder>(m_normalInfo.windowSize);
+
+        // The compressed payload is a chain of blocks, each one starting with the size and SHA-1 of the next:
+        //   [u32 next block size][next block SHA-1] then chunks of [u16 size][LZX data], ended by a 0 size
+        // Blocks are decrypted and checked one at a time as the LZX decoder asks for input, so only the
+        // current block is held besides the file mapping, and the output is written straight into the image
+        const bool encrypted = m_encryptionType != XEXEncryptionType::None;
+        std::vector<uint8_t> plain;   // decrypted bytes [plainStart, plainStart + plain.size()) of the payload
+        size_t plainStart = 0;
+        uint8_t iv[16] = { 0 };
+
+        size_t blockOffset = 0;
+        uint32_t blockSize = m_normalInfo.firstBlock.blockSize;
+        uint8_t blockHash[20];
+        memcpy(blockHash, m_normalInfo.firstBlock.blockHash, sizeof(blockHash));
+
+        const uint8_t* block = nullptr;
+        size_t chunkOffset = 0;
+        uint32_t nextBlockSize = 0;
+        size_t blockCount = 0;
+        bool failed = false;
+
+        auto openBlock = [&]() -> bool {
+            if (blockOffset > payloadSize || blockSize > payloadSize - blockOffset || blockSize < 24) {
+                printf("Compressed block %zu (0x%X bytes) exceeds file size\n", blockCount, blockSize);
+                return false;
+            }
+
+            const uint8_t* current = payload + blockOffset;
+            if (encrypted) {
+                // blocks aren't 16 byte aligned, keep what was already decrypted past the previous one
+                plain.erase(plain.begin(), plain.begin() + (blockOffset - plainStart));
+                plainStart = blockOffset;
+
+                size_t decryptedEnd = plainStart + plain.size();
+                size_t blockEnd = blockOffset + blockSize;
+                if (decryptedEnd < blockEnd) {
+                    size_t decryptSize = std::min((blockEnd - decryptedEnd + 15) & ~(size_t)15, payloadSize - decryptedEnd);
+                    plain.resize(plain.size() + decryptSize);
+                    decryptData(plain.data() + (decryptedEnd - plainStart), payload + decryptedEnd, decryptSize, iv);
+                }
+                current = plain.data();
+            }
+
+            uint8_t digest[20];
+            SHA1::hash(current, blockSize, digest);
+            if (memcmp(digest, blockHash, sizeof(blockHash)) != 0) {
+                printf("Compressed block %zu failed its SHA-1 check\n", blockCount);
+                return false;
+            }
+
+            block = current;
+            nextBlockSize = ((uint32_t)block[0] << 24) | (block[1] << 16) | (block[2] << 8) | block[3];
+            memcpy(blockHash, block + 4, sizeof(blockHash));
+            chunkOffset = 24;
+            blockCount++;
+            return true;
+        };
+
+        LZXDecoder::InputSource input = [&](const uint8_t*& chunk, size_t& chunkSize) -> bool {
+            if (failed) {
+                return false;
+            }
+            if (m_lazy && m_lazy->cancel) {
+                failed = true;
+                return false;
+            }
+            for (;;) {
+                if (!block) {
+                    if (blockSize == 0) {
+                        return false;
+                    }
+                    if (!openBlock()) {
+                        failed = true;
+                        return false;
+                    }
+                }
+
+                if (chunkOffset + 2 > blockSize) {
+                    printf("Compressed block %zu has no terminator\n", blockCount - 1);
+                    failed = true;
+                    return false;
+                }
+                size_t length = (block[chunkOffset] << 8) | block[chunkOffset + 1];
+                chunkOffset += 2;
+
+                if (length == 0) {
+                    blockOffset += blockSize;
+                    blockSize = nextBlockSize;
+                    block = nullptr;
+                    continue;
+                }
+                if (length > blockSize - chunkOffset) {
+                    printf("Compressed chunk exceeds block %zu\n", blockCount - 1);
+                    failed = true;
+                    return false;
+                }
+
+                chunk = block + chunkOffset;
+                chunkSize = length;
+                chunkOffset += length;
+                return true;
+            }
+        };
+
+        // page ranges are verified on the thread pool as soon as the decoder is past them
+        // and readers of a lazy image are woken up
+        LZXDecoder::ProgressCallback progress = [&](size_t decoded) {
+            if (m_verifier) {
+                m_verifier->notifyReady(decoded);
+            }
+            if (m_lazy) {
+                {
+                    std::lock_guard<std::mutex> lock(m_lazy->mutex);
+                    m_lazy->decoded = decoded;
+                }
+                m_lazy->cv.notify_all();
+            }
+        };
+
+        if (!lzx->decompress(input, m_memory.data(), m_memory.size(), progress) || failed) {
+            if (!m_lazy || !m_lazy->cancel) {
+                printf("LZX decompression failed\n");
+            }
+            return false;
+        }
+
+        printf("  Decompressed %zu bytes from %zu LZX blocks (window 0x%X)\n",
+            m_memory.size(), blockCount, m_normalInfo.windowSize);
+        return true;
+    }
+
+    bool XEXImage::allocateImage(size_t size) {
+        // the base address header wins, the loader info address is what the kernel would use without it
+        uint32_t guestAddress = m_baseAddress ? m_baseAddress : m_loaderInfo.loadAddress;
+        return allocateImageMemory(m_memory, size, guestAddress, m_useGuestWindow);
     }
 
-    bool XEXImage::decompressImage(const uint8_t* data, size_t size) {
+    bool XEXImage::decompressImage(const uint8_t* data, size_t size, const MappedFile* file) {
         switch (m_compressionType) {
         case XEXCompressionType::None:
+        {
             // No compression - copy directly
-            m_memorySize = m_loaderInfo.imageSize;
-            m_memoryData = (uint8_t*)malloc(m_memorySize);
-            if (!m_memoryData) {
+            if (m_header.exeOffset > size || m_loaderInfo.imageSize > size - m_header.exeOffset) {
+                printf("Image data exceeds file size\n");
+                return false;
+            }
+            if (!allocateImage(m_loaderInfo.imageSize)) {
                 return false;
             }
-            memcpy(m_memoryData, data + m_header.exeOffset, m_memorySize);
-            printf("  No compression - copied %zu bytes\n", m_memorySize);
+
+            // unencrypted data is mapped below, which is already on demand
+            if (m_lazyLoad && m_encryptionType != XEXEncryptionType::None) {
+                startLazy(data + m_header.exeOffset, m_loaderInfo.imageSize, file);
+                printf("  No compression - %zu bytes decrypted on demand\n", m_memory.size());
+                return true;
+            }
+            startPageVerification();
+
+            if (m_encryptionType != XEXEncryptionType::None) {
+                std::vector<CipherRun> cipherRuns = { { 0, m_memory.data(), m_memory.size() } };
+                decryptRuns(data + m_header.exeOffset, cipherRuns);
+                printf("  No compression - decrypted %zu bytes\n", m_memory.size());
+                return true;
+            }
+
+            // unencrypted data is mapped copy-on-write straight from the file
+            m_memory.load(0, data + m_header.exeOffset, m_memory.size(), file);
+            printf("  No compression - copied %zu bytes (%zu mapped)\n", m_memory.size(), m_memory.mappedBytes());
             return true;
+        }
 
         case XEXCompressionType::Basic:
-            return decompressBasic(data, size);
+            return decompressBasic(data, size, file);
 
         case XEXCompressionType::Normal:
             return decompressNormal(data, size);
@@ -572,48 +1098,305 @@ namespace XLoader
         }
     }
 
-    bool XEXImage::decryptData(uint8_t* dest, const uint8_t* src, size_t size) {
-        // Placeholder for AES decryption
-        // In real implementation, would use session key to decrypt
-        memcpy(dest, src, size);
+    bool XEXImage::decryptData(uint8_t* dest, const uint8_t* src, size_t size, uint8_t iv[16]) {
+        // AES-128-CBC with the session key, a trailing partial block (never produced by the tools) is copied as is
+        size_t aligned = size & ~(size_t)15;
+        m_decryptor->decryptCBC(src, dest, aligned, iv);
+        if (aligned != size) {
+            memmove(dest + aligned, src + aligned, size - aligned);
+        }
+        return true;
+    }
+
+    void XEXImage::decryptRuns(const uint8_t* stream, const std::vector<CipherRun>& runs) {
+        // In CBC each plaintext block only needs its own ciphertext block and the one before it,
+        // so the stream is cut in chunks that are decrypted independently, the IV of a chunk being
+        // the ciphertext block right before it. The output doesn't depend on the number of threads
+        // (data portions are always a multiple of the AES block size)
+        static const size_t chunkSize = 1024 * 1024;
+
+        std::vector<CipherRun> chunks;
+        for (const CipherRun& run : runs) {
+            for (size_t offset = 0; offset < run.size; offset += chunkSize) {
+                chunks.push_back({ run.streamOffset + offset, run.dest + offset, std::min(chunkSize, run.size - offset) });
+            }
+        }
+
+        ThreadPool::global().parallelFor(chunks.size(), [&](size_t i) {
+            const CipherRun& chunk = chunks[i];
+            uint8_t iv[16] = { 0 };
+            if (chunk.streamOffset >= 16) {
+                memcpy(iv, stream + chunk.streamOffset - 16, 16);
+            }
+            decryptData(chunk.dest, stream + chunk.streamOffset, chunk.size, iv);
+        });
+    }
+
+    void XEXImage::startPageVerification() {
+        m_verifier.reset();
+        if (!m_verifyDigests || m_xexSections.empty()) {
+            return;
+        }
+
+        // each page descriptor covers <page count> pages and carries the SHA-1 of that range
+        size_t pageSize = (m_loaderInfo.imageFlags & XEXImageFlagPageSize4KB) ? 0x1000 : 0x10000;
+        std::vector<PageVerifier::Range> ranges;
+        size_t offset = 0;
+        for (const XEXSection& section : m_xexSections) {
+            size_t rangeSize = (size_t)section.getPageCount() * pageSize;
+            if (rangeSize == 0) {
+                continue;
+            }
+            if (offset + rangeSize > m_memory.size()) {
+                printf("Page descriptors exceed the image size, digests not checked\n");
+                return;
+            }
+
+            PageVerifier::Range range;
+            range.offset = offset;
+            range.size = rangeSize;
+            memcpy(range.digest, section.digest, sizeof(range.digest));
+            ranges.push_back(range);
+            offset += rangeSize;
+        }
+
+        m_verifier = std::make_unique<PageVerifier>(m_memory.data(), std::move(ranges));
+    }
+
+    void XEXImage::startLazy(const uint8_t* payload, size_t payloadSize, const MappedFile* file) {
+        m_lazy = std::make_unique<LazyState>();
+        LazyState& lazy = *m_lazy;
+        lazy.payload = payload;
+        lazy.payloadSize = payloadSize;
+        lazy.file = file;
+
+        // with digests a unit is a page descriptor range, so it can be checked as soon as it's built
+        size_t imageSize = m_memory.size();
+        if (m_verifyDigests && !m_xexSections.empty()) {
+            size_t pageSize = (m_loaderInfo.imageFlags & XEXImageFlagPageSize4KB) ? 0x1000 : 0x10000;
+            size_t offset = 0;
+            for (const XEXSection& section : m_xexSections) {
+                size_t rangeSize = (size_t)section.getPageCount() * pageSize;
+                if (rangeSize == 0) {
+                    continue;
+                }
+                if (offset + rangeSize > imageSize) {
+                    printf("Page descriptors exceed the image size, digests not checked\n");
+                    lazy.units.clear();
+                    break;
+                }
+
+                LazyState::Unit unit;
+                unit.offset = offset;
+                unit.size = rangeSize;
+                unit.hasDigest = true;
+                memcpy(unit.digest, section.digest, sizeof(unit.digest));
+                lazy.units.push_back(unit);
+                offset += rangeSize;
+            }
+            lazy.digestUnits = lazy.units.size();
+        }
+
+        size_t offset = lazy.units.empty() ? 0 : lazy.units.back().offset + lazy.units.back().size;
+        while (offset < imageSize) {
+            LazyState::Unit unit = {};
+            unit.offset = offset;
+            unit.size = std::min(LazyState::UnitSize, imageSize - offset);
+            lazy.units.push_back(unit);
+            offset += unit.size;
+        }
+
+        lazy.pages = std::vector<std::atomic<uint8_t>>((imageSize + LazyState::PageSize - 1) / LazyState::PageSize);
+    }
+
+    void XEXImage::startLazyDecode(const uint8_t* payload, size_t payloadSize) {
+        m_lazy = std::make_unique<LazyState>();
+        m_lazy->payload = payload;
+        m_lazy->payloadSize = payloadSize;
+        m_lazy->background = true;
+
+        m_lazy->decoder = std::thread([this, payload, payloadSize] {
+            bool ok = decodeNormal(payload, payloadSize);
+            if (m_verifier) {
+                if (ok) {
+                    size_t mismatches = m_verifier->finish();
+                    m_verified = (mismatches == 0);
+                    printf("  Verified %zu page ranges in the background (%zu mismatches)\n", m_verifier->getRangeCount(), mismatches);
+                }
+                else {
+                    m_verifier->cancel();
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_lazy->mutex);
+                if (ok) {
+                    m_lazy->decoded = m_memory.size();
+                }
+                m_lazy->failed = !ok;
+                m_lazy->finished = true;
+            }
+            m_lazy->cv.notify_all();
+        });
+    }
+
+    const uint8_t* XEXImage::materialize(size_t offset, size_t size) {
+        if (offset > m_memory.size() || size > m_memory.size() - offset) {
+            return nullptr;
+        }
+        uint8_t* data = m_memory.data() + offset;
+        if (!m_lazy || size == 0) {
+            return data;
+        }
+        LazyState& lazy = *m_lazy;
+
+        // LZX output only exists front to back, wait for the decoder to get past the range
+        if (lazy.background) {
+            std::unique_lock<std::mutex> lock(lazy.mutex);
+            lazy.cv.wait(lock, [&] { return lazy.decoded >= offset + size || lazy.finished; });
+            return lazy.decoded >= offset + size ? data : nullptr;
+        }
+
+        size_t firstPage = offset / LazyState::PageSize;
+        size_t lastPage = (offset + size - 1) / LazyState::PageSize;
+        for (size_t page = firstPage; page <= lastPage; page++) {
+            if (lazy.pages[page].load(std::memory_order_acquire) == LazyState::PageReady) {
+                continue;
+            }
+
+            size_t pageOffset = page * LazyState::PageSize;
+            auto unit = std::upper_bound(lazy.units.begin(), lazy.units.end(), pageOffset,
+                [](size_t value, const LazyState::Unit& u) { return value < u.offset; });
+            if (!materializeUnit((unit - lazy.units.begin()) - 1)) {
+                return nullptr;
+            }
+        }
+        return data;
+    }
+
+    bool XEXImage::materializeUnit(size_t index) {
+        LazyState& lazy = *m_lazy;
+        const LazyState::Unit& unit = lazy.units[index];
+        size_t firstPage = unit.offset / LazyState::PageSize;
+        size_t lastPage = (unit.offset + unit.size - 1) / LazyState::PageSize;
+
+        std::lock_guard<std::mutex> lock(lazy.fillMutex);
+        if (lazy.pages[firstPage].load(std::memory_order_acquire) == LazyState::PageReady) {
+            return true;
+        }
+
+        fillLazyRange(unit.offset, unit.offset + unit.size);
+
+        if (unit.hasDigest) {
+            uint8_t digest[20];
+            SHA1::hash(m_memory.data() + unit.offset, unit.size, digest);
+            if (memcmp(digest, unit.digest, sizeof(digest)) != 0) {
+                printf("Page range 0x%zX-0x%zX failed its digest check\n", unit.offset, unit.offset + unit.size);
+                lazy.mismatches++;
+            }
+            // verified only once every range has been built and checked
+            if (++lazy.verifiedUnits == lazy.digestUnits && lazy.mismatches == 0) {
+                m_verified = true;
+            }
+        }
+
+        for (size_t page = firstPage; page <= lastPage; page++) {
+            lazy.pages[page].store(LazyState::PageReady, std::memory_order_release);
+        }
         return true;
     }
 
+    void XEXImage::fillLazyRange(size_t begin, size_t end) {
+        LazyState& lazy = *m_lazy;
+        uint8_t* image = m_memory.data();
+
+        // uncompressed images are only lazy when encrypted, the stream maps 1:1 onto the image
+        if (m_compressionType == XEXCompressionType::None) {
+            uint8_t iv[16] = { 0 };
+            if (begin >= 16) {
+                memcpy(iv, lazy.payload + begin - 16, 16);
+            }
+            decryptData(image + begin, lazy.payload + begin, end - begin, iv);
+            return;
+        }
+
+        // basic compression, the zero portions are already there
+        auto run = std::upper_bound(lazy.runs.begin(), lazy.runs.end(), begin,
+            [](size_t value, const LazyState::Run& r) { return value < r.imageOffset; });
+        if (run != lazy.runs.begin()) {
+            --run;
+        }
+
+        for (; run != lazy.runs.end() && run->imageOffset < end; ++run) {
+            size_t sliceStart = std::max(begin, run->imageOffset);
+            size_t sliceEnd = std::min(end, run->imageOffset + run->size);
+            if (sliceStart >= sliceEnd) {
+                continue;
+            }
+            size_t stream = run->streamOffset + (sliceStart - run->imageOffset);
+            size_t length = sliceEnd - sliceStart;
+
+            if (m_encryptionType == XEXEncryptionType::None) {
+                m_memory.load(sliceStart, lazy.payload + stream, length, lazy.file);
+                continue;
+            }
+
+            // CBC: start at the AES block holding the first byte, its IV is the ciphertext block before it
+            size_t alignedStart = stream & ~(size_t)15;
+            size_t alignedEnd = std::min((stream + length + 15) & ~(size_t)15, lazy.payloadSize);
+            uint8_t iv[16] = { 0 };
+            if (alignedStart >= 16) {
+                memcpy(iv, lazy.payload + alignedStart - 16, 16);
+            }
+            std::vector<uint8_t> plain(alignedEnd - alignedStart);
+            decryptData(plain.data(), lazy.payload + alignedStart, plain.size(), iv);
+            memcpy(image + sliceStart, plain.data() + (stream - alignedStart), length);
+        }
+    }
+
     bool XEXImage::extractPEImage() {
         // PE header should be at the start of decompressed data
-        if (m_memorySize < sizeof(DOSHeader)) {
+        // every header is materialized before it's read, for lazy images that builds the first pages only
+        uint8_t* memoryData = m_memory.data();
+        size_t memorySize = m_memory.size();
+        if (!materialize(0, sizeof(DOSHeader))) {
             printf("Memory too small for DOS header\n");
             return false;
         }
 
         // Check for MZ signature
-        DOSHeader* dosHeader = (DOSHeader*)m_memoryData;
+        DOSHeader* dosHeader = (DOSHeader*)memoryData;
         if (dosHeader->signature[0] != 'M' || dosHeader->signature[1] != 'Z') {
             printf("Invalid DOS header in XEX PE\n");
             return false;
         }
 
         // Get PE header offset
-        if (dosHeader->newHeaderOffset >= m_memorySize) {
+        if (dosHeader->newHeaderOffset >= memorySize ||
+            !materialize(dosHeader->newHeaderOffset, 4 + sizeof(COFFHeader) + sizeof(PEOptionalHeader32))) {
             printf("PE header offset exceeds memory size\n");
             return false;
         }
 
         // Check PE signature
-        uint32_t* peSignature = (uint32_t*)(m_memoryData + dosHeader->newHeaderOffset);
+        uint32_t* peSignature = (uint32_t*)(memoryData + dosHeader->newHeaderOffset);
         if (*peSignature != 0x00004550) {
             printf("Invalid PE signature in XEX\n");
             return false;
         }
 
         // Parse COFF header
-        COFFHeader* coffHeader = (COFFHeader*)(m_memoryData + dosHeader->newHeaderOffset + 4);
+        COFFHeader* coffHeader = (COFFHeader*)(memoryData + dosHeader->newHeaderOffset + 4);
 
         // Parse optional header
         PEOptionalHeader32* optHeader = (PEOptionalHeader32*)((uint8_t*)coffHeader + sizeof(COFFHeader));
 
         // Extract sections
         PESectionHeader* sectionHeaders = (PESectionHeader*)((uint8_t*)optHeader + coffHeader->optionalHeaderSize);
+        if (!materialize((uint8_t*)sectionHeaders - memoryData, coffHeader->numberOfSections * sizeof(PESectionHeader))) {
+            printf("PE section table exceeds memory size\n");
+            return false;
+        }
 
         for (int i = 0; i < coffHeader->numberOfSections; i++) {
             PESectionHeader* section = &sectionHeaders[i];
@@ -651,20 +1434,66 @@ namespace XLoader
         return true;
     }
 
+    void XEXImage::loadExports() {
+        if (m_loaderInfo.exportTable == 0) {
+            return;
+        }
+
+        size_t offset = m_loaderInfo.exportTable - m_baseAddress;
+        const uint8_t* data = materialize(offset, sizeof(XEXExportTable));
+        if (!data) {
+            printf("  Export table out of bounds: 0x%08X\n", m_loaderInfo.exportTable);
+            return;
+        }
+        XEXExportTable table;
+        memcpy(&table, data, sizeof(table));
+        swap32(&table.imageBaseAddress);
+        swap32(&table.count);
+
+        const uint8_t* offsets = materialize(offset + sizeof(XEXExportTable), (size_t)table.count * sizeof(uint32_t));
+        if (!offsets) {
+            printf("  Export table out of bounds: 0x%08X (%u exports)\n", m_loaderInfo.exportTable, table.count);
+            return;
+        }
+        for (uint32_t i = 0; i < table.count; i++) {
+            uint32_t ordinalOffset;
+            memcpy(&ordinalOffset, offsets + i * sizeof(uint32_t), sizeof(uint32_t));
+            swap32(&ordinalOffset);
+            // unused ordinals are left at 0
+            if (ordinalOffset != 0) {
+                m_exports.push_back((table.imageBaseAddress << 16) + ordinalOffset);
+            }
+        }
+        printf("  %zu exports\n", m_exports.size());
+    }
+
     bool XEXImage::processImports() {
+        // the library of each import descriptor is resolved once, the records only carry an index
+        std::vector<XboxLibrary> libraries(m_libraryNames.size(), XboxLibrary::XboxKrnl);
+        std::vector<bool> knownLibraries(m_libraryNames.size(), false);
+        for (size_t i = 0; i < m_libraryNames.size(); i++) {
+            XboxLibrary lib;
+            if (findImportLibrary(m_libraryNames[i], lib)) {
+                libraries[i] = lib;
+                knownLibraries[i] = true;
+            }
+        }
+        size_t resolved = 0;
+
         // Process import records
         for (size_t i = 0; i < m_importRecords.size(); i++) {
             uint32_t recordAddr = m_importRecords[i];
 
             // Calculate offset in memory
             uint32_t offset = recordAddr - m_baseAddress;
-            if (offset >= m_memorySize) {
+            const uint8_t* record = materialize(offset, sizeof(uint32_t));
+            if (!record) {
                 printf("Import record address out of bounds: 0x%08X\n", recordAddr);
                 continue;
             }
 
             // Read the import value
-            uint32_t value = *(uint32_t*)(m_memoryData + offset);
+            uint32_t value = *(const uint32_t*)record;
             swap32(&value);
 
             // Extract import information
@@ -677,24 +1506,22 @@ namespace XLoader
                 continue;
             }
 
-            // Determine library type
-            XboxLibrary lib = XboxLibrary::XboxKrnl;
+            XboxLibrary lib = libraries[libIndex];
             const std::string& libName = m_libraryNames[libIndex];
-            if (libName.find("xam") != std::string::npos) {
-                lib = XboxLibrary::Xam;
-            }
-            else if (libName.find("xbdm") != std::string::npos) {
-                lib = XboxLibrary::Xbdm;
-            }
-            else if (libName.find("xapi") != std::string::npos) {
-                lib = XboxLibrary::Xapi;
-            }
 
             // Create import based on type
             ImportType impType = (type == 0) ? ImportType::Variable : ImportType::Function;
 
+            // known exports get their real name, anything else is named after the ordinal
             char importName[256];
-            snprintf(importName, sizeof(importName), "%s_%u", libName.c_str(), ordinal);
+            const ImportEntry* entry = knownLibraries[libIndex] ? findImport(lib, ordinal) : nullptr;
+            if (entry) {
+                snprintf(importName, sizeof(importName), "%s", entry->name);
+                resolved++;
+            }
+            else {
+                snprintf(importName, sizeof(importName), "%s_%u", libName.c_str(), ordinal);
+            }
 
             auto import = std::make_unique<Import>(lib, impType, importName, ordinal);
 import->tableAddr = recordAddr;
@@ -709,7 +1536,7 @@ import->funcImportAddr = recordAddr;
                 ordinal);
         }
 
-        printf("  Processed %zu imports\n", m_imports.size());
+        printf("  Processed %zu imports (%zu resolved by name)\n", m_imports.size(), resolved);
         return true;
     }
 
@@ -758,6 +1585,7 @@ import->funcImportAddr = recordAddr;
                 if (entry.offset + sizeof(XEXFileCompressionInfo) <= size) {
                     XEXFileCompressionInfo compInfo;
                     memcpy(&compInfo, data + entry.offset, sizeof(compInfo));
+                    swap32(&compInfo.infoSize);
                     swap16(&compInfo.compressionType);
                     swap16(&compInfo.encryptionType);
 
@@ -770,7 +1598,7 @@ import->funcImportAddr = recordAddr;
                     // Load compression blocks if basic compression
                     if (m_compressionType == XEXCompressionType::Basic) {
                         size_t blockOffset = entry.offset + sizeof(XEXFileCompressionInfo);
-                        uint32_t blockCount = (entry.key & 0xFF) * 4;
+                        uint32_t blockCount = compInfo.infoSize;
                         if (blockCount > sizeof(XEXFileCompressionInfo)) {
                             blockCount = (blockCount - sizeof(XEXFileCompressionInfo)) / sizeof(XEXBasicCompressionBlock);
 
@@ -788,6 +1616,16 @@ import->funcImportAddr = recordAddr;
                             printf("  Loaded %u compression blocks\n", blockCount);
                         }
                     }
+                    else if (m_compressionType == XEXCompressionType::Normal) {
+                        size_t infoOffset = entry.offset + sizeof(XEXFileCompressionInfo);
+                        if (infoOffset + sizeof(XEXNormalCompressionInfo) <= size) {
+                            memcpy(&m_normalInfo, data + infoOffset, sizeof(m_normalInfo));
+                            swap32(&m_normalInfo.windowSize);
+                            swap32(&m_normalInfo.firstBlock.blockSize);
+                            printf("  LZX window: 0x%X, first block: 0x%X bytes\n",
+                                m_normalInfo.windowSize, m_normalInfo.firstBlock.blockSize);
+                        }
+                    }
                 }
                 break;
 
@@ -2,7 +2,10 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <functional>
+#include <mutex>
 #include <cstdint>
+#include "XXH3/XXH3.h"
 
 // Forward declarations
 class ImageLoader;
@@ -23,6 +26,9 @@ enum class XboxLibrary {
 
 namespace XLoader {
 
+    class MappedFile;
+    class XISOReader;
+
     // Import information
     struct Import {
         XboxLibrary library;
@@ -72,18 +78,102 @@ namespace XLoader {
         bool m_executable;
     };
 
+    // Options for loading an image
+    struct LoadOptions {
+        bool verifyDigests = true;   // check the XEX page digests while decompressing
+        bool useGuestWindow = false; // place the image at its base address inside the process wide GuestWindow
+        bool lazy = false;           // build the image memory on first access, see IImage::materialize
+
+        // called with the content hash of the file before anything is decrypted or decompressed,
+        // returning true (e.g. the translation is cached) stops the load and ImageLoader returns nullptr
+        std::function<bool(const Hash128& contentHash)> cacheLookup;
+    };
+
+    // Sizes and timings of the last load() of an image, reported by BenchmarkLoader
+    struct LoadStats {
+        size_t fileSize = 0;
+        double hashMs = 0.0;         // content hash of the file
+        size_t payloadSize = 0;      // bytes fed to the decryption / decompression stage
+        size_t imageSize = 0;
+        double totalMs = 0.0;
+        double decompressMs = 0.0;   // decryption + decompression
+        size_t verifiedBytes = 0;
+        size_t digestMismatches = 0;
+        double verifyCpuMs = 0.0;    // page digest hashing, summed over every thread
+        double verifyWaitMs = 0.0;   // time the load spent waiting for verification after decompression
+    };
+
+    // One .pdata record, the exact bounds of a function
+    struct FunctionEntry {
+        uint32_t address;      // guest address of the first instruction
+        uint32_t size;         // in bytes
+        uint32_t prologSize;   // in instructions
+        bool hasHandler;       // the function has an exception handler
+
+        uint32_t getEnd() const { return address + size; }
+        bool contains(uint32_t addr) const { return addr >= address && addr - address < size; }
+    };
+
     // Base image interface
     class IImage {
     public:
         virtual ~IImage() = default;
 
-        virtual bool load(const uint8_t* data, size_t size) = 0;
+        // <file> is the mapping <data> comes from (if any), images can map pages from it instead of copying
+        virtual bool load(const uint8_t* data, size_t size, const MappedFile* file = nullptr, const LoadOptions& options = LoadOptions()) = 0;
         virtual uint32_t getBaseAddress() const = 0;
         virtual uint32_t getEntryPoint() const = 0;
         virtual const uint8_t* getMemoryData() const = 0;
         virtual size_t getMemorySize() const = 0;
         virtual const std::vector<std::unique_ptr<Section>>& getSections() const = 0;
         virtual const std::vector<std::unique_ptr<Import>>& getImports() const = 0;
+        const LoadStats& getLoadStats() const { return m_stats; }
+
+        // Make [offset, offset + size) of the image memory (offsets from getMemoryData()) readable and return it,
+        // nullptr when the range is outside the image or its data couldn't be produced. Thread safe.
+        // Images loaded with LoadOptions::lazy build their pages here on first access (LZX compressed ones are
+        // decoded in the background and this waits for the range), other images already have everything
+        virtual const uint8_t* materialize(size_t offset, size_t size) = 0;
+
+        // materialize() for a whole section
+        const uint8_t* getSectionData(const Section& section) {
+            return materialize(section.getVirtualAddress(), section.getVirtualSize());
+        }
+
+        // XXH3-128 of the whole file, names the image in the translation cache
+        const Hash128& getContentHash() const { return m_contentHash; }
+
+        // true when the image carries page digests and all of them matched
+        virtual bool isVerified() const = 0;
+
+        // host address of guest address 0 when the image was placed in the GuestWindow, nullptr otherwise
+        // getMemoryData() is then getGuestBase() + getBaseAddress()
+        virtual uint8_t* getGuestBase() const = 0;
+
+        // Functions of the .pdata section sorted by address, empty when the image has none.
+        // The section is parsed on the first call (so lazy images only build it when asked). Thread safe.
+        const std::vector<FunctionEntry>& getFunctions();
+
+        // getFunctions() entry that contains <address>, nullptr if none
+        const FunctionEntry* findFunction(uint32_t address);
+
+        // Guest addresses of the functions the image exports, by ordinal order. Parsed on the first call like
+        // getFunctions(). Thread safe.
+        const std::vector<uint32_t>& getExports();
+
+    protected:
+        friend class ImageLoader;
+
+        void loadFunctionTable();
+        virtual void loadExports() {}
+
+        LoadStats m_stats;
+        Hash128 m_contentHash;
+        std::shared_ptr<const MappedFile> m_file;   // kept by lazy images, their pages are produced from it
+        std::once_flag m_functionsOnce;
+        std::vector<FunctionEntry> m_functions;
+        std::once_flag m_exportsOnce;
+        std::vector<uint32_t> m_exports;
     };
 
     // Image types
@@ -93,11 +183,30 @@ namespace XLoader {
         XEX2
     };
 
+    // One entry of ImageLoader::loadBatch
+    struct BatchLoadResult {
+        std::wstring path;
+        std::unique_ptr<IImage> image;   // nullptr when the load failed
+        double loadMs = 0.0;             // wall time of this image, opening the file included
+    };
+
     // Main image loader
     class ImageLoader {
     public:
-        static std::unique_ptr<IImage> load(const std::wstring& path);
-        static std::unique_ptr<IImage> loadFromMemory(const uint8_t* data, size_t size);
+        static std::unique_ptr<IImage> load(const std::wstring& path, const LoadOptions& options = LoadOptions());
+        // with LoadOptions::lazy <data> must stay valid as long as the image
+        static std::unique_ptr<IImage> loadFromMemory(const uint8_t* data, size_t size, const MappedFile* file = nullptr,
+            const LoadOptions& options = LoadOptions());
+
+        // Load every path concurrently on the global ThreadPool, results are in the order of <paths>
+        // <totalMs> (optional) receives the wall time of the whole batch
+        static std::vector<BatchLoadResult> loadBatch(const std::vector<std::wstring>& paths,
+            const LoadOptions& options = LoadOptions(), double* totalMs = nullptr);
+
+        // Load a file straight out of a disc image without extracting it, <innerPath> is relative to the disc root
+        // lazy images keep the container mapping alive
+        static std::unique_ptr<IImage> loadFromContainer(const XISOReader& container, const std::string& innerPath,
+            const LoadOptions& options = LoadOptions());
 
     private:
         static ImageType detectType(const uint8_t* data, size_t size);
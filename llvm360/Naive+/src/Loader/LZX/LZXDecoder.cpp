@@ -0,0 +1,556 @@
+#include "LZXDecoder.h"
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+namespace XLoader
+{
+    static const size_t FrameSize = 32768;
+    static const int MinMatch = 2;
+    static const int NumPrimaryLengths = 7;
+    static const int NumSecondaryLengths = 249;
+
+    enum BlockType {
+        BlockInvalid = 0,
+        BlockVerbatim = 1,
+        BlockAligned = 2,
+        BlockUncompressed = 3
+    };
+
+    // extra bits and base offset of each position slot
+    struct PositionSlots {
+        uint8_t extraBits[51];
+        uint32_t positionBase[51];
+
+        PositionSlots() {
+            for (int i = 0, j = 0; i < 51; i += 2) {
+                extraBits[i] = (uint8_t)j;
+                if (i + 1 < 51) {
+                    extraBits[i + 1] = (uint8_t)j;
+                }
+                if (i != 0 && j < 17) {
+                    j++;
+                }
+            }
+            for (int i = 0, j = 0; i < 51; i++) {
+                positionBase[i] = j;
+                j += 1 << extraBits[i];
+            }
+        }
+    };
+    static const PositionSlots g_positionSlots;
+
+    //
+    // BitReader
+    //
+
+    // 16 bit little endian words read MSB first, pulled from the input source one chunk at a time
+    class LZXDecoder::BitReader {
+    public:
+        explicit BitReader(const InputSource& input)
+            : m_input(input), m_cur(nullptr), m_end(nullptr), m_buffer(0), m_bitsLeft(0), m_overrun(0) {
+        }
+
+        void ensure(int count) {
+            while (m_bitsLeft < count) {
+                uint32_t word;
+                if (m_end - m_cur >= 2) {
+                    word = m_cur[0] | (m_cur[1] << 8);
+                    m_cur += 2;
+                }
+                else {
+                    uint32_t lo = nextByte();
+                    uint32_t hi = nextByte();
+                    word = (hi << 8) | lo;
+                }
+                m_buffer |= word << (16 - m_bitsLeft);
+                m_bitsLeft += 16;
+            }
+        }
+
+        // 1 to 17 bits
+        uint32_t peek(int count) {
+            ensure(count);
+            return m_buffer >> (32 - count);
+        }
+
+        // 1 to 16 bits, after an ensure(16)
+        uint32_t peekBuffered(int count) const {
+            return m_buffer >> (32 - count);
+        }
+
+        void remove(int count) {
+            m_buffer <<= count;
+            m_bitsLeft -= count;
+        }
+
+        uint32_t read(int count) {
+            if (count == 0) {
+                return 0;
+            }
+            uint32_t value = peek(count);
+            remove(count);
+            return value;
+        }
+
+        // drop what is left of the current 16 bit word (end of frame)
+        void alignWord() {
+            if (m_bitsLeft > 0) {
+                ensure(16);
+            }
+            if (m_bitsLeft & 15) {
+                remove(m_bitsLeft & 15);
+            }
+        }
+
+        // switch to byte mode for an uncompressed block, 1 to 16 bits are dropped
+        void alignByte() {
+            if (m_bitsLeft == 0) {
+                ensure(16);
+            }
+            m_bitsLeft = 0;
+            m_buffer = 0;
+        }
+
+        uint8_t readByte() {
+            return nextByte();
+        }
+
+        void readBytes(uint8_t* dest, size_t size) {
+            while (size > 0) {
+                if (m_cur == m_end && !refill()) {
+                    memset(dest, 0, size);
+                    m_overrun += size;
+                    return;
+                }
+                size_t take = std::min(size, (size_t)(m_end - m_cur));
+                memcpy(dest, m_cur, take);
+                m_cur += take;
+                dest += take;
+                size -= take;
+            }
+        }
+
+        // the last frame may ask for a word past the end of the data, more than that is a truncated stream
+        bool isTruncated() const { return m_overrun > 2; }
+
+    private:
+        uint8_t nextByte() {
+            if (m_cur == m_end && !refill()) {
+                m_overrun++;
+                return 0;
+            }
+            return *m_cur++;
+        }
+
+        bool refill() {
+            const uint8_t* data;
+            size_t size;
+            while (m_input(data, size)) {
+                if (size > 0) {
+                    m_cur = data;
+                    m_end = data + size;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        const InputSource& m_input;
+        const uint8_t* m_cur;
+        const uint8_t* m_end;
+        uint32_t m_buffer;
+        int m_bitsLeft;
+        size_t m_overrun;
+    };
+
+    //
+    // HuffmanTable
+    //
+
+    bool LZXDecoder::HuffmanTable::build(const uint8_t* lengths, int symbols, int bits) {
+        tableBits = bits;
+        memset(count, 0, sizeof(count));
+        for (int s = 0; s < symbols; s++) {
+            if (lengths[s] > 16) {
+                return false;
+            }
+            count[lengths[s]]++;
+        }
+        count[0] = 0;
+
+        // reject over-subscribed codes
+        int left = 1;
+        for (int len = 1; len <= 16; len++) {
+            left = (left << 1) - count[len];
+            if (left < 0) {
+                return false;
+            }
+        }
+        empty = (left == (1 << 16));
+
+        // canonical code assignment, shorter codes first and by symbol within a length
+        uint32_t code = 0;
+        uint16_t index = 0;
+        for (int len = 1; len <= 16; len++) {
+            code = (code + count[len - 1]) << 1;
+            firstCode[len] = code;
+            firstIndex[len] = index;
+            index += count[len];
+        }
+
+        uint16_t offsets[17];
+        memcpy(offsets, firstIndex, sizeof(offsets));
+        for (int s = 0; s < symbols; s++) {
+            if (lengths[s]) {
+                sorted[offsets[lengths[s]]++] = (uint16_t)s;
+            }
+        }
+
+        memset(fast, 0, sizeof(uint16_t) << tableBits);
+        for (int len = 1; len <= tableBits; len++) {
+            for (int i = 0; i < count[len]; i++) {
+                uint32_t symbol = sorted[firstIndex[len] + i];
+                uint32_t start = (firstCode[len] + i) << (tableBits - len);
+                uint32_t fill = 1u << (tableBits - len);
+                for (uint32_t j = 0; j < fill; j++) {
+                    fast[start + j] = (uint16_t)((symbol << 5) | len);
+                }
+            }
+        }
+        return true;
+    }
+
+    //
+    // LZXDecoder
+    //
+
+    LZXDecoder::LZXDecoder(uint32_t windowSize) : m_windowBits(0), m_mainElements(0) {
+        static const int positionSlots[] = { 30, 32, 34, 36, 38, 42, 50 };
+        for (uint32_t bits = 15; bits <= 21; bits++) {
+            if (windowSize == (1u << bits)) {
+                m_windowBits = bits;
+                m_mainElements = 256 + positionSlots[bits - 15] * 8;
+                break;
+            }
+        }
+        if (!m_windowBits) {
+            printf("Invalid LZX window size: 0x%08X\n", windowSize);
+        }
+    }
+
+    bool LZXDecoder::decodeSymbol(BitReader& bits, const HuffmanTable& table, int& symbol) {
+        if (table.empty) {
+            return false;
+        }
+
+        bits.ensure(16);
+        uint16_t entry = table.fast[bits.peekBuffered(table.tableBits)];
+        if (entry) {
+            bits.remove(entry & 31);
+            symbol = entry >> 5;
+            return true;
+        }
+
+        for (int len = table.tableBits + 1; len <= 16; len++) {
+            uint32_t index = bits.peekBuffered(len) - table.firstCode[len];
+            if (index < table.count[len]) {
+                bits.remove(len);
+                symbol = table.sorted[table.firstIndex[len] + index];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool LZXDecoder::readLengths(BitReader& bits, uint8_t* lengths, int first, int last) {
+        // the lengths are coded as deltas against the previous table with a 20 symbol pretree
+        uint8_t preLengths[PretreeSymbols];
+        for (int i = 0; i < PretreeSymbols; i++) {
+            preLengths[i] = (uint8_t)bits.read(4);
+        }
+        if (!m_pretree.build(preLengths, PretreeSymbols, 6)) {
+            return false;
+        }
+
+        // runs may go past <last>, the tables have LengthTableSafety spare entries for that
+        for (int x = first; x < last; ) {
+            int z;
+            if (!decodeSymbol(bits, m_pretree, z)) {
+                return false;
+            }
+
+            if (z == 17) {
+                int run = (int)bits.read(4) + 4;
+                while (run--) lengths[x++] = 0;
+            }
+            else if (z == 18) {
+                int run = (int)bits.read(5) + 20;
+                while (run--) lengths[x++] = 0;
+            }
+            else if (z == 19) {
+                int run = (int)bits.read(1) + 4;
+                if (!decodeSymbol(bits, m_pretree, z)) {
+                    return false;
+                }
+                z = lengths[x] - z;
+                if (z < 0) z += 17;
+                while (run--) lengths[x++] = (uint8_t)z;
+            }
+            else {
+                z = lengths[x] - z;
+                if (z < 0) z += 17;
+                lengths[x++] = (uint8_t)z;
+            }
+        }
+        return true;
+    }
+
+    bool LZXDecoder::readBlockHeader(BitReader& bits) {
+        // uncompressed blocks of odd length are padded to a 16 bit boundary
+        if (m_blockType == BlockUncompressed && (m_blockLength & 1)) {
+            bits.readByte();
+        }
+
+        m_blockType = (int)bits.read(3);
+        uint32_t hi = bits.read(16);
+        uint32_t lo = bits.read(8);
+        m_blockRemaining = m_blockLength = (hi << 8) | lo;
+
+        switch (m_blockType) {
+        case BlockAligned:
+            for (int i = 0; i < AlignedTreeSymbols; i++) {
+                m_alignedLengths[i] = (uint8_t)bits.read(3);
+            }
+            if (!m_alignedTree.build(m_alignedLengths, AlignedTreeSymbols, 7)) {
+                printf("LZX: invalid aligned tree\n");
+                return false;
+            }
+            [[fallthrough]];
+
+        case BlockVerbatim:
+            if (!readLengths(bits, m_mainLengths, 0, 256) ||
+                !readLengths(bits, m_mainLengths, 256, m_mainElements) ||
+                !m_mainTree.build(m_mainLengths, m_mainElements, 12) || m_mainTree.empty) {
+                printf("LZX: invalid main tree\n");
+                return false;
+            }
+            if (m_mainLengths[0xE8] != 0) {
+                m_intelStarted = true;
+            }
+            // the length tree can legitimately be empty if the block has no long matches
+            if (!readLengths(bits, m_lengthLengths, 0, NumSecondaryLengths) ||
+                !m_lengthTree.build(m_lengthLengths, NumSecondaryLengths, 12)) {
+                printf("LZX: invalid length tree\n");
+                return false;
+            }
+            break;
+
+        case BlockUncompressed:
+        {
+            m_intelStarted = true;
+            bits.alignByte();
+            uint8_t header[12];
+            bits.readBytes(header, sizeof(header));
+            m_R0 = header[0] | (header[1] << 8) | (header[2] << 16) | ((uint32_t)header[3] << 24);
+            m_R1 = header[4] | (header[5] << 8) | (header[6] << 16) | ((uint32_t)header[7] << 24);
+            m_R2 = header[8] | (header[9] << 8) | (header[10] << 16) | ((uint32_t)header[11] << 24);
+            break;
+        }
+
+        default:
+            printf("LZX: bad block type %d\n", m_blockType);
+            return false;
+        }
+
+        return true;
+    }
+
+    void LZXDecoder::translateE8(uint8_t* data, size_t size, size_t position, int32_t fileSize) {
+        // undo the x86 call translation, a no-op for PowerPC images unless the header asked for it
+        uint8_t* end = data + size - 10;
+        int32_t current = (int32_t)position;
+        while (data < end) {
+            if (*data++ != 0xE8) {
+                current++;
+                continue;
+            }
+            int32_t absOffset = (int32_t)(data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24));
+            if (absOffset >= -current && absOffset < fileSize) {
+                int32_t relOffset = (absOffset >= 0) ? absOffset - current : absOffset + fileSize;
+                data[0] = (uint8_t)relOffset;
+                data[1] = (uint8_t)(relOffset >> 8);
+                data[2] = (uint8_t)(relOffset >> 16);
+                data[3] = (uint8_t)(relOffset >> 24);
+            }
+            data += 4;
+            current += 5;
+        }
+    }
+
+    bool LZXDecoder::decompress(const InputSource& input, uint8_t* output, size_t outputSize, const ProgressCallback& progress) {
+        if (!isValid()) {
+            return false;
+        }
+
+        BitReader bits(input);
+
+        m_R0 = m_R1 = m_R2 = 1;
+        m_blockType = BlockInvalid;
+        m_blockRemaining = 0;
+        m_blockLength = 0;
+        m_intelStarted = false;
+        memset(m_mainLengths, 0, sizeof(m_mainLengths));
+        memset(m_lengthLengths, 0, sizeof(m_lengthLengths));
+
+        // stream header: optional E8 translation file size
+        m_intelFileSize = 0;
+        if (bits.read(1)) {
+            uint32_t hi = bits.read(16);
+            uint32_t lo = bits.read(16);
+            m_intelFileSize = (int32_t)((hi << 16) | lo);
+        }
+
+        size_t pos = 0;
+        size_t frame = 0;
+        size_t firstE8Frame = SIZE_MAX;
+
+        while (pos < outputSize) {
+            size_t frameEnd = pos + std::min(FrameSize, outputSize - pos);
+
+            while (pos < frameEnd) {
+                if (m_blockRemaining == 0 && !readBlockHeader(bits)) {
+                    return false;
+                }
+
+                size_t runStart = pos;
+                size_t runEnd = pos + std::min(m_blockRemaining, frameEnd - pos);
+
+                if (m_blockType == BlockUncompressed) {
+                    bits.readBytes(output + pos, runEnd - pos);
+                    pos = runEnd;
+                }
+                else {
+                    const bool aligned = (m_blockType == BlockAligned);
+                    while (pos < runEnd) {
+                        int symbol;
+                        if (!decodeSymbol(bits, m_mainTree, symbol)) {
+                            printf("LZX: bad main tree symbol at 0x%zX\n", pos);
+                            return false;
+                        }
+
+                        if (symbol < 256) {
+                            output[pos++] = (uint8_t)symbol;
+                            continue;
+                        }
+
+                        symbol -= 256;
+                        uint32_t matchLength = symbol & NumPrimaryLengths;
+                        if (matchLength == NumPrimaryLengths) {
+                            int footer;
+                            if (!decodeSymbol(bits, m_lengthTree, footer)) {
+                                printf("LZX: bad length tree symbol at 0x%zX\n", pos);
+                                return false;
+                            }
+                            matchLength += footer;
+                        }
+                        matchLength += MinMatch;
+
+                        uint32_t slot = symbol >> 3;
+                        uint32_t matchOffset;
+                        if (slot > 2) {
+                            uint32_t extra = (slot >= 36) ? 17 : g_positionSlots.extraBits[slot];
+                            matchOffset = g_positionSlots.positionBase[slot] - 2;
+                            if (aligned && extra >= 3) {
+                                // the low 3 bits come from the aligned offset tree
+                                matchOffset += bits.read(extra - 3) << 3;
+                                int alignedBits;
+                                if (!decodeSymbol(bits, m_alignedTree, alignedBits)) {
+                                    printf("LZX: bad aligned tree symbol at 0x%zX\n", pos);
+                                    return false;
+                                }
+                                matchOffset += alignedBits;
+                            }
+                            else if (extra > 0) {
+                                matchOffset += bits.read(extra);
+                            }
+                            else {
+                                matchOffset = 1;
+                            }
+                            m_R2 = m_R1;
+                            m_R1 = m_R0;
+                            m_R0 = matchOffset;
+                        }
+                        else if (slot == 0) {
+                            matchOffset = m_R0;
+                        }
+                        else if (slot == 1) {
+                            matchOffset = m_R1;
+                            m_R1 = m_R0;
+                            m_R0 = matchOffset;
+                        }
+                        else {
+                            matchOffset = m_R2;
+                            m_R2 = m_R0;
+                            m_R0 = matchOffset;
+                        }
+
+                        // matches never reach before the start of the stream or across a frame
+                        if (matchOffset == 0 || matchOffset > pos || pos + matchLength > frameEnd) {
+                            printf("LZX: invalid match (offset 0x%X, length %u) at 0x%zX\n", matchOffset, matchLength, pos);
+                            return false;
+                        }
+
+                        uint8_t* dest = output + pos;
+                        const uint8_t* src = dest - matchOffset;
+                        if (matchOffset >= matchLength) {
+                            memcpy(dest, src, matchLength);
+                        }
+                        else {
+                            for (uint32_t i = 0; i < matchLength; i++) {
+                                dest[i] = src[i];
+                            }
+                        }
+                        pos += matchLength;
+                    }
+                }
+
+                // the last match can run past the planned run, but not past the block
+                size_t decoded = pos - runStart;
+                if (decoded > m_blockRemaining) {
+                    printf("LZX: match overruns block at 0x%zX\n", pos);
+                    return false;
+                }
+                m_blockRemaining -= decoded;
+            }
+
+            bits.alignWord();
+            if (bits.isTruncated()) {
+                printf("LZX: compressed stream is truncated (frame %zu)\n", frame);
+                return false;
+            }
+
+            if (m_intelStarted && firstE8Frame == SIZE_MAX) {
+                firstE8Frame = frame;
+            }
+            frame++;
+
+            // frames that still need the E8 pass aren't final yet
+            if (progress && (m_intelFileSize == 0 || firstE8Frame == SIZE_MAX)) {
+                progress(pos);
+            }
+        }
+
+        if (m_intelFileSize != 0 && firstE8Frame != SIZE_MAX) {
+            for (size_t f = firstE8Frame; f < frame && f < 32768; f++) {
+                size_t start = f * FrameSize;
+                size_t size = std::min(FrameSize, outputSize - start);
+                if (size > 10) {
+                    translateE8(output + start, size, start, m_intelFileSize);
+                }
+            }
+        }
+
+        return true;
+    }
+}
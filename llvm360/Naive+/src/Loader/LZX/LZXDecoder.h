@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+namespace XLoader
+{
+    // Streaming LZX decoder, the flavour used by XEX2 "normal" compression (same bitstream as CAB/libmspack lzxd)
+    // The output buffer is the sliding window: matches are copied from the bytes already written,
+    // so the only state kept besides the huffman tables is the current input chunk
+    class LZXDecoder {
+    public:
+        // hands out the next piece of compressed input, returns false when there is none left
+        using InputSource = std::function<bool(const uint8_t*& data, size_t& size)>;
+
+        // <windowSize> is a power of two between 32KB and 2MB
+        explicit LZXDecoder(uint32_t windowSize);
+
+        bool isValid() const { return m_windowBits != 0; }
+
+        // called after each 32KB frame with the number of output bytes that are final
+        using ProgressCallback = std::function<void(size_t decoded)>;
+
+        // decode exactly <outputSize> bytes into <output>
+        bool decompress(const InputSource& input, uint8_t* output, size_t outputSize, const ProgressCallback& progress = nullptr);
+
+    private:
+        static const int MainTreeMaxSymbols = 256 + 50 * 8;
+        static const int LengthTreeSymbols = 249 + 1;
+        static const int PretreeSymbols = 20;
+        static const int AlignedTreeSymbols = 8;
+        static const int LengthTableSafety = 64;
+
+        // canonical huffman code with a direct lookup for the short codes
+        struct HuffmanTable {
+            int tableBits = 0;
+            bool empty = true;
+            uint16_t fast[1 << 12];           // (symbol << 5) | length, 0 = longer than tableBits
+            uint16_t count[17];
+            uint16_t firstCode[17];
+            uint16_t firstIndex[17];
+            uint16_t sorted[MainTreeMaxSymbols];
+
+            bool build(const uint8_t* lengths, int symbols, int bits);
+        };
+
+        class BitReader;
+
+        bool readLengths(BitReader& bits, uint8_t* lengths, int first, int last);
+        bool decodeSymbol(BitReader& bits, const HuffmanTable& table, int& symbol);
+        bool readBlockHeader(BitReader& bits);
+        static void translateE8(uint8_t* data, size_t size, size_t position, int32_t fileSize);
+
+        uint32_t m_windowBits;
+        int m_mainElements;
+
+        // persistent state
+        uint32_t m_R0, m_R1, m_R2;
+        int m_blockType;
+        size_t m_blockRemaining;
+        size_t m_blockLength;
+        int32_t m_intelFileSize;
+        bool m_intelStarted;
+
+        uint8_t m_mainLengths[MainTreeMaxSymbols + LengthTableSafety];
+        uint8_t m_lengthLengths[LengthTreeSymbols + LengthTableSafety];
+        uint8_t m_alignedLengths[AlignedTreeSymbols];
+        HuffmanTable m_mainTree;
+        HuffmanTable m_lengthTree;
+        HuffmanTable m_alignedTree;
+        HuffmanTable m_pretree;
+    };
+}
@@ -0,0 +1,324 @@
+#include "MappedFile.h"
+#include <cstring>
+#include <cstdio>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <locale>
+#include <codecvt>
+#endif
+
+namespace XLoader
+{
+    //
+    // MappedFile
+    //
+
+#ifdef _WIN32
+    MappedFile::MappedFile() : m_data(nullptr), m_size(0), m_file(INVALID_HANDLE_VALUE), m_mapping(nullptr) {}
+
+    MappedFile::~MappedFile() {
+        if (m_data) {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mapping) {
+            CloseHandle(m_mapping);
+        }
+        if (m_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(m_file);
+        }
+    }
+
+    std::unique_ptr<MappedFile> MappedFile::open(const std::wstring& path) {
+        auto file = std::make_unique<MappedFile>();
+
+        file->m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file->m_file == INVALID_HANDLE_VALUE) {
+            return nullptr;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file->m_file, &fileSize)) {
+            return nullptr;
+        }
+        file->m_size = (size_t)fileSize.QuadPart;
+        if (file->m_size == 0) {
+            return file;
+        }
+
+        file->m_mapping = CreateFileMappingW(file->m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!file->m_mapping) {
+            return nullptr;
+        }
+
+        file->m_data = (const uint8_t*)MapViewOfFile(file->m_mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!file->m_data) {
+            return nullptr;
+        }
+
+        return file;
+    }
+
+    bool MappedFile::mapPrivate(uint8_t* dest, size_t offset, size_t size) const {
+        // a view can't be placed inside an already reserved region without placeholders,
+        // ImageMemory falls back to copying
+        return false;
+    }
+#else
+    MappedFile::MappedFile() : m_data(nullptr), m_size(0), m_fd(-1) {}
+
+    MappedFile::~MappedFile() {
+        if (m_data) {
+            munmap((void*)m_data, m_size);
+        }
+        if (m_fd >= 0) {
+            close(m_fd);
+        }
+    }
+
+    std::unique_ptr<MappedFile> MappedFile::open(const std::wstring& path) {
+        auto file = std::make_unique<MappedFile>();
+
+        std::string utf8Path = std::wstring_convert<std::codecvt_utf8<wchar_t>>().to_bytes(path);
+        file->m_fd = ::open(utf8Path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file->m_fd < 0) {
+            return nullptr;
+        }
+
+        struct stat st;
+        if (fstat(file->m_fd, &st) != 0) {
+            return nullptr;
+        }
+        file->m_size = (size_t)st.st_size;
+        if (file->m_size == 0) {
+            return file;
+        }
+
+        void* view = mmap(nullptr, file->m_size, PROT_READ, MAP_PRIVATE, file->m_fd, 0);
+        if (view == MAP_FAILED) {
+            return nullptr;
+        }
+        // headers and compressed data are mostly read front to back
+        madvise(view, file->m_size, MADV_SEQUENTIAL);
+        file->m_data = (const uint8_t*)view;
+
+        return file;
+    }
+
+    bool MappedFile::mapPrivate(uint8_t* dest, size_t offset, size_t size) const {
+        if (offset > m_size || size > m_size - offset) {
+            return false;
+        }
+
+        void* view = mmap(dest, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, m_fd, (off_t)offset);
+        return view != MAP_FAILED;
+    }
+#endif
+
+
+    //
+    // ImageMemory
+    //
+
+    size_t ImageMemory::pageSize() {
+        static const size_t size = [] {
+#ifdef _WIN32
+            SYSTEM_INFO info;
+            GetSystemInfo(&info);
+            return (size_t)info.dwPageSize;
+#else
+            return (size_t)sysconf(_SC_PAGESIZE);
+#endif
+        }();
+        return size;
+    }
+
+    //
+    // GuestWindow
+    //
+
+    GuestWindow* GuestWindow::get() {
+        static GuestWindow* window = []() -> GuestWindow* {
+#ifdef _WIN32
+            void* mem = VirtualAlloc((void*)PreferredBase, Size, MEM_RESERVE, PAGE_NOACCESS);
+            if (!mem) {
+                mem = VirtualAlloc(nullptr, Size, MEM_RESERVE, PAGE_NOACCESS);
+            }
+            if (!mem) {
+                printf("Failed to reserve the guest address space\n");
+                return nullptr;
+            }
+#else
+            int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+#ifdef MAP_FIXED_NOREPLACE
+            void* mem = mmap((void*)PreferredBase, Size, PROT_NONE, flags | MAP_FIXED_NOREPLACE, -1, 0);
+#else
+            void* mem = mmap((void*)PreferredBase, Size, PROT_NONE, flags, -1, 0);
+#endif
+            if (mem == MAP_FAILED) {
+                mem = mmap(nullptr, Size, PROT_NONE, flags, -1, 0);
+            }
+            if (mem == MAP_FAILED) {
+                printf("Failed to reserve the guest address space\n");
+                return nullptr;
+            }
+#endif
+            return new GuestWindow((uint8_t*)mem);
+        }();
+        return window;
+    }
+
+    bool GuestWindow::claim(uint32_t guestAddress, size_t size) {
+        uint64_t start = guestAddress;
+        uint64_t end = start + size;
+        if (end > Size) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const Claim& claim : m_claims) {
+            if (start < claim.end && claim.start < end) {
+                return false;
+            }
+        }
+        m_claims.push_back({ start, end });
+        return true;
+    }
+
+    void GuestWindow::unclaim(uint32_t guestAddress) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (size_t i = 0; i < m_claims.size(); i++) {
+            if (m_claims[i].start == guestAddress) {
+                m_claims.erase(m_claims.begin() + i);
+                return;
+            }
+        }
+    }
+
+    //
+    // ImageMemory
+    //
+
+    bool ImageMemory::allocate(size_t size) {
+        release();
+        if (size == 0) {
+            return false;
+        }
+
+        size_t mask = pageSize() - 1;
+        size_t allocSize = (size + mask) & ~mask;
+#ifdef _WIN32
+        void* mem = VirtualAlloc(nullptr, allocSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+        if (!mem) {
+            return false;
+        }
+#else
+        void* mem = mmap(nullptr, allocSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mem == MAP_FAILED) {
+            return false;
+        }
+#endif
+        m_data = (uint8_t*)mem;
+        m_size = size;
+        m_mappedBytes = 0;
+        return true;
+    }
+
+    bool ImageMemory::allocateAt(GuestWindow& window, uint32_t guestAddress, size_t size) {
+        release();
+        size_t mask = pageSize() - 1;
+        if (size == 0 || (guestAddress & mask) != 0) {
+            return false;
+        }
+
+        size_t allocSize = (size + mask) & ~mask;
+        if (!window.claim(guestAddress, allocSize)) {
+            printf("Guest range 0x%08X-0x%08llX is not available\n", guestAddress, (unsigned long long)guestAddress + allocSize);
+            return false;
+        }
+
+        // fresh zero pages over the reservation
+        uint8_t* dest = window.translate(guestAddress);
+#ifdef _WIN32
+        if (!VirtualAlloc(dest, allocSize, MEM_COMMIT, PAGE_READWRITE)) {
+            window.unclaim(guestAddress);
+            return false;
+        }
+#else
+        if (mmap(dest, allocSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED) {
+            window.unclaim(guestAddress);
+            return false;
+        }
+#endif
+        m_data = dest;
+        m_size = size;
+        m_mappedBytes = 0;
+        m_window = &window;
+        m_guestAddress = guestAddress;
+        return true;
+    }
+
+    void ImageMemory::release() {
+        if (!m_data) {
+            return;
+        }
+        if (m_window) {
+            // give the pages back but keep the address space reserved
+            size_t mask = pageSize() - 1;
+            size_t allocSize = (m_size + mask) & ~mask;
+#ifdef _WIN32
+            VirtualFree(m_data, allocSize, MEM_DECOMMIT);
+#else
+            mmap(m_data, allocSize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+#endif
+            m_window->unclaim(m_guestAddress);
+            m_window = nullptr;
+            m_guestAddress = 0;
+            m_data = nullptr;
+            m_size = 0;
+            m_mappedBytes = 0;
+            return;
+        }
+#ifdef _WIN32
+        VirtualFree(m_data, 0, MEM_RELEASE);
+#else
+        size_t mask = pageSize() - 1;
+        munmap(m_data, (m_size + mask) & ~mask);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+        m_mappedBytes = 0;
+    }
+
+    bool ImageMemory::load(size_t offset, const uint8_t* src, size_t size, const MappedFile* file) {
+        if (!m_data || offset > m_size || size > m_size - offset) {
+            return false;
+        }
+
+        uint8_t* dst = m_data + offset;
+        if (file && file->contains(src, size)) {
+            // the file offset and the image offset need the same alignment inside a page,
+            // in that case copy the unaligned head and tail and map every whole page in between
+            size_t mask = pageSize() - 1;
+            size_t fileOffset = src - file->data();
+            if ((fileOffset & mask) == (offset & mask)) {
+                size_t head = (pageSize() - (offset & mask)) & mask;
+                if (head < size) {
+                    size_t body = (size - head) & ~mask;
+                    if (body > 0 && file->mapPrivate(dst + head, fileOffset + head, body)) {
+                        memcpy(dst, src, head);
+                        memcpy(dst + head + body, src + head + body, size - head - body);
+                        m_mappedBytes += body;
+                        return true;
+                    }
+                }
+            }
+        }
+
+        memcpy(dst, src, size);
+        return true;
+    }
+}
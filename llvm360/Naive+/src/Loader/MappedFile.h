@@ -0,0 +1,118 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+namespace XLoader
+{
+    // Read-only view of a file on disk
+    // nothing is read upfront, pages are faulted in by the OS only when they are touched
+    class MappedFile {
+    public:
+        MappedFile();
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        static std::unique_ptr<MappedFile> open(const std::wstring& path);
+
+        const uint8_t* data() const { return m_data; }
+        size_t size() const { return m_size; }
+
+        bool contains(const uint8_t* ptr, size_t size) const {
+            return ptr >= m_data && size <= m_size && (size_t)(ptr - m_data) <= m_size - size;
+        }
+
+        // Map <size> bytes of the file at <offset> as a private (copy-on-write) view over <dest>
+        // <dest>, <offset> and <size> must be page aligned and <dest> must live inside an ImageMemory
+        bool mapPrivate(uint8_t* dest, size_t offset, size_t size) const;
+
+    private:
+        const uint8_t* m_data;
+        size_t m_size;
+#ifdef _WIN32
+        HANDLE m_file;
+        HANDLE m_mapping;
+#else
+        int m_fd;
+#endif
+    };
+
+    // 4GB reservation mirroring the 32 bit guest address space, guest address X lives at base() + X
+    // nothing is committed until an ImageMemory is placed inside it, so it only costs address space.
+    // One window is shared by the whole process so every module sees the same guest -> host offset
+    class GuestWindow {
+    public:
+        static const uint64_t Size = 0x100000000ull;
+
+        // reserved on first use, nullptr if the host can't provide 4GB of address space
+        static GuestWindow* get();
+
+        uint8_t* base() const { return m_base; }
+        uint8_t* translate(uint32_t guestAddress) const { return m_base + guestAddress; }
+
+        // true when the window sits at PreferredBase, so the offset is the same on every run
+        bool isAtPreferredBase() const { return (uint64_t)m_base == PreferredBase; }
+        static const uint64_t PreferredBase = 0x100000000ull;
+
+        // mark [guestAddress, guestAddress + size) as used, fails if it overlaps another image
+        bool claim(uint32_t guestAddress, size_t size);
+        void unclaim(uint32_t guestAddress);
+
+    private:
+        explicit GuestWindow(uint8_t* base) : m_base(base) {}
+
+        struct Claim {
+            uint64_t start;
+            uint64_t end;
+        };
+
+        uint8_t* m_base;
+        std::mutex m_mutex;
+        std::vector<Claim> m_claims;
+    };
+
+    // Host memory holding a loaded image
+    // it starts as an anonymous zero filled mapping, so pages that are never written are never resident,
+    // data can be copied in, or mapped copy-on-write straight from a MappedFile when the layout allows it
+    class ImageMemory {
+    public:
+        ImageMemory() : m_data(nullptr), m_size(0), m_mappedBytes(0), m_window(nullptr), m_guestAddress(0) {}
+        ~ImageMemory() { release(); }
+
+        ImageMemory(const ImageMemory&) = delete;
+        ImageMemory& operator=(const ImageMemory&) = delete;
+
+        bool allocate(size_t size);
+        // commit the memory at <guestAddress> inside <window> instead of anywhere in the host address space
+        bool allocateAt(GuestWindow& window, uint32_t guestAddress, size_t size);
+        void release();
+
+        // Place <size> bytes from <src> at <offset> in the image
+        // if <src> lives inside <file>, whole pages are mapped from the file instead of copied
+        bool load(size_t offset, const uint8_t* src, size_t size, const MappedFile* file);
+
+        uint8_t* data() const { return m_data; }
+        size_t size() const { return m_size; }
+        size_t mappedBytes() const { return m_mappedBytes; }
+
+        // host address of guest address 0 when the memory lives in the guest window, nullptr otherwise
+        uint8_t* guestBase() const { return m_window ? m_window->base() : nullptr; }
+
+        static size_t pageSize();
+
+    private:
+        uint8_t* m_data;
+        size_t m_size;
+        size_t m_mappedBytes;
+        GuestWindow* m_window;
+        uint32_t m_guestAddress;
+    };
+}
@@ -1,9 +1,10 @@
 #pragma once
 #include "ImageLoader.h"
+#include "MappedFile.h"
 #ifdef _WIN32
 #include <windows.h>
 #else
-typedef unsigned long DWORD;
+typedef uint32_t DWORD;
 typedef struct _IMAGE_DATA_DIRECTORY {
   DWORD VirtualAddress;
   DWORD Size;
@@ -107,27 +108,30 @@ namespace XLoader
 
     class PEImage : public IImage {
     public:
-        PEImage() : m_baseAddress(0), m_entryPoint(0), m_memoryData(nullptr), m_memorySize(0) {}
+        PEImage() : m_baseAddress(0), m_entryPoint(0), m_useGuestWindow(false) {}
         ~PEImage() override;
 
-        bool load(const uint8_t* data, size_t size) override;
+        bool load(const uint8_t* data, size_t size, const MappedFile* file = nullptr, const LoadOptions& options = LoadOptions()) override;
         uint32_t getBaseAddress() const override { return m_baseAddress; }
         uint32_t getEntryPoint() const override { return m_entryPoint; }
-        const uint8_t* getMemoryData() const override { return m_memoryData; }
-        size_t getMemorySize() const override { return m_memorySize; }
+        const uint8_t* getMemoryData() const override { return m_memory.data(); }
+        size_t getMemorySize() const override { return m_memory.size(); }
         const std::vector<std::unique_ptr<XLoader::Section>>& getSections() const override { return m_sections; }
         const std::vector<std::unique_ptr<Import>>& getImports() const override { return m_imports; }
+        bool isVerified() const override { return false; }
+        uint8_t* getGuestBase() const override { return m_memory.guestBase(); }
+        const uint8_t* materialize(size_t offset, size_t size) override;
 
     private:
         bool loadHeaders(const uint8_t* data, size_t size);
         bool loadSections(const uint8_t* data, size_t size);
         bool loadImports(const uint8_t* data, size_t size);
-        void buildMemoryImage(const uint8_t* data, size_t size);
+        bool buildMemoryImage(const uint8_t* data, size_t size, const MappedFile* file);
 
         uint32_t m_baseAddress;
         uint32_t m_entryPoint;
-        uint8_t* m_memoryData;
-        size_t m_memorySize;
+        ImageMemory m_memory;
+        bool m_useGuestWindow;
 
         DOSHeader m_dosHeader;
         COFFHeader m_coffHeader;
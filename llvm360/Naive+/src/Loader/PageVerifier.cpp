@@ -0,0 +1,132 @@
+#include "PageVerifier.h"
+#include "SHA1/SHA1.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <cstring>
+#include <cstdio>
+
+namespace XLoader
+{
+    struct PageVerifier::State {
+        const uint8_t* memory = nullptr;
+        std::vector<Range> ranges;
+
+        std::atomic<size_t> ready{ 0 };       // ranges that can be claimed
+        std::atomic<size_t> next{ 0 };        // next range to claim
+        std::atomic<size_t> active{ 0 };      // ranges being hashed right now
+        std::atomic<size_t> done{ 0 };
+        std::atomic<size_t> mismatches{ 0 };
+        std::atomic<size_t> verifiedBytes{ 0 };
+        std::atomic<int64_t> cpuNs{ 0 };
+
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+
+    PageVerifier::PageVerifier(const uint8_t* memory, std::vector<Range> ranges)
+        : m_state(std::make_shared<State>()), m_finished(false) {
+        m_state->memory = memory;
+        m_state->ranges = std::move(ranges);
+    }
+
+    PageVerifier::~PageVerifier() {
+        if (!m_finished) {
+            cancel();
+        }
+    }
+
+    void PageVerifier::drain(State& state) {
+        for (;;) {
+            state.active++;
+            size_t i = state.next.load();
+            if (i >= state.ready.load() || !state.next.compare_exchange_weak(i, i + 1)) {
+                bool more = i < state.ready.load();
+                if (--state.active == 0) {
+                    std::lock_guard<std::mutex> lock(state.mutex);
+                    state.cv.notify_all();
+                }
+                if (more) {
+                    continue;
+                }
+                return;
+            }
+
+            const Range& range = state.ranges[i];
+            auto start = std::chrono::steady_clock::now();
+            uint8_t digest[20];
+            SHA1::hash(state.memory + range.offset, range.size, digest);
+            state.cpuNs += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+            if (memcmp(digest, range.digest, sizeof(digest)) != 0) {
+                state.mismatches++;
+                printf("Page digest mismatch at 0x%08zX (0x%zX bytes)\n", range.offset, range.size);
+            }
+            else {
+                state.verifiedBytes += range.size;
+            }
+
+            state.done++;
+            if (--state.active == 0) {
+                std::lock_guard<std::mutex> lock(state.mutex);
+                state.cv.notify_all();
+            }
+        }
+    }
+
+    void PageVerifier::notifyReady(size_t ready) {
+        State& state = *m_state;
+        size_t count = state.ready.load();
+        size_t before = count;
+        while (count < state.ranges.size() && state.ranges[count].offset + state.ranges[count].size <= ready) {
+            count++;
+        }
+        if (count == before) {
+            return;
+        }
+        state.ready.store(count);
+
+        // wake at most one worker per new range, the caller keeps decompressing
+        ThreadPool& pool = ThreadPool::global();
+        size_t helpers = std::min(count - before, pool.getConcurrency() - 1);
+        std::shared_ptr<State> shared = m_state;
+        for (size_t i = 0; i < helpers; i++) {
+            pool.submit([shared] { drain(*shared); });
+        }
+    }
+
+    size_t PageVerifier::finish() {
+        State& state = *m_state;
+        notifyReady(SIZE_MAX);
+        drain(state);
+
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.cv.wait(lock, [&] { return state.done.load() == state.ranges.size(); });
+        m_finished = true;
+        return state.mismatches.load();
+    }
+
+    void PageVerifier::cancel() {
+        State& state = *m_state;
+        state.ready.store(0);
+        state.next.store(state.ranges.size());
+
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.cv.wait(lock, [&] { return state.active.load() == 0; });
+        m_finished = true;
+    }
+
+    size_t PageVerifier::getRangeCount() const {
+        return m_state->ranges.size();
+    }
+
+    size_t PageVerifier::getVerifiedBytes() const {
+        return m_state->verifiedBytes.load();
+    }
+
+    double PageVerifier::getCpuMs() const {
+        return m_state->cpuNs.load() / 1000000.0;
+    }
+}
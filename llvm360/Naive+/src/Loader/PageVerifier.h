@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <memory>
+
+namespace XLoader
+{
+    // Checks the SHA-1 digests of consecutive page ranges of an image on the thread pool
+    // ranges are queued as soon as the decompressor reports them complete, so hashing overlaps with decoding
+    class PageVerifier {
+    public:
+        struct Range {
+            size_t offset;
+            size_t size;
+            uint8_t digest[20];
+        };
+
+        PageVerifier(const uint8_t* memory, std::vector<Range> ranges);
+        ~PageVerifier();
+
+        PageVerifier(const PageVerifier&) = delete;
+        PageVerifier& operator=(const PageVerifier&) = delete;
+
+        // bytes [0, <ready>) of the image are final, the ranges they cover can be verified
+        void notifyReady(size_t ready);
+
+        // verify what is left on the calling thread, wait for the pool and return the number of mismatching ranges
+        size_t finish();
+
+        // stop verifying (the image is being thrown away) and wait for the ranges in flight
+        void cancel();
+
+        size_t getRangeCount() const;
+        size_t getVerifiedBytes() const;
+        double getCpuMs() const;   // hashing time summed over every thread
+
+    private:
+        struct State;
+        static void drain(State& state);
+
+        std::shared_ptr<State> m_state;
+        bool m_finished;
+    };
+}
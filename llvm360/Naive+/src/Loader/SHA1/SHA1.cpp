@@ -0,0 +1,236 @@
+#include "SHA1.h"
+#include "CpuFeatures.h"
+#include <cstring>
+
+namespace XLoader
+{
+    static inline uint32_t rol32(uint32_t value, int bits) {
+        return (value << bits) | (value >> (32 - bits));
+    }
+
+    static inline uint32_t loadBE32(const uint8_t* p) {
+        return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    }
+
+    //
+    // SHA-NI kernel
+    //
+
+#if HOST_X86
+    // 4 rounds of the message schedule / compression pipeline, <a> and <b> alternate between calls
+#define SHA1_ROUNDS4(a, b, m0, m1, m2, m3, f)       \
+        a = _mm_sha1nexte_epu32(a, m0);             \
+        b = abcd;                                   \
+        m1 = _mm_sha1msg2_epu32(m1, m0);            \
+        abcd = _mm_sha1rnds4_epu32(abcd, a, f);     \
+        m3 = _mm_sha1msg1_epu32(m3, m0);            \
+        m2 = _mm_xor_si128(m2, m0)
+
+    TARGET_ATTR("sha,sse4.1,ssse3")
+    static void compressSHANI(uint32_t state[5], const uint8_t* blocks, size_t count) {
+        const __m128i byteSwap = _mm_set_epi64x(0x0001020304050607ULL, 0x08090A0B0C0D0E0FULL);
+
+        __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)state), 0x1B);
+        __m128i e0 = _mm_set_epi32((int)state[4], 0, 0, 0);
+        __m128i e1;
+
+        for (size_t b = 0; b < count; b++) {
+            const __m128i* block = (const __m128i*)(blocks + b * 64);
+            __m128i abcdSave = abcd;
+            __m128i eSave = e0;
+
+            // rounds 0-15 load the message
+            __m128i msg0 = _mm_shuffle_epi8(_mm_loadu_si128(block + 0), byteSwap);
+            e0 = _mm_add_epi32(e0, msg0);
+            e1 = abcd;
+            abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+            __m128i msg1 = _mm_shuffle_epi8(_mm_loadu_si128(block + 1), byteSwap);
+            e1 = _mm_sha1nexte_epu32(e1, msg1);
+            e0 = abcd;
+            abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+            msg0 = _mm_sha1msg1_epu32(msg0, msg1);
+
+            __m128i msg2 = _mm_shuffle_epi8(_mm_loadu_si128(block + 2), byteSwap);
+            e0 = _mm_sha1nexte_epu32(e0, msg2);
+            e1 = abcd;
+            abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+            msg1 = _mm_sha1msg1_epu32(msg1, msg2);
+            msg0 = _mm_xor_si128(msg0, msg2);
+
+            __m128i msg3 = _mm_shuffle_epi8(_mm_loadu_si128(block + 3), byteSwap);
+            e1 = _mm_sha1nexte_epu32(e1, msg3);
+            e0 = abcd;
+            msg0 = _mm_sha1msg2_epu32(msg0, msg3);
+            abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+            msg2 = _mm_sha1msg1_epu32(msg2, msg3);
+            msg1 = _mm_xor_si128(msg1, msg3);
+
+            // rounds 16-67
+            SHA1_ROUNDS4(e0, e1, msg0, msg1, msg2, msg3, 0);
+            SHA1_ROUNDS4(e1, e0, msg1, msg2, msg3, msg0, 1);
+            SHA1_ROUNDS4(e0, e1, msg2, msg3, msg0, msg1, 1);
+            SHA1_ROUNDS4(e1, e0, msg3, msg0, msg1, msg2, 1);
+            SHA1_ROUNDS4(e0, e1, msg0, msg1, msg2, msg3, 1);
+            SHA1_ROUNDS4(e1, e0, msg1, msg2, msg3, msg0, 1);
+            SHA1_ROUNDS4(e0, e1, msg2, msg3, msg0, msg1, 2);
+            SHA1_ROUNDS4(e1, e0, msg3, msg0, msg1, msg2, 2);
+            SHA1_ROUNDS4(e0, e1, msg0, msg1, msg2, msg3, 2);
+            SHA1_ROUNDS4(e1, e0, msg1, msg2, msg3, msg0, 2);
+            SHA1_ROUNDS4(e0, e1, msg2, msg3, msg0, msg1, 2);
+            SHA1_ROUNDS4(e1, e0, msg3, msg0, msg1, msg2, 3);
+            SHA1_ROUNDS4(e0, e1, msg0, msg1, msg2, msg3, 3);
+
+            // rounds 68-79, the schedule winds down
+            e1 = _mm_sha1nexte_epu32(e1, msg1);
+            e0 = abcd;
+            msg2 = _mm_sha1msg2_epu32(msg2, msg1);
+            abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+            msg3 = _mm_xor_si128(msg3, msg1);
+
+            e0 = _mm_sha1nexte_epu32(e0, msg2);
+            e1 = abcd;
+            msg3 = _mm_sha1msg2_epu32(msg3, msg2);
+            abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+
+            e1 = _mm_sha1nexte_epu32(e1, msg3);
+            e0 = abcd;
+            abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+            e0 = _mm_sha1nexte_epu32(e0, eSave);
+            abcd = _mm_add_epi32(abcd, abcdSave);
+        }
+
+        _mm_storeu_si128((__m128i*)state, _mm_shuffle_epi32(abcd, 0x1B));
+        state[4] = (uint32_t)_mm_extract_epi32(e0, 3);
+    }
+#undef SHA1_ROUNDS4
+#endif
+
+    //
+    // SHA1
+    //
+
+    SHA1::SHA1() : m_length(0), m_bufferSize(0) {
+        m_state[0] = 0x67452301;
+        m_state[1] = 0xEFCDAB89;
+        m_state[2] = 0x98BADCFE;
+        m_state[3] = 0x10325476;
+        m_state[4] = 0xC3D2E1F0;
+    }
+
+    bool SHA1::isAccelerated() {
+#if HOST_X86
+        const CpuFeatures& cpu = CpuFeatures::get();
+        return cpu.sha && cpu.sse41 && cpu.ssse3;
+#else
+        return false;
+#endif
+    }
+
+    void SHA1::compress(uint32_t state[5], const uint8_t* blocks, size_t count) {
+#if HOST_X86
+        static const bool accelerated = isAccelerated();
+        if (accelerated) {
+            compressSHANI(state, blocks, count);
+            return;
+        }
+#endif
+        compressPortable(state, blocks, count);
+    }
+
+    void SHA1::compressPortable(uint32_t state[5], const uint8_t* blocks, size_t count) {
+        for (size_t b = 0; b < count; b++) {
+            const uint8_t* block = blocks + b * 64;
+            uint32_t w[80];
+            for (int i = 0; i < 16; i++) {
+                w[i] = loadBE32(block + i * 4);
+            }
+            for (int i = 16; i < 80; i++) {
+                w[i] = rol32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+            }
+
+            uint32_t a = state[0], bb = state[1], c = state[2], d = state[3], e = state[4];
+            auto round = [&](uint32_t f, uint32_t k, uint32_t wi) {
+                uint32_t temp = rol32(a, 5) + f + e + k + wi;
+                e = d;
+                d = c;
+                c = rol32(bb, 30);
+                bb = a;
+                a = temp;
+            };
+            for (int i = 0; i < 20; i++) {
+                round((bb & c) | (~bb & d), 0x5A827999, w[i]);
+            }
+            for (int i = 20; i < 40; i++) {
+                round(bb ^ c ^ d, 0x6ED9EBA1, w[i]);
+            }
+            for (int i = 40; i < 60; i++) {
+                round((bb & c) | (bb & d) | (c & d), 0x8F1BBCDC, w[i]);
+            }
+            for (int i = 60; i < 80; i++) {
+                round(bb ^ c ^ d, 0xCA62C1D6, w[i]);
+            }
+
+            state[0] += a;
+            state[1] += bb;
+            state[2] += c;
+            state[3] += d;
+            state[4] += e;
+        }
+    }
+
+    void SHA1::update(const uint8_t* data, size_t size) {
+        m_length += size;
+
+        if (m_bufferSize > 0) {
+            size_t take = 64 - m_bufferSize;
+            if (take > size) {
+                take = size;
+            }
+            memcpy(m_buffer + m_bufferSize, data, take);
+            m_bufferSize += take;
+            data += take;
+            size -= take;
+            if (m_bufferSize < 64) {
+                return;
+            }
+            compress(m_state, m_buffer, 1);
+            m_bufferSize = 0;
+        }
+
+        size_t blocks = size / 64;
+        if (blocks > 0) {
+            compress(m_state, data, blocks);
+            data += blocks * 64;
+            size -= blocks * 64;
+        }
+
+        memcpy(m_buffer, data, size);
+        m_bufferSize = size;
+    }
+
+    void SHA1::finalize(uint8_t digest[20]) {
+        uint64_t bitLength = m_length * 8;
+
+        uint8_t padding[72] = { 0x80 };
+        size_t padSize = (m_bufferSize < 56) ? (56 - m_bufferSize) : (120 - m_bufferSize);
+        for (int i = 0; i < 8; i++) {
+            padding[padSize + i] = (uint8_t)(bitLength >> (56 - i * 8));
+        }
+        update(padding, padSize + 8);
+
+        for (int i = 0; i < 5; i++) {
+            digest[i * 4 + 0] = (uint8_t)(m_state[i] >> 24);
+            digest[i * 4 + 1] = (uint8_t)(m_state[i] >> 16);
+            digest[i * 4 + 2] = (uint8_t)(m_state[i] >> 8);
+            digest[i * 4 + 3] = (uint8_t)(m_state[i]);
+        }
+    }
+
+    void SHA1::hash(const uint8_t* data, size_t size, uint8_t digest[20]) {
+        SHA1 sha;
+        sha.update(data, size);
+        sha.finalize(digest);
+    }
+}
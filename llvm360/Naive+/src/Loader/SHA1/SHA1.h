@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+namespace XLoader
+{
+    // SHA-1, used by XEX2 for the compressed block chain and the page digests
+    // picks a SHA-NI kernel at runtime and falls back to a portable implementation
+    class SHA1 {
+    public:
+        SHA1();
+
+        void update(const uint8_t* data, size_t size);
+        void finalize(uint8_t digest[20]);
+
+        static void hash(const uint8_t* data, size_t size, uint8_t digest[20]);
+
+        // true when the SHA-NI kernel is used instead of the portable one
+        static bool isAccelerated();
+
+    private:
+        static void compress(uint32_t state[5], const uint8_t* blocks, size_t count);
+        static void compressPortable(uint32_t state[5], const uint8_t* blocks, size_t count);
+
+        uint32_t m_state[5];
+        uint64_t m_length;
+        uint8_t m_buffer[64];
+        size_t m_bufferSize;
+    };
+}
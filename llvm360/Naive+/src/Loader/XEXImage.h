@@ -1,7 +1,11 @@
 #pragma once
 #include "ImageLoader.h"
+#include "MappedFile.h"
+#include "AES/AESDecryptor.h"
+#include "PageVerifier.h"
 #include <cstdint>
 #include <vector>
+#include <atomic>
 
 
 
@@ -20,6 +24,9 @@ namespace XLoader
         Normal = 1
     };
 
+    // XEXLoaderInfo::imageFlags
+    static const uint32_t XEXImageFlagPageSize4KB = 0x10000000;
+
     enum XEXHeaderKey : uint32_t {
         ResourceInfo = 0x000002FF,
         FileFormatInfo = 0x000003FF,
@@ -91,8 +98,19 @@ namespace XLoader
     };
 
     struct XEXFileCompressionInfo {
-        uint16_t compressionType;
+        uint32_t infoSize;
         uint16_t encryptionType;
+        uint16_t compressionType;
+    };
+
+    struct XEXCompressedBlockInfo {
+        uint32_t blockSize;
+        uint8_t blockHash[20];
+    };
+
+    struct XEXNormalCompressionInfo {
+        uint32_t windowSize;
+        XEXCompressedBlockInfo firstBlock;
     };
 
     struct XEXBasicCompressionBlock {
@@ -100,6 +118,16 @@ namespace XLoader
         uint32_t zeroSize;
     };
 
+    // what XEXLoaderInfo::exportTable points to, followed by <count> ordinal offsets
+    struct XEXExportTable {
+        uint32_t magic[3];
+        uint32_t moduleNumber[2];
+        uint32_t version[3];
+        uint32_t imageBaseAddress;   // in 64KB units
+        uint32_t count;
+        uint32_t base;               // first ordinal
+    };
+
     struct XEXImportLibraryHeader {
         uint32_t size;
         uint8_t digest[20];
@@ -113,16 +141,19 @@ namespace XLoader
 
     class XEXImage : public IImage {
     public:
-        XEXImage() : m_baseAddress(0), m_entryPoint(0), m_memoryData(nullptr), m_memorySize(0) {}
+        XEXImage();
         ~XEXImage() override;
 
-        bool load(const uint8_t* data, size_t size) override;
+        bool load(const uint8_t* data, size_t size, const MappedFile* file = nullptr, const LoadOptions& options = LoadOptions()) override;
         uint32_t getBaseAddress() const override { return m_baseAddress; }
         uint32_t getEntryPoint() const override { return m_entryPoint; }
-        const uint8_t* getMemoryData() const override { return m_memoryData; }
-        size_t getMemorySize() const override { return m_memorySize; }
+        const uint8_t* getMemoryData() const override { return m_memory.data(); }
+        size_t getMemorySize() const override { return m_memory.size(); }
         const std::vector<std::unique_ptr<Section>>& getSections() const override { return m_sections; }
         const std::vector<std::unique_ptr<Import>>& getImports() const override { return m_imports; }
+        bool isVerified() const override { return m_verified; }
+        uint8_t* getGuestBase() const override { return m_memory.guestBase(); }
+        const uint8_t* materialize(size_t offset, size_t size) override;
 
     private:
         // Header loading
@@ -131,13 +162,31 @@ namespace XLoader
         bool loadLoaderInfo(const uint8_t* data, size_t size);
 
         // Decompression
-        bool decompressImage(const uint8_t* data, size_t size);
-        bool decompressBasic(const uint8_t* data, size_t size);
+        bool allocateImage(size_t size);
+        bool decompressImage(const uint8_t* data, size_t size, const MappedFile* file);
+        bool decompressBasic(const uint8_t* data, size_t size, const MappedFile* file);
         bool decompressNormal(const uint8_t* data, size_t size);
+        bool decodeNormal(const uint8_t* payload, size_t payloadSize);
 
         // Decryption
-        void decryptSessionKey();
-        bool decryptData(uint8_t* dest, const uint8_t* src, size_t size);
+        struct CipherRun {
+            size_t streamOffset; // offset in the encrypted stream
+            uint8_t* dest;
+            size_t size;
+        };
+        void decryptSessionKey(const uint8_t* data, size_t size);
+        bool decryptData(uint8_t* dest, const uint8_t* src, size_t size, uint8_t iv[16]);
+        void decryptRuns(const uint8_t* stream, const std::vector<CipherRun>& runs);
+
+        // Integrity
+        void startPageVerification();
+
+        // Lazy materialization (LoadOptions::lazy)
+        struct LazyState;
+        void startLazy(const uint8_t* payload, size_t payloadSize, const MappedFile* file);
+        void startLazyDecode(const uint8_t* payload, size_t payloadSize);
+        bool materializeUnit(size_t unit);
+        void fillLazyRange(size_t begin, size_t end);
 
         // PE extraction
         bool extractPEImage();
@@ -145,6 +194,9 @@ namespace XLoader
         // Import handling
         bool processImports();
 
+        // Export table (XEXLoaderInfo::exportTable), read by getExports()
+        void loadExports() override;
+
         // Utilities
         static void swap16(uint16_t* val);
         static void swap32(uint32_t* val);
@@ -152,19 +204,27 @@ namespace XLoader
     private:
         uint32_t m_baseAddress;
         uint32_t m_entryPoint;
-        uint8_t* m_memoryData;
-        size_t m_memorySize;
+        ImageMemory m_memory;
 
         XEXHeader m_header;
         XEXLoaderInfo m_loaderInfo;
         XEXExecutionInfo m_executionInfo;
 
         uint8_t m_sessionKey[16];
+        std::unique_ptr<AESDecryptor> m_decryptor;
         XEXCompressionType m_compressionType;
         XEXEncryptionType m_encryptionType;
 
         std::vector<XEXOptionalHeaderEntry> m_optionalHeaders;
         std::vector<XEXBasicCompressionBlock> m_compressionBlocks;
+        XEXNormalCompressionInfo m_normalInfo;
+
+        std::unique_ptr<PageVerifier> m_verifier;   // alive while the image is being decompressed
+        bool m_verifyDigests;
+        std::atomic<bool> m_verified;   // set by the background decoder of lazy images
+        bool m_useGuestWindow;
+        bool m_lazyLoad;
+        std::unique_ptr<LazyState> m_lazy;   // nullptr unless loaded with LoadOptions::lazy
         std::vector<XEXSection> m_xexSections;
 
         std::vector<std::string> m_libraryNames;
@@ -0,0 +1,182 @@
+#include "XISOReader.h"
+#include <cstring>
+#include <cstdio>
+#include <cctype>
+
+namespace XLoader
+{
+    // where the game partition starts in the different disc layouts,
+    // 0 is a rebuilt image that only has the game partition
+    static const uint64_t PartitionOffsets[] = {
+        0x00000000,
+        0x0FD90000,   // XGD2
+        0x02080000,   // XGD3
+        0x18300000    // XGD1
+    };
+
+    static const char VolumeMagic[] = "MICROSOFT*XBOX*MEDIA";
+    static const size_t VolumeMagicSize = sizeof(VolumeMagic) - 1;
+
+    static const uint8_t AttributeDirectory = 0x10;
+    static const int MaxDepth = 64;
+
+#pragma pack(push, 1)
+    struct XDVDFSVolume {
+        char magic[20];
+        uint32_t rootSector;
+        uint32_t rootSize;
+        uint64_t creationTime;
+    };
+
+    // directory tables are binary trees of these, every node is 4 byte aligned
+    struct XDVDFSDirEntry {
+        uint16_t left;        // in dwords from the start of the table, 0 if none
+        uint16_t right;
+        uint32_t sector;
+        uint32_t size;
+        uint8_t attributes;
+        uint8_t nameLength;
+        // char name[nameLength];
+    };
+#pragma pack(pop)
+
+    static std::string normalizePath(const std::string& path) {
+        std::string result;
+        result.reserve(path.size());
+        for (char c : path) {
+            if (c == '\\') {
+                c = '/';
+            }
+            if (c == '/' && (result.empty() || result.back() == '/')) {
+                continue;
+            }
+            result.push_back((char)tolower((unsigned char)c));
+        }
+        if (!result.empty() && result.back() == '/') {
+            result.pop_back();
+        }
+        return result;
+    }
+
+    std::unique_ptr<XISOReader> XISOReader::open(const std::wstring& path) {
+        std::shared_ptr<MappedFile> file = MappedFile::open(path);
+        if (!file) {
+            printf("Failed to open container\n");
+            return nullptr;
+        }
+
+        auto reader = std::make_unique<XISOReader>();
+        reader->m_file = file;
+        if (!reader->findPartition()) {
+            printf("Not an XISO image (no XDVDFS volume descriptor)\n");
+            return nullptr;
+        }
+
+        const XDVDFSVolume* volume = (const XDVDFSVolume*)(file->data() + reader->m_partitionOffset + VolumeSector * SectorSize);
+        if (!reader->readDirectory(volume->rootSector, volume->rootSize, "", 0)) {
+            printf("Corrupt XDVDFS directory table\n");
+            return nullptr;
+        }
+
+        printf("XISO: game partition at 0x%llX, %zu entries\n",
+            (unsigned long long)reader->m_partitionOffset, reader->m_entries.size());
+        return reader;
+    }
+
+    bool XISOReader::findPartition() {
+        for (uint64_t partition : PartitionOffsets) {
+            uint64_t offset = partition + VolumeSector * SectorSize;
+            if (offset + sizeof(XDVDFSVolume) > m_file->size()) {
+                continue;
+            }
+            if (memcmp(m_file->data() + offset, VolumeMagic, VolumeMagicSize) == 0) {
+                m_partitionOffset = partition;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool XISOReader::readDirectory(uint32_t sector, uint32_t size, const std::string& prefix, int depth) {
+        if (size == 0) {
+            return true;
+        }
+        if (depth > MaxDepth) {
+            return false;
+        }
+
+        uint64_t tableOffset = m_partitionOffset + (uint64_t)sector * SectorSize;
+        if (tableOffset > m_file->size() || size > m_file->size() - tableOffset) {
+            return false;
+        }
+        const uint8_t* table = m_file->data() + tableOffset;
+
+        // walk the tree with an explicit stack, a node is never visited twice so
+        // a corrupt table can't loop forever
+        std::vector<bool> visited(size / 4 + 1, false);
+        std::vector<uint32_t> pending = { 0 };
+        while (!pending.empty()) {
+            uint32_t nodeOffset = pending.back();
+            pending.pop_back();
+
+            // child offsets come from the table, check them before they index anything
+            if ((size_t)nodeOffset + sizeof(XDVDFSDirEntry) > size) {
+                return false;
+            }
+            if (visited[nodeOffset / 4]) {
+                continue;
+            }
+            visited[nodeOffset / 4] = true;
+            const XDVDFSDirEntry* node = (const XDVDFSDirEntry*)(table + nodeOffset);
+            if (node->left == 0xFFFF) {
+                // sector padding, only valid in an otherwise empty table
+                continue;
+            }
+            if ((size_t)nodeOffset + sizeof(XDVDFSDirEntry) + node->nameLength > size) {
+                return false;
+            }
+
+            if (node->left != 0) {
+                pending.push_back((uint32_t)node->left * 4);
+            }
+            if (node->right != 0) {
+                pending.push_back((uint32_t)node->right * 4);
+            }
+
+            std::string name((const char*)node + sizeof(XDVDFSDirEntry), node->nameLength);
+            Entry entry;
+            entry.path = prefix + name;
+            entry.offset = m_partitionOffset + (uint64_t)node->sector * SectorSize;
+            entry.size = node->size;
+            entry.isDirectory = (node->attributes & AttributeDirectory) != 0;
+
+            if (!entry.isDirectory && (entry.offset > m_file->size() || entry.size > m_file->size() - entry.offset)) {
+                printf("XISO: %s is outside the container, skipped\n", entry.path.c_str());
+                continue;
+            }
+
+            m_entries.push_back(entry);
+            if (entry.isDirectory && !readDirectory(node->sector, node->size, entry.path + "/", depth + 1)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    const XISOReader::Entry* XISOReader::find(const std::string& path) const {
+        std::string wanted = normalizePath(path);
+        for (const Entry& entry : m_entries) {
+            if (normalizePath(entry.path) == wanted) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    const uint8_t* XISOReader::getData(const Entry& entry) const {
+        if (entry.isDirectory) {
+            return nullptr;
+        }
+        return m_file->data() + entry.offset;
+    }
+}
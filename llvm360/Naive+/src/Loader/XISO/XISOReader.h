@@ -0,0 +1,49 @@
+#pragma once
+#include "../MappedFile.h"
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace XLoader
+{
+    // Xbox 360 disc image (XISO / XDVDFS)
+    // the container is mapped once and every file in it is a byte range of that mapping,
+    // nothing is extracted or copied
+    class XISOReader {
+    public:
+        static const size_t SectorSize = 2048;
+        static const uint32_t VolumeSector = 32;   // volume descriptor, relative to the game partition
+
+        struct Entry {
+            std::string path;   // '/' separated, no leading slash
+            uint64_t offset;    // from the start of the container file
+            uint32_t size;
+            bool isDirectory;
+        };
+
+        static std::unique_ptr<XISOReader> open(const std::wstring& path);
+
+        const std::vector<Entry>& getEntries() const { return m_entries; }
+
+        // case insensitive, accepts '/' and '\' separators
+        const Entry* find(const std::string& path) const;
+
+        // bytes of a file entry inside the mapping, nullptr for directories
+        const uint8_t* getData(const Entry& entry) const;
+
+        // the mapping stays valid as long as someone holds it
+        const std::shared_ptr<const MappedFile>& getFile() const { return m_file; }
+        uint64_t getPartitionOffset() const { return m_partitionOffset; }
+
+    private:
+        bool findPartition();
+        bool readDirectory(uint32_t sector, uint32_t size, const std::string& prefix, int depth);
+
+    private:
+        std::shared_ptr<const MappedFile> m_file;
+        uint64_t m_partitionOffset = 0;
+        std::vector<Entry> m_entries;
+    };
+}
@@ -0,0 +1,371 @@
+#include "XXH3.h"
+#include "CpuFeatures.h"
+#include <cstring>
+#include <cstdio>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace XLoader
+{
+    static const uint32_t Prime32_1 = 0x9E3779B1U;
+    static const uint32_t Prime32_2 = 0x85EBCA77U;
+    static const uint32_t Prime32_3 = 0xC2B2AE3DU;
+    static const uint64_t Prime64_1 = 0x9E3779B185EBCA87ULL;
+    static const uint64_t Prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+    static const uint64_t Prime64_3 = 0x165667B19E3779F9ULL;
+    static const uint64_t Prime64_4 = 0x85EBCA77C2B2AE63ULL;
+    static const uint64_t Prime64_5 = 0x27D4EB2F165667C5ULL;
+    static const uint64_t PrimeMx1 = 0x165667919E3779F9ULL;
+    static const uint64_t PrimeMx2 = 0x9FB21C651E98DF25ULL;
+
+    static const size_t SecretSize = 192;
+    static const size_t StripeSize = 64;
+    static const size_t StripesPerBlock = (SecretSize - StripeSize) / 8;
+    static const size_t BlockSize = StripeSize * StripesPerBlock;
+
+    alignas(64) static const uint8_t kSecret[SecretSize] = {
+        0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+        0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+        0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+        0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+        0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+        0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+        0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+        0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+        0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+        0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+        0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+        0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+    };
+
+    // the host is little endian on every platform we run on, the byte order of XXH3 is little endian too
+    static inline uint32_t read32(const uint8_t* p) {
+        uint32_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    static inline uint64_t read64(const uint8_t* p) {
+        uint64_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    static inline uint32_t swap32(uint32_t v) {
+        return ((v & 0x000000FF) << 24) | ((v & 0x0000FF00) << 8) | ((v & 0x00FF0000) >> 8) | ((v & 0xFF000000) >> 24);
+    }
+
+    static inline uint64_t swap64(uint64_t v) {
+        return ((uint64_t)swap32((uint32_t)v) << 32) | swap32((uint32_t)(v >> 32));
+    }
+
+    static inline uint32_t rol32(uint32_t v, int bits) {
+        return (v << bits) | (v >> (32 - bits));
+    }
+
+    static inline Hash128 mul64to128(uint64_t a, uint64_t b) {
+        Hash128 r;
+#ifdef _MSC_VER
+        r.low = _umul128(a, b, &r.high);
+#else
+        unsigned __int128 product = (unsigned __int128)a * b;
+        r.low = (uint64_t)product;
+        r.high = (uint64_t)(product >> 64);
+#endif
+        return r;
+    }
+
+    static inline uint64_t mulFold64(uint64_t a, uint64_t b) {
+        Hash128 product = mul64to128(a, b);
+        return product.low ^ product.high;
+    }
+
+    static inline uint64_t avalancheXXH64(uint64_t h) {
+        h ^= h >> 33;
+        h *= Prime64_2;
+        h ^= h >> 29;
+        h *= Prime64_3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    static inline uint64_t avalanche(uint64_t h) {
+        h ^= h >> 37;
+        h *= PrimeMx1;
+        h ^= h >> 32;
+        return h;
+    }
+
+    static inline uint64_t mix16(const uint8_t* input, const uint8_t* secret, uint64_t seed) {
+        return mulFold64(read64(input) ^ (read64(secret) + seed), read64(input + 8) ^ (read64(secret + 8) - seed));
+    }
+
+    static inline void mix32(Hash128& acc, const uint8_t* input1, const uint8_t* input2, const uint8_t* secret, uint64_t seed) {
+        acc.low += mix16(input1, secret, seed);
+        acc.low ^= read64(input2) + read64(input2 + 8);
+        acc.high += mix16(input2, secret + 16, seed);
+        acc.high ^= read64(input1) + read64(input1 + 8);
+    }
+
+    static Hash128 finishMix(const Hash128& acc, size_t size) {
+        Hash128 h;
+        h.low = avalanche(acc.low + acc.high);
+        h.high = 0 - avalanche(acc.low * Prime64_1 + acc.high * Prime64_4 + (uint64_t)size * Prime64_2);
+        return h;
+    }
+
+    //
+    // Short inputs
+    //
+
+    static Hash128 hash0to16(const uint8_t* data, size_t size) {
+        const uint8_t* secret = kSecret;
+        Hash128 h;
+
+        if (size > 8) {
+            uint64_t bitflipLow = read64(secret + 32) ^ read64(secret + 40);
+            uint64_t bitflipHigh = read64(secret + 48) ^ read64(secret + 56);
+            uint64_t inputLow = read64(data);
+            uint64_t inputHigh = read64(data + size - 8);
+
+            Hash128 m = mul64to128(inputLow ^ inputHigh ^ bitflipLow, Prime64_1);
+            m.low += (uint64_t)(size - 1) << 54;
+            inputHigh ^= bitflipHigh;
+            m.high += inputHigh + (uint64_t)(uint32_t)inputHigh * (Prime32_2 - 1);
+            m.low ^= swap64(m.high);
+
+            h = mul64to128(m.low, Prime64_2);
+            h.high += m.high * Prime64_2;
+            h.low = avalanche(h.low);
+            h.high = avalanche(h.high);
+            return h;
+        }
+
+        if (size >= 4) {
+            uint64_t input = read32(data) + ((uint64_t)read32(data + size - 4) << 32);
+            uint64_t bitflip = read64(secret + 16) ^ read64(secret + 24);
+
+            Hash128 m = mul64to128(input ^ bitflip, Prime64_1 + ((uint64_t)size << 2));
+            m.high += m.low << 1;
+            m.low ^= m.high >> 3;
+            m.low ^= m.low >> 35;
+            m.low *= PrimeMx2;
+            m.low ^= m.low >> 28;
+            m.high = avalanche(m.high);
+            return m;
+        }
+
+        if (size > 0) {
+            uint32_t combinedLow = ((uint32_t)data[0] << 16) | ((uint32_t)data[size >> 1] << 24) | data[size - 1] | ((uint32_t)size << 8);
+            uint32_t combinedHigh = rol32(swap32(combinedLow), 13);
+            uint64_t bitflipLow = read32(secret) ^ read32(secret + 4);
+            uint64_t bitflipHigh = read32(secret + 8) ^ read32(secret + 12);
+            h.low = avalancheXXH64(combinedLow ^ bitflipLow);
+            h.high = avalancheXXH64(combinedHigh ^ bitflipHigh);
+            return h;
+        }
+
+        h.low = avalancheXXH64(read64(secret + 64) ^ read64(secret + 72));
+        h.high = avalancheXXH64(read64(secret + 80) ^ read64(secret + 88));
+        return h;
+    }
+
+    static Hash128 hash17to128(const uint8_t* data, size_t size) {
+        Hash128 acc;
+        acc.low = size * Prime64_1;
+        acc.high = 0;
+
+        if (size > 32) {
+            if (size > 64) {
+                if (size > 96) {
+                    mix32(acc, data + 48, data + size - 64, kSecret + 96, 0);
+                }
+                mix32(acc, data + 32, data + size - 48, kSecret + 64, 0);
+            }
+            mix32(acc, data + 16, data + size - 32, kSecret + 32, 0);
+        }
+        mix32(acc, data, data + size - 16, kSecret, 0);
+        return finishMix(acc, size);
+    }
+
+    static Hash128 hash129to240(const uint8_t* data, size_t size) {
+        const size_t MidStartOffset = 3;
+        const size_t MidLastOffset = 17;
+        const size_t SecretSizeMin = 136;
+
+        Hash128 acc;
+        acc.low = size * Prime64_1;
+        acc.high = 0;
+
+        size_t rounds = size / 32;
+        for (size_t i = 0; i < 4; i++) {
+            mix32(acc, data + 32 * i, data + 32 * i + 16, kSecret + 32 * i, 0);
+        }
+        acc.low = avalanche(acc.low);
+        acc.high = avalanche(acc.high);
+
+        for (size_t i = 4; i < rounds; i++) {
+            mix32(acc, data + 32 * i, data + 32 * i + 16, kSecret + MidStartOffset + 32 * (i - 4), 0);
+        }
+        mix32(acc, data + size - 16, data + size - 32, kSecret + SecretSizeMin - MidLastOffset - 16, 0);
+        return finishMix(acc, size);
+    }
+
+    //
+    // Long inputs: 8 lanes of 64 bit accumulators, one 64 byte stripe at a time
+    //
+
+    static const size_t LastStripeSecretOffset = SecretSize - StripeSize - 7;
+    static const size_t MergeSecretOffset = 11;
+
+    static inline void accumulateStripe(uint64_t acc[8], const uint8_t* input, const uint8_t* secret) {
+        for (int i = 0; i < 8; i++) {
+            uint64_t value = read64(input + 8 * i);
+            uint64_t key = value ^ read64(secret + 8 * i);
+            acc[i ^ 1] += value;
+            acc[i] += (uint64_t)(uint32_t)key * (key >> 32);
+        }
+    }
+
+    static inline void scramble(uint64_t acc[8], const uint8_t* secret) {
+        for (int i = 0; i < 8; i++) {
+            uint64_t a = acc[i];
+            a ^= a >> 47;
+            a ^= read64(secret + 8 * i);
+            acc[i] = a * Prime32_1;
+        }
+    }
+
+    static void hashLongPortable(uint64_t acc[8], const uint8_t* data, size_t size) {
+        size_t blocks = (size - 1) / BlockSize;
+        for (size_t b = 0; b < blocks; b++) {
+            const uint8_t* block = data + b * BlockSize;
+            for (size_t s = 0; s < StripesPerBlock; s++) {
+                accumulateStripe(acc, block + s * StripeSize, kSecret + s * 8);
+            }
+            scramble(acc, kSecret + SecretSize - StripeSize);
+        }
+
+        const uint8_t* tail = data + blocks * BlockSize;
+        size_t stripes = ((size - 1) - blocks * BlockSize) / StripeSize;
+        for (size_t s = 0; s < stripes; s++) {
+            accumulateStripe(acc, tail + s * StripeSize, kSecret + s * 8);
+        }
+        accumulateStripe(acc, data + size - StripeSize, kSecret + LastStripeSecretOffset);
+    }
+
+#if HOST_X86
+    TARGET_ATTR("avx2")
+    static inline void accumulateStripeAVX2(__m256i acc[2], const uint8_t* input, const uint8_t* secret) {
+        for (int i = 0; i < 2; i++) {
+            __m256i value = _mm256_loadu_si256((const __m256i*)input + i);
+            __m256i key = _mm256_xor_si256(value, _mm256_loadu_si256((const __m256i*)secret + i));
+            __m256i product = _mm256_mul_epu32(key, _mm256_srli_epi64(key, 32));
+            __m256i swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+            acc[i] = _mm256_add_epi64(acc[i], _mm256_add_epi64(product, swapped));
+        }
+    }
+
+    TARGET_ATTR("avx2")
+    static inline void scrambleAVX2(__m256i acc[2], const uint8_t* secret) {
+        const __m256i prime = _mm256_set1_epi32((int)Prime32_1);
+        for (int i = 0; i < 2; i++) {
+            __m256i a = _mm256_xor_si256(acc[i], _mm256_srli_epi64(acc[i], 47));
+            a = _mm256_xor_si256(a, _mm256_loadu_si256((const __m256i*)secret + i));
+            // 64 x 32 bit multiply out of two 32 x 32 ones
+            __m256i low = _mm256_mul_epu32(a, prime);
+            __m256i high = _mm256_mul_epu32(_mm256_shuffle_epi32(a, _MM_SHUFFLE(0, 3, 0, 1)), prime);
+            acc[i] = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+        }
+    }
+
+    TARGET_ATTR("avx2")
+    static void hashLongAVX2(uint64_t accOut[8], const uint8_t* data, size_t size) {
+        __m256i acc[2] = {
+            _mm256_loadu_si256((const __m256i*)accOut),
+            _mm256_loadu_si256((const __m256i*)accOut + 1)
+        };
+
+        size_t blocks = (size - 1) / BlockSize;
+        for (size_t b = 0; b < blocks; b++) {
+            const uint8_t* block = data + b * BlockSize;
+            for (size_t s = 0; s < StripesPerBlock; s++) {
+                accumulateStripeAVX2(acc, block + s * StripeSize, kSecret + s * 8);
+            }
+            scrambleAVX2(acc, kSecret + SecretSize - StripeSize);
+        }
+
+        const uint8_t* tail = data + blocks * BlockSize;
+        size_t stripes = ((size - 1) - blocks * BlockSize) / StripeSize;
+        for (size_t s = 0; s < stripes; s++) {
+            accumulateStripeAVX2(acc, tail + s * StripeSize, kSecret + s * 8);
+        }
+        accumulateStripeAVX2(acc, data + size - StripeSize, kSecret + LastStripeSecretOffset);
+
+        _mm256_storeu_si256((__m256i*)accOut, acc[0]);
+        _mm256_storeu_si256((__m256i*)accOut + 1, acc[1]);
+    }
+#endif
+
+    static uint64_t mergeAccumulators(const uint64_t acc[8], const uint8_t* secret, uint64_t start) {
+        uint64_t result = start;
+        for (int i = 0; i < 4; i++) {
+            result += mulFold64(acc[2 * i] ^ read64(secret + 16 * i), acc[2 * i + 1] ^ read64(secret + 16 * i + 8));
+        }
+        return avalanche(result);
+    }
+
+    //
+    // XXH3
+    //
+
+    bool XXH3::isAccelerated() {
+#if HOST_X86
+        return CpuFeatures::get().avx2;
+#else
+        return false;
+#endif
+    }
+
+    Hash128 XXH3::hashLong(const uint8_t* data, size_t size) {
+        alignas(32) uint64_t acc[8] = {
+            Prime32_3, Prime64_1, Prime64_2, Prime64_3, Prime64_4, Prime32_2, Prime64_5, Prime32_1
+        };
+
+#if HOST_X86
+        static const bool accelerated = isAccelerated();
+        if (accelerated) {
+            hashLongAVX2(acc, data, size);
+        }
+        else
+#endif
+        {
+            hashLongPortable(acc, data, size);
+        }
+
+        Hash128 h;
+        h.low = mergeAccumulators(acc, kSecret + MergeSecretOffset, (uint64_t)size * Prime64_1);
+        h.high = mergeAccumulators(acc, kSecret + SecretSize - StripeSize - MergeSecretOffset, ~((uint64_t)size * Prime64_2));
+        return h;
+    }
+
+    Hash128 XXH3::hash128(const uint8_t* data, size_t size) {
+        if (size <= 16) {
+            return hash0to16(data, size);
+        }
+        if (size <= 128) {
+            return hash17to128(data, size);
+        }
+        if (size <= 240) {
+            return hash129to240(data, size);
+        }
+        return hashLong(data, size);
+    }
+
+    std::string Hash128::toString() const {
+        char text[33];
+        snprintf(text, sizeof(text), "%016llx%016llx", (unsigned long long)high, (unsigned long long)low);
+        return text;
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace XLoader
+{
+    // 128 bit hash value
+    struct Hash128 {
+        uint64_t low = 0;
+        uint64_t high = 0;
+
+        bool operator==(const Hash128& other) const { return low == other.low && high == other.high; }
+        bool operator!=(const Hash128& other) const { return !(*this == other); }
+
+        // 32 hex digits, high half first (same as xxhsum / xxh3_128_hexdigest)
+        std::string toString() const;
+    };
+
+    // XXH3 128 bit (seed 0, default secret), used to fingerprint files for the translation cache
+    // the long input loop has an AVX2 kernel picked at runtime and a portable fallback
+    class XXH3 {
+    public:
+        static Hash128 hash128(const uint8_t* data, size_t size);
+
+        // true when the AVX2 kernel is used for inputs over 240 bytes
+        static bool isAccelerated();
+
+    private:
+        static Hash128 hashLong(const uint8_t* data, size_t size);
+    };
+}
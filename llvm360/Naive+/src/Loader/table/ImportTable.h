@@ -1,2602 +1,2668 @@
 #pragma once
-#include "Loader/XEXImage.h"
+#include "Loader/ImageLoader.h"
+#include <array>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
 
-using namespace XLoader;
+// Exports of the system libraries by ordinal
+// the table is constexpr data, nothing is allocated or run at startup
+struct ImportEntry
+{
+    XboxLibrary library;
+    uint32_t ordinal;
+    ImportType type;
+    const char* name;
+};
+
+#define LOAD_IMPORT(lib, ord, type, name) { lib, ord, type, name }
 
-std::vector<Import*> import_table;
 
-static inline void loadImport(XboxLibrary lib, std::string name, uint32_t ordinal, ImportType type)
+inline constexpr ImportEntry import_table[] =
 {
-    Import* imp = new Import(lib, type, name, ordinal);
-    import_table.push_back(imp);
-}
+    //
+    // Xapi
+    // 
+
+    LOAD_IMPORT(XboxLibrary::Xapi, 0x0001, ImportType::Variable, "XapiProcessHeap"),
+    LOAD_IMPORT(XboxLibrary::Xapi, 0x0002, ImportType::Variable, "_locktable"),
+    LOAD_IMPORT(XboxLibrary::Xapi, 0x0003, ImportType::Variable, "__tlsindexXapi"),
+    LOAD_IMPORT(XboxLibrary::Xapi, 0x0004, ImportType::Function, "XapiTermHeapNoop"),
+    LOAD_IMPORT(XboxLibrary::Xapi, 0x0005, ImportType::Variable, "XapiDebugHeap"),
 
-#define LOAD_IMPORT(lib, ord, type, name) loadImport(lib, name, ord, type)
+    //
+    // Xam
+    //
 
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0001, ImportType::Function, "NetDll_WSAStartup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0002, ImportType::Function, "NetDll_WSACleanup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0003, ImportType::Function, "NetDll_socket"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0004, ImportType::Function, "NetDll_closesocket"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0005, ImportType::Function, "NetDll_shutdown"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0006, ImportType::Function, "NetDll_ioctlsocket"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0007, ImportType::Function, "NetDll_setsockopt"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0008, ImportType::Function, "NetDll_getsockopt"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0009, ImportType::Function, "NetDll_getsockname"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x000A, ImportType::Function, "NetDll_getpeername"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x000B, ImportType::Function, "NetDll_bind"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x000C, ImportType::Function, "NetDll_connect"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x000D, ImportType::Function, "NetDll_listen"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x000E, ImportType::Function, "NetDll_accept"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x000F, ImportType::Function, "NetDll_select"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0010, ImportType::Function, "NetDll_WSAGetOverlappedResult"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0011, ImportType::Function, "NetDll_WSACancelOverlappedIO"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0012, ImportType::Function, "NetDll_recv"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0013, ImportType::Function, "NetDll_WSARecv"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0014, ImportType::Function, "NetDll_recvfrom"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0015, ImportType::Function, "NetDll_WSARecvFrom"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0016, ImportType::Function, "NetDll_send"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0017, ImportType::Function, "NetDll_WSASend"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0018, ImportType::Function, "NetDll_sendto"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0019, ImportType::Function, "NetDll_WSASendTo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x001A, ImportType::Function, "NetDll_inet_addr"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x001B, ImportType::Function, "NetDll_WSAGetLastError"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x001C, ImportType::Function, "NetDll_WSASetLastError"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x001D, ImportType::Function, "NetDll_WSACreateEvent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x001E, ImportType::Function, "NetDll_WSACloseEvent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x001F, ImportType::Function, "NetDll_WSASetEvent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0020, ImportType::Function, "NetDll_WSAResetEvent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0021, ImportType::Function, "NetDll_WSAWaitForMultipleEvents"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0022, ImportType::Function, "NetDll___WSAFDIsSet"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0023, ImportType::Function, "NetDll_WSAEventSelect"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0024, ImportType::Function, "NetDll_WSAStartupEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0033, ImportType::Function, "NetDll_XNetStartup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0034, ImportType::Function, "NetDll_XNetCleanup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0035, ImportType::Function, "NetDll_XNetRandom"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0036, ImportType::Function, "NetDll_XNetCreateKey"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0037, ImportType::Function, "NetDll_XNetRegisterKey"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0038, ImportType::Function, "NetDll_XNetUnregisterKey"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0039, ImportType::Function, "NetDll_XNetXnAddrToInAddr"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x003A, ImportType::Function, "NetDll_XNetServerToInAddr"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x003B, ImportType::Function, "NetDll_XNetTsAddrToInAddr"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x003C, ImportType::Function, "NetDll_XNetInAddrToXnAddr"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x003D, ImportType::Function, "NetDll_XNetInAddrToServer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x003E, ImportType::Function, "NetDll_XNetInAddrToString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x003F, ImportType::Function, "NetDll_XNetUnregisterInAddr"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0040, ImportType::Function, "NetDll_XNetXnAddrToMachineId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0041, ImportType::Function, "NetDll_XNetConnect"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0042, ImportType::Function, "NetDll_XNetGetConnectStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0043, ImportType::Function, "NetDll_XNetDnsLookup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0044, ImportType::Function, "NetDll_XNetDnsRelease"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0045, ImportType::Function, "NetDll_XNetQosListen"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0046, ImportType::Function, "NetDll_XNetQosLookup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0047, ImportType::Function, "NetDll_XNetQosServiceLookup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0048, ImportType::Function, "NetDll_XNetQosRelease"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0049, ImportType::Function, "NetDll_XNetGetTitleXnAddr"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x004A, ImportType::Function, "NetDll_XNetGetDebugXnAddr"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x004B, ImportType::Function, "NetDll_XNetGetEthernetLinkStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x004C, ImportType::Function, "NetDll_XNetGetBroadcastVersionStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x004D, ImportType::Function, "NetDll_XNetQosGetListenStats"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x004E, ImportType::Function, "NetDll_XNetGetOpt"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x004F, ImportType::Function, "NetDll_XNetSetOpt"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0050, ImportType::Function, "NetDll_XNetStartupEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0051, ImportType::Function, "NetDll_XNetReplaceKey"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0052, ImportType::Function, "NetDll_XNetGetXnAddrPlatform"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0053, ImportType::Function, "NetDll_XNetGetSystemLinkPort"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0054, ImportType::Function, "NetDll_XNetSetSystemLinkPort"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0065, ImportType::Function, "NetDll_XnpLoadConfigParams"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0066, ImportType::Function, "NetDll_XnpSaveConfigParams"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0067, ImportType::Function, "NetDll_XnpConfigUPnP"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0068, ImportType::Function, "NetDll_XnpConfig"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0069, ImportType::Function, "NetDll_XnpGetConfigStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x006A, ImportType::Function, "NetDll_XnpLoadMachineAccount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x006B, ImportType::Function, "NetDll_XnpSaveMachineAccount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x006C, ImportType::Function, "NetDll_XnpCapture"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x006D, ImportType::Function, "NetDll_XnpEthernetInterceptSetCallbacks"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x006E, ImportType::Function, "NetDll_XnpEthernetInterceptXmit"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x006F, ImportType::Function, "NetDll_XnpEthernetInterceptRecv"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0070, ImportType::Function, "NetDll_XnpLogonGetStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0071, ImportType::Function, "NetDll_XnpLogonGetQFlags"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0072, ImportType::Function, "NetDll_XnpLogonSetQFlags"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0073, ImportType::Function, "NetDll_XnpLogonSetQEvent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0074, ImportType::Function, "NetDll_XnpLogonClearQEvent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0075, ImportType::Function, "NetDll_XnpLogonGetQVals"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0076, ImportType::Function, "NetDll_XnpLogonSetQVals"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0077, ImportType::Function, "NetDll_XnpLogonSetPState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0078, ImportType::Function, "NetDll_XnpGetVlanXboxName"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0079, ImportType::Function, "NetDll_XnpSetVlanXboxName"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x007A, ImportType::Function, "NetDll_XnpGetActiveSocketList"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x007B, ImportType::Function, "NetDll_XnpNoteSystemTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x007C, ImportType::Function, "NetDll_XnpRegisterKeyForCallerType"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x007D, ImportType::Function, "NetDll_XnpUnregisterKeyForCallerType"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x007E, ImportType::Function, "NetDll_XnpLogonGetChallenge"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x007F, ImportType::Function, "NetDll_XnpLogonClearChallenge"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0080, ImportType::Function, "NetDll_XnpLogonSetChallengeResponse"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0081, ImportType::Function, "NetDll_XnpGetSecAssocList"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0082, ImportType::Function, "NetDll_XnpGetKeyList"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0083, ImportType::Function, "NetDll_XnpGetQosLookupList"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0084, ImportType::Function, "NetDll_XnpPersistTitleState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0085, ImportType::Function, "NetDll_XnpReplaceKeyForCallerType"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0086, ImportType::Function, "NetDll_XnpEthernetInterceptSetExtendedReceiveCallback"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0087, ImportType::Function, "NetDll_XnpQosHistoryLoad"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0088, ImportType::Function, "NetDll_XnpQosHistorySaveMeasurements"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0089, ImportType::Function, "NetDll_XnpQosHistoryGetEntries"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x008A, ImportType::Function, "NetDll_XnpQosHistoryGetAggregateMeasurement"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x008B, ImportType::Function, "NetDll_XnpToolSetCallbacks"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x008C, ImportType::Function, "NetDll_XnpToolIpProxyInject"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x008D, ImportType::Function, "NetDll_XnpUpdateConfigParams"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x008E, ImportType::Function, "NetDll_XnpEthernetInterceptXmitAsIp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0097, ImportType::Function, "NetDll_XmlDownloadStart"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0098, ImportType::Function, "NetDll_XmlDownloadContinue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0099, ImportType::Function, "NetDll_XmlDownloadStop"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x009A, ImportType::Function, "NetDll_XmlDownloadGetParseTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x009B, ImportType::Function, "NetDll_XmlDownloadGetReceivedDataSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00C6, ImportType::Function, "XnpGetXwppMemoryLogSnapshot"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00C7, ImportType::Function, "XnpGetXwppRuntimeFilter"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00C9, ImportType::Function, "NetDll_XHttpStartup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00CA, ImportType::Function, "NetDll_XHttpShutdown"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00CB, ImportType::Function, "NetDll_XHttpOpen"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00CC, ImportType::Function, "NetDll_XHttpCloseHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00CD, ImportType::Function, "NetDll_XHttpConnect"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00CE, ImportType::Function, "NetDll_XHttpSetStatusCallback"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00CF, ImportType::Function, "NetDll_XHttpOpenRequest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00D0, ImportType::Function, "NetDll_XHttpOpenRequestUsingMemory"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00D1, ImportType::Function, "NetDll_XHttpSendRequest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00D2, ImportType::Function, "NetDll_XHttpReceiveResponse"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00D3, ImportType::Function, "NetDll_XHttpQueryHeaders"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00D4, ImportType::Function, "NetDll_XHttpReadData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00D5, ImportType::Function, "NetDll_XHttpWriteData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00D6, ImportType::Function, "NetDll_XHttpQueryOption"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00D7, ImportType::Function, "NetDll_XHttpSetOption"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00D8, ImportType::Function, "NetDll_XHttpDoWork"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00D9, ImportType::Function, "NetDll_XHttpSetCredentials"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00DA, ImportType::Function, "NetDll_XHttpQueryAuthSchemes"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00DB, ImportType::Function, "NetDll_XHttpCrackUrl"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00FB, ImportType::Function, "NetDll_UpnpStartup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00FC, ImportType::Function, "NetDll_UpnpCleanup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00FD, ImportType::Function, "NetDll_UpnpSearchCreate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00FE, ImportType::Function, "NetDll_UpnpSearchGetDevices"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x00FF, ImportType::Function, "NetDll_UpnpDescribeCreate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0100, ImportType::Function, "NetDll_UpnpDescribeGetResults"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0101, ImportType::Function, "NetDll_UpnpActionCalculateWorkBufferSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0102, ImportType::Function, "NetDll_UpnpActionCreate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0103, ImportType::Function, "NetDll_UpnpActionGetResults"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0104, ImportType::Function, "NetDll_UpnpEventCreate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0105, ImportType::Function, "NetDll_UpnpEventGetCurrentState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0106, ImportType::Function, "NetDll_UpnpEventUnsubscribe"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0107, ImportType::Function, "NetDll_UpnpDoWork"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0108, ImportType::Function, "NetDll_UpnpCloseHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x012D, ImportType::Function, "XNetLogonGetLoggedOnUsers"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x012E, ImportType::Function, "XNetLogonGetNatType"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x012F, ImportType::Function, "XNetLogonTaskStart"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0130, ImportType::Function, "XNetLogonTaskClose"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0131, ImportType::Function, "XNetLogonTaskContinue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0132, ImportType::Function, "XNetLogonGetServiceInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0133, ImportType::Function, "XNetLogonGetUserPrivileges"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0134, ImportType::Function, "XNetLogonSetConsoleCertificate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0135, ImportType::Function, "XNetLogonGetMachineID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0136, ImportType::Function, "XNetLogonGetTitleID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0137, ImportType::Function, "XNetLogonGetTitleVersion"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0138, ImportType::Function, "XNetLogonGetServiceNetworkID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0139, ImportType::Function, "XNetLogonGetDnsString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x013A, ImportType::Function, "XNetLogonSetTitleID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x013B, ImportType::Function, "XNetLogonGetExtendedStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x013C, ImportType::Function, "XNetLogonClearTicketCaches"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x013D, ImportType::Function, "XNetLogonInitOverrideInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x013E, ImportType::Function, "XNetLogonGetLastUPnPStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x013F, ImportType::Function, "XNetLogonGetFlowToken"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0140, ImportType::Function, "XNetLogonGetTicketOpt"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0141, ImportType::Function, "XNetLogonSetTicketOpt"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0190, ImportType::Function, "XamInputGetCapabilities"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0191, ImportType::Function, "XamInputGetState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0192, ImportType::Function, "XamInputSetState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0193, ImportType::Function, "XamInputGetKeystroke"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0194, ImportType::Function, "XamInputEnableAutobind"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0195, ImportType::Function, "XamInputRawState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0196, ImportType::Function, "XamEnableSystemAppInput"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0197, ImportType::Function, "XamInputGetDeviceStats"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0198, ImportType::Function, "XamInputGetKeystrokeEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0199, ImportType::Function, "XamInputGetKeystrokeHud"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x019A, ImportType::Function, "XamInputSetLayoutKeyboard"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x019B, ImportType::Function, "XamInputToggleKeyLocks"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x019C, ImportType::Function, "XamInputResetLayoutKeyboard"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x019D, ImportType::Function, "XamInputGetKeystrokeHudEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x019E, ImportType::Function, "XamInputSetKeyboardTranslationHud"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x019F, ImportType::Function, "XamSetInactivityTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01A0, ImportType::Function, "XamEnableInactivityProcessing"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01A1, ImportType::Function, "XamResetInactivity"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01A2, ImportType::Function, "XamSetInactivityTimeFromConfig"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01A3, ImportType::Function, "XamLoaderGetMediaInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01A4, ImportType::Function, "XamLoaderLaunchTitle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01A5, ImportType::Function, "XamLoaderLaunchTitleEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01A6, ImportType::Function, "XamLoaderSetLaunchData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01A7, ImportType::Function, "XamLoaderGetLaunchDataSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01A8, ImportType::Function, "XamLoaderGetLaunchData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01A9, ImportType::Function, "XamLoaderTerminateTitle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01AA, ImportType::Function, "XamLoaderGetDvdTrayState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01AB, ImportType::Function, "XamLoaderGetGameInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01AC, ImportType::Function, "XamLoaderLaunchTitleOnDvd"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01AD, ImportType::Function, "XamLoaderSetSpindleSpeed"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01AE, ImportType::Function, "XamTaskCreateQueue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01AF, ImportType::Function, "XamTaskSchedule"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01B0, ImportType::Function, "XamTaskReschedule"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01B1, ImportType::Function, "XamTaskCloseHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01B2, ImportType::Function, "XamTaskCancel"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01B3, ImportType::Function, "XamTaskShouldExit"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01B4, ImportType::Function, "XamTaskWaitOnCompletion"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01B5, ImportType::Function, "XamTaskModify"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01B6, ImportType::Function, "XamTaskGetCurrentTask"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01B7, ImportType::Function, "XamTaskGetAttributes"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01B8, ImportType::Function, "XamExecutingOnBehalfOfTitle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01B9, ImportType::Function, "XamInputSendStayAliveRequest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01BA, ImportType::Function, "XamInputGetUserVibrationLevel"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01BB, ImportType::Function, "XamIsSystemTitleId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01BC, ImportType::Function, "XamLoaderIsTitleTerminatePending"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01BD, ImportType::Function, "XamInputSetTextMessengerIndicator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01BE, ImportType::Function, "XamLoaderGetPriorTitleId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01BF, ImportType::Function, "XamIsXbox1TitleId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01C0, ImportType::Function, "XamInputSetKeyLocks"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01C1, ImportType::Function, "XamInputGetKeyLocks"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01C2, ImportType::Function, "XamTaskGetStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01C3, ImportType::Function, "XamGetRootObj"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01C4, ImportType::Function, "XamDevAuthSetFault"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01C5, ImportType::Function, "XamGetDefaultSystemImage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01C6, ImportType::Function, "XamGetWCNConfigFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01C7, ImportType::Function, "XamSetPowerMode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01C8, ImportType::Function, "XamExecuteChallenge"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01C9, ImportType::Function, "XamGetDefaultImage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01CA, ImportType::Function, "XamMuteSound"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01CB, ImportType::Function, "XamGetOnlineSchema"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01CC, ImportType::Function, "XamSetDashContext"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01CD, ImportType::Function, "XamGetDashContext"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01CE, ImportType::Function, "XamIsCurrentTitleDash"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01CF, ImportType::Function, "XamGetCurrentTitleId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01D0, ImportType::Function, "XamSetCurrentTitleDash"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01D1, ImportType::Function, "XamAllocHeapFreeSpace"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01D2, ImportType::Function, "XamSetDashContextEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01D3, ImportType::Function, "XamGetDashContextEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01D4, ImportType::Function, "XamSetHudContext"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01D5, ImportType::Function, "XamGetHudContext"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01D6, ImportType::Function, "XCustomGetBannerImage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01D7, ImportType::Function, "Refresh"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01D8, ImportType::Function, "XCustomSetAction"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01D9, ImportType::Function, "XCustomGetLastActionPress"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01DA, ImportType::Function, "XCustomSetDynamicActions"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01DB, ImportType::Function, "XCustomBroadcastActionEvent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01DC, ImportType::Function, "XCustomGetLastActionPressEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01DD, ImportType::Function, "XCustomRegisterDynamicActions"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01DE, ImportType::Function, "XCustomUnregisterDynamicActions"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01DF, ImportType::Function, "XCustomGetCurrentGamercard"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01E0, ImportType::Function, "XamDbgPrint"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01E1, ImportType::Function, "XamDbgSetOutputLevel"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01E2, ImportType::Function, "XamDbgSetBreakLevel"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01E3, ImportType::Function, "XamLoaderGetMediaInfoEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01E4, ImportType::Function, "XamLoaderSetGameInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01E5, ImportType::Function, "XamFormatMessage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01E6, ImportType::Function, "XamUniSortCmpString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01E7, ImportType::Function, "XamFormatTimeString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01E8, ImportType::Function, "XamFormatDateString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01E9, ImportType::Function, "XamGetLocaleDateFormat"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01EA, ImportType::Function, "XamAlloc"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01EB, ImportType::Function, "XamAllocEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01EC, ImportType::Function, "XamFree"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01ED, ImportType::Function, "XamAllocSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01EE, ImportType::Function, "XamAllocMountIPTVHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01EF, ImportType::Function, "XamAllocUnmountIPTVHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01F0, ImportType::Function, "XamAllocFreeIPTVHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01F1, ImportType::Function, "XamDeviceRemap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01F2, ImportType::Function, "XamLoaderGetClearCache"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01F3, ImportType::Function, "XamLoaderSetClearCache"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01F4, ImportType::Function, "XMsgInProcessCall"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01F5, ImportType::Function, "XMsgCompleteIORequest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01F6, ImportType::Function, "XMsgSystemProcessCall"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01F7, ImportType::Function, "XMsgStartIORequest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01F8, ImportType::Function, "XMsgCancelIORequest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01F9, ImportType::Function, "XMsgAcquireAsyncMessageFromOverlapped"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01FA, ImportType::Function, "XMsgReleaseAsyncMessageToOverlapped"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01FB, ImportType::Function, "XamGetOverlappedResult"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01FC, ImportType::Function, "XMsgStartIORequestEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01FD, ImportType::Function, "XamAppAllocateInterappWorkspace"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01FE, ImportType::Function, "XamAppGetInterappWorkspace"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x01FF, ImportType::Function, "XamAppFreeInterappWorkspace"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0200, ImportType::Function, "XamFeatureEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0201, ImportType::Function, "XamFeatureEnforceImageBudget"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0202, ImportType::Function, "XamFeatureSetMask"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0203, ImportType::Function, "XamFeatureEnableDisable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0204, ImportType::Function, "XuiControlSetItemAssociation"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0205, ImportType::Function, "XamGetTitleGlobalStorageValue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0206, ImportType::Function, "XamSetTitleGlobalStorageValue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0207, ImportType::Function, "XamUserValidateAvatarManifest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0208, ImportType::Function, "XamUserGetDeviceContext"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0209, ImportType::Function, "XamUserLookupDevice"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x020A, ImportType::Function, "XamUserGetXUID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x020B, ImportType::Function, "XamUserLogon"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x020C, ImportType::Function, "XamUserGetGamerTag"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x020D, ImportType::Function, "XamUserGetUserIndexMask"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x020E, ImportType::Function, "XamUserGetName"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x020F, ImportType::Function, "XamLookupCommonStringByIndex"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0210, ImportType::Function, "XamUserGetSigninState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0211, ImportType::Function, "XamUserGetIndexFromXUID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0212, ImportType::Function, "XamUserCheckPrivilege"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0213, ImportType::Function, "XamUserAreUsersFriends"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0214, ImportType::Function, "XamSetUserPresetPresenceState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0215, ImportType::Function, "XamGetUserPresetPresenceState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0216, ImportType::Function, "XamUserGetUserFlagsFromXUID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0217, ImportType::Function, "XamUserGetMembershipTierFromXUID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0218, ImportType::Function, "XamUserGetOnlineCountryFromXUID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0219, ImportType::Function, "XamUserReadProfileSettings"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x021A, ImportType::Function, "XamUserWriteProfileSettings"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x021B, ImportType::Function, "XamUserGetMembershipTier"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x021C, ImportType::Function, "XamUserGetUserFlags"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x021D, ImportType::Function, "XamUserGetRequestedUserIndexMask"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x021E, ImportType::Function, "XamUserIsGuest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x021F, ImportType::Function, "XamUserProfileSync"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0220, ImportType::Function, "XamUserFlushLogonQueue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0221, ImportType::Function, "XamUserIsOnlineEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0222, ImportType::Function, "XamUserGetCachedUserFlags"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0223, ImportType::Function, "XamAreMixedAccountsSignedIn"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0224, ImportType::Function, "XamUserLogonEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0225, ImportType::Function, "XamSetUserShowMessengerFriends"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0226, ImportType::Function, "XamGetUserShowMessengerFriends"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0227, ImportType::Function, "XamUserGetSigninInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0228, ImportType::Function, "XamUserIsPartial"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0229, ImportType::Function, "XamUserGetOnlineLanguageFromXUID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x022A, ImportType::Function, "XamUserReadProfileSettingsEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x022B, ImportType::Function, "XamSystemUpdaterLogon"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x022C, ImportType::Function, "XamUserGetUsersMissingAvatars"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x022D, ImportType::Function, "XamIsChildAccountSignedIn"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x022E, ImportType::Function, "XamUserPrefetchProfileSettings"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x022F, ImportType::Function, "XamUserInvalidateProfileSetting"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0230, ImportType::Function, "XamProfileCreate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0231, ImportType::Function, "XamProfileCreateEnumerator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0232, ImportType::Function, "XamProfileEnumerate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0233, ImportType::Function, "XamProfileDelete"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0234, ImportType::Function, "XamProfileGetCreationStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0235, ImportType::Function, "XamProfileFindAccount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0236, ImportType::Function, "XamProfileRenameAccount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0237, ImportType::Function, "XamProfileOpen"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0238, ImportType::Function, "XamProfileClose"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0239, ImportType::Function, "XamProfileSaveAccountInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x023A, ImportType::Function, "XamProfileLoadAccountInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x023B, ImportType::Function, "XamProfileRecoverTitle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x023C, ImportType::Function, "XamProfileSaveWindowsLiveCredentials"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x023D, ImportType::Function, "XamProfileLoadWindowsLiveCredentials"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x023E, ImportType::Function, "XamProfileIsSaveWindowsLiveCredsEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x023F, ImportType::Function, "XamProfileSetSaveWindowsLiveCredsEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0240, ImportType::Function, "XamSetProfileReadTestHook"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0241, ImportType::Function, "XamProfileGetLastSync"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0242, ImportType::Function, "XamAccountRecoveryRecoverTitle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0243, ImportType::Function, "XamProfileControlPec"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0244, ImportType::Function, "XamAppLoad"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0245, ImportType::Function, "XamAppUnloadSelf"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0246, ImportType::Function, "XamAppUnloadStack"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0247, ImportType::Function, "XamSendMessageToLoadedApps"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0248, ImportType::Function, "XamAppRequestLoad"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0249, ImportType::Function, "XamAppUnrequestLoad"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x024A, ImportType::Function, "XamNavigate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x024B, ImportType::Function, "XamRegisterSysApp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x024C, ImportType::Function, "XamUnregisterSysApp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x024D, ImportType::Function, "XamAppReinitialize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x024E, ImportType::Function, "XamCreateEnumeratorHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x024F, ImportType::Function, "XamGetPrivateEnumStructureFromHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0250, ImportType::Function, "XamEnumerate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0251, ImportType::Function, "XamLoadSysApp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0252, ImportType::Function, "XamUnloadSysApp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0253, ImportType::Function, "XamReloadSysApp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0254, ImportType::Function, "XamAppLoadPass2SysApps"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0255, ImportType::Function, "XamProfileGetLiveLegalLocale"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0256, ImportType::Function, "XamUserIsParentalControlled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0257, ImportType::Function, "XamContentLaunchImageFromFileInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0258, ImportType::Function, "XamContentCreate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0259, ImportType::Function, "XamContentCreateEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x025A, ImportType::Function, "XamContentClose"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x025B, ImportType::Function, "XamContentDelete"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x025C, ImportType::Function, "XamContentCreateEnumerator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x025D, ImportType::Function, "XamContentCreateDeviceEnumerator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x025E, ImportType::Function, "XamContentGetDeviceData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x025F, ImportType::Function, "XamContentGetDeviceName"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0260, ImportType::Function, "XamContentSetThumbnail"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0261, ImportType::Function, "XamContentGetThumbnail"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0262, ImportType::Function, "XamContentGetCreator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0263, ImportType::Function, "XamContentLaunchImage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0264, ImportType::Function, "XamContentGetAttributes"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0265, ImportType::Function, "XamContentGetDeviceState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0266, ImportType::Function, "XamContentGetLicenseMask"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0267, ImportType::Function, "XamContentFlush"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0268, ImportType::Function, "XamContentResolve"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0269, ImportType::Function, "XamContentOpenFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x026A, ImportType::Function, "XamContentInstall"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x026B, ImportType::Function, "XamContentLockUnlockPackageHeaders"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x026C, ImportType::Function, "XamContentCopyInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x026D, ImportType::Function, "XamContentMoveInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x026E, ImportType::Function, "XamContentGetMetaDataInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x026F, ImportType::Function, "XamContentCreateEnumeratorInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0270, ImportType::Function, "XamContentDeleteInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0271, ImportType::Function, "XamContentCreateInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0272, ImportType::Function, "XamContentSetThumbnailInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0273, ImportType::Function, "XamContentLaunchImageInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0274, ImportType::Function, "XamContentWritePackageHeader"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0275, ImportType::Function, "XamContentDismountAndClosePackage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0276, ImportType::Function, "XamContentResolveInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0277, ImportType::Function, "XamContentGetAttributesInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0278, ImportType::Function, "XamContentOpenFileInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0279, ImportType::Function, "XamContentAggregateCreateEnumerator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x027A, ImportType::Function, "XamContentCreateAndMountPackage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x027B, ImportType::Function, "XamContentOpenPackageFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x027C, ImportType::Function, "XamContentMountPackage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x027D, ImportType::Function, "XamContentFlushPackage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x027E, ImportType::Function, "XamContentClosePackageFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x027F, ImportType::Function, "XamContentDuplicateFileHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0280, ImportType::Function, "XamGetExecutionId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0281, ImportType::Function, "XamGetGameRatings"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0282, ImportType::Function, "XamGetSystemVersion"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0283, ImportType::Function, "XamContentGetLocalizedString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0284, ImportType::Function, "XamContentGetDefaultDevice"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0285, ImportType::Function, "XamContentInstallInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0286, ImportType::Function, "XamContentSetMediaMetaDataInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0287, ImportType::Function, "XamContentGetDeviceSerialNumber"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0288, ImportType::Function, "XamContentGetMountedPackageByRootName"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0289, ImportType::Function, "XamContentRegisterChangeCallback"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x028A, ImportType::Function, "XamNotifyCreateListener"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x028B, ImportType::Function, "XNotifyGetNext"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x028C, ImportType::Function, "XNotifyPositionUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x028D, ImportType::Function, "XNotifyDelayUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x028E, ImportType::Function, "XNotifyBroadcast"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x028F, ImportType::Function, "XNotifyRegisterArea"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0290, ImportType::Function, "XNotifyQueueUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0291, ImportType::Function, "XamNotifyCreateListenerInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0292, ImportType::Function, "XNotifyUISetOptions"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0293, ImportType::Function, "XNotifyUIGetOptions"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0294, ImportType::Function, "XamContentLaunchImageInternalEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0295, ImportType::Function, "XamShutdown"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0296, ImportType::Function, "XamAllocDevkitHeapAvailable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0297, ImportType::Function, "XamNotifyCreateListenerRangeInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0298, ImportType::Function, "XNotifyQueueUIEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0299, ImportType::Function, "XamAppRequestLoadEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x029A, ImportType::Function, "XuiPNGTextureLoader"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x029B, ImportType::Function, "XuiRenderGetXuiDevice"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x029C, ImportType::Function, "XuiDefault_False"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x029D, ImportType::Function, "XamUserGetReportingInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x029E, ImportType::Function, "XamUpdateStart"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x029F, ImportType::Function, "XamUpdateGetProgress"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02A0, ImportType::Function, "XamUpdateGetExtenderInstance"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02A1, ImportType::Function, "XamUpdateFinish"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02A2, ImportType::Function, "XamUpdateAttachExtenderInstance"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02A3, ImportType::Function, "XamUpdateAllocateExtenderBuffer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02A4, ImportType::Function, "XamRestartTitleLoadAfterUpdate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02A5, ImportType::Function, "XamUIThreadDisableFontPatching"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02A6, ImportType::Function, "XamUpdateGetBaseSystemVersion"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02A7, ImportType::Function, "XamUpdateGetCurrentSystemVersion"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02A8, ImportType::Function, "XamUIThreadEnableFontPatching"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02A9, ImportType::Function, "XamTerminateTitleForUpdate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02AA, ImportType::Function, "XamSystemUpdateInstallLocal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02AB, ImportType::Function, "XamUpdateChainPass3FromPass2"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02AD, ImportType::Function, "XamInputGetCapabilitiesEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02AE, ImportType::Function, "XamUserIsUnsafeProgrammingAllowed"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02AF, ImportType::Function, "XamDevAuthSetFaultEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02B0, ImportType::Function, "XamUpdateGetData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02B1, ImportType::Function, "XamCacheIntegrityCheck"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02B2, ImportType::Function, "XamCacheStoreFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02B3, ImportType::Function, "XamCacheFetchFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02B4, ImportType::Function, "XamCacheOpenFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02B5, ImportType::Function, "XamCacheCloseFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02B6, ImportType::Function, "XamGetCachedTitleName"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02B7, ImportType::Function, "XamCacheReset"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02B8, ImportType::Function, "XamGetCachedGamerTag"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02B9, ImportType::Function, "XamGetCachedGamerTagW"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02BA, ImportType::Function, "XamCacheDeleteFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02BB, ImportType::Function, "XamCacheRenameFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02BC, ImportType::Function, "XamShowSigninUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02BD, ImportType::Function, "XamShowSigninUIEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02BE, ImportType::Function, "XamShowSigninUIp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02BF, ImportType::Function, "XamShowFriendsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02C0, ImportType::Function, "XamShowMessagesUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02C1, ImportType::Function, "XamShowKeyboardUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02C2, ImportType::Function, "XamShowQuickChatUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02C3, ImportType::Function, "XamShowVoiceMailUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02C4, ImportType::Function, "XamShowGamerCardUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02C5, ImportType::Function, "XamShowAchievementsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02C6, ImportType::Function, "XamShowPlayerReviewUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02C7, ImportType::Function, "XamShowMarketplaceUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02C8, ImportType::Function, "XamShowPlayersUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02C9, ImportType::Function, "XamShowUpdaterUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02CA, ImportType::Function, "XamShowMessageBoxUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02CB, ImportType::Function, "XamShowDeviceSelectorUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02CC, ImportType::Function, "XamShowMessageComposeUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02CD, ImportType::Function, "XamShowGameInviteUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02CE, ImportType::Function, "XamShowFriendRequestUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02CF, ImportType::Function, "XamShowCreateProfileUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02D0, ImportType::Function, "XamShowGamesUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02D1, ImportType::Function, "XamShowLiveSignupUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02D2, ImportType::Function, "XamShowFriendsUIp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02D3, ImportType::Function, "XamShowComplaintUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02D4, ImportType::Function, "XamShowReputationUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02D5, ImportType::Function, "XamShowGamerCardUIForXUID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02D6, ImportType::Function, "XamShowForcedNameChangeUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02D7, ImportType::Function, "XamShowLiveUpsellUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02D8, ImportType::Function, "XamShowPasscodeVerifyUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02D9, ImportType::Function, "XamShowDirtyDiscErrorUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02DA, ImportType::Function, "XamShowSignupCreditCardUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02DB, ImportType::Function, "XamShowPrivateChatInviteUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02DC, ImportType::Function, "XamShowMessageBoxUIEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02DD, ImportType::Function, "XamShowRecentMessageUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02DE, ImportType::Function, "XamShowRecentMessageUIEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02DF, ImportType::Function, "XamShowMessagesUIEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02E0, ImportType::Function, "XamShowAchievementDetailsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02E1, ImportType::Function, "XamShowPersonalizationUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02E2, ImportType::Function, "XamShowChangeGamerTileUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02E3, ImportType::Function, "XamShowVoiceSettingsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02E4, ImportType::Function, "XamShowVideoChatInviteUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02E5, ImportType::Function, "XamShowCustomMessageComposeUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02E6, ImportType::Function, "XamShowCustomPlayerListUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02E7, ImportType::Function, "XamShowMarketplaceDownloadItemsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02E8, ImportType::Function, "XamShowMarketplaceUIEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02E9, ImportType::Function, "XamShowMessageBox"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02EA, ImportType::Function, "XamIsSysUiInvokedByXenonButton"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02EB, ImportType::Function, "XamIsSysUiInvokedByTitle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02EC, ImportType::Function, "XamIsUIActive"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02ED, ImportType::Function, "XamSysUiDisableAutoClose"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02EE, ImportType::Function, "XamUserCreateAchievementEnumerator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02EF, ImportType::Function, "XamReadTile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02F0, ImportType::Function, "XamWriteGamerTile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02F1, ImportType::Function, "XamWriteTile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02F2, ImportType::Function, "XamReadImage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02F3, ImportType::Function, "XamUserCreateTitlesPlayedEnumerator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02F4, ImportType::Function, "XamDecompressPNGToTexture"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02F5, ImportType::Function, "XamReadTileToTexture"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02F6, ImportType::Function, "XamReadString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02F7, ImportType::Function, "XamUserCreateStatsEnumerator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02F8, ImportType::Function, "XamPrepareGamerTiles"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02F9, ImportType::Function, "XamClearTitle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02FA, ImportType::Function, "XamReadStrings"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02FB, ImportType::Function, "XamWriteGamerTileEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02FC, ImportType::Function, "XamReadTileEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02FD, ImportType::Function, "XamReadTileToTextureEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02FE, ImportType::Function, "XamShowMessengerUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x02FF, ImportType::Function, "XamShowKeyboardUIMessenger"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0300, ImportType::Function, "XamShowLiveUpsellUIEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0301, ImportType::Function, "XamShowJoinSessionInProgressUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0302, ImportType::Function, "XamShowGraduateUserUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0303, ImportType::Function, "XamShowGamerCardUIForXUIDp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0304, ImportType::Function, "XamShowGuideUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0305, ImportType::Function, "XamShowPartyUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0306, ImportType::Function, "XamShowPartyInviteUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0307, ImportType::Function, "XamUserAddRecentPlayer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0308, ImportType::Function, "XamUserUpdateRecentPlayer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0309, ImportType::Function, "XamUserCreatePlayerEnumerator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x030A, ImportType::Function, "XamParseGamerTileKey"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x030B, ImportType::Function, "XamShowCommunitySessionsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x030C, ImportType::Function, "XamVoiceCreate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x030D, ImportType::Function, "XamVoiceHeadsetPresent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x030E, ImportType::Function, "XamVoiceSubmitPacket"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x030F, ImportType::Function, "XamVoiceClose"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0310, ImportType::Function, "XamVoiceGetBatteryStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0311, ImportType::Function, "Refresh"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0312, ImportType::Function, "Refresh"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0313, ImportType::Function, "XamShowJoinSessionByIdInProgressUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0314, ImportType::Function, "XamShowPartyJoinInProgressUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0315, ImportType::Function, "XamBuildSharedSystemResourceLocator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0316, ImportType::Function, "XamSessionCreateHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0317, ImportType::Function, "XamSessionRefObjByHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0318, ImportType::Function, "XamVoiceGetMicArrayStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0319, ImportType::Function, "XamVoiceSetAudioCaptureRoutine"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x031A, ImportType::Function, "XamVoiceGetDirectionalData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x031B, ImportType::Function, "XamBuildResourceLocator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x031C, ImportType::Function, "XamBuildLegacySystemResourceLocator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x031D, ImportType::Function, "XamBuildGamercardResourceLocator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x031E, ImportType::Function, "XamBuildDynamicResourceLocator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x031F, ImportType::Function, "XamBuildXamResourceLocator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0320, ImportType::Function, "XuiAnimRun"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0321, ImportType::Function, "XuiApplyLocale"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0322, ImportType::Function, "XuiBubbleMessage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0323, ImportType::Function, "XuiControlIsBackButton"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0324, ImportType::Function, "XuiControlIsNavButton"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0325, ImportType::Function, "XuiCreateObject"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0326, ImportType::Function, "XuiDestroyObject"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0327, ImportType::Function, "XuiDynamicCast"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0328, ImportType::Function, "XuiElementAddChild"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0329, ImportType::Function, "XuiElementFindNamedFrame"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x032A, ImportType::Function, "XuiElementGetChildById"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x032B, ImportType::Function, "XuiElementGetFirstChild"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x032C, ImportType::Function, "XuiElementGetFocus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x032D, ImportType::Function, "XuiElementGetFocusUser"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x032E, ImportType::Function, "XuiElementGetId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x032F, ImportType::Function, "XuiElementGetLastChild"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0330, ImportType::Function, "XuiElementGetNext"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0331, ImportType::Function, "XuiElementGetParent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0332, ImportType::Function, "XuiElementGetUserFocus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0333, ImportType::Function, "XuiElementInitFocus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0334, ImportType::Function, "XuiElementInitUserFocus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0335, ImportType::Function, "XuiElementPlayTimeline"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0336, ImportType::Function, "XuiElementSetBounds"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0337, ImportType::Function, "XuiElementSetFocus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0338, ImportType::Function, "XuiElementSetUserFocus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0339, ImportType::Function, "XuiElementTreeGetFocus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x033A, ImportType::Function, "XuiFindClass"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x033B, ImportType::Function, "XuiFreeStringTable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x033C, ImportType::Function, "XuiGetBaseObject"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x033D, ImportType::Function, "XuiGetClass"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x033E, ImportType::Function, "XuiGetObjectClass"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x033F, ImportType::Function, "XuiGetOuter"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0340, ImportType::Function, "XuiInit"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0341, ImportType::Function, "XuiLoadFromBinary"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0342, ImportType::Function, "XuiLoadStringTableFromFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0343, ImportType::Function, "XuiVisualGetBasePath"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0344, ImportType::Function, "XuiLookupStringTable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0345, ImportType::Function, "XuiNavButtonGetPressPath"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0346, ImportType::Function, "XuiObjectFromHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0347, ImportType::Function, "XuiObjectGetProperty"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0348, ImportType::Function, "XuiObjectGetPropertyId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0349, ImportType::Function, "XuiProcessInput"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x034A, ImportType::Function, "XuiRegisterClass"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x034B, ImportType::Function, "XuiRenderBegin"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x034C, ImportType::Function, "XuiRenderCreateDC"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x034D, ImportType::Function, "XuiRenderDCDeviceChanged"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x034E, ImportType::Function, "XuiRenderDestroyDC"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x034F, ImportType::Function, "XuiRenderEnd"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0350, ImportType::Function, "XuiRenderGetBackBufferSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0351, ImportType::Function, "XuiRenderInit"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0352, ImportType::Function, "XuiRenderInitShared"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0353, ImportType::Function, "XuiRenderPresent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0354, ImportType::Function, "XuiRenderSetViewTransform"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0355, ImportType::Function, "XuiRenderUninit"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0356, ImportType::Function, "XamShowNuiGuideUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0357, ImportType::Function, "XuiSceneCreate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0358, ImportType::Function, "XuiSceneNavigateBack"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0359, ImportType::Function, "XuiSceneNavigateFirst"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x035A, ImportType::Function, "XuiSceneNavigateForward"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x035B, ImportType::Function, "XuiScenePlayBackFromTransition"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x035C, ImportType::Function, "XuiScenePlayBackToTransition"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x035D, ImportType::Function, "XuiScenePlayFromTransition"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x035E, ImportType::Function, "XuiScenePlayToTransition"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x035F, ImportType::Function, "XuiSendMessage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0360, ImportType::Function, "XuiSetLocale"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0361, ImportType::Function, "XuiUninit"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0362, ImportType::Function, "XuiUnregisterClass"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0363, ImportType::Function, "XuiTextElementSetText"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0364, ImportType::Function, "XuiSetTimer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0365, ImportType::Function, "XuiTimersRun"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0366, ImportType::Function, "XuiTextElementGetText"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0367, ImportType::Function, "XuiVisualSetBasePath"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0368, ImportType::Function, "XuiHandleIsValid"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0369, ImportType::Function, "XuiAlloc"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x036A, ImportType::Function, "XuiFree"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x036B, ImportType::Function, "XuiDefault_True"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x036C, ImportType::Function, "XuiDefault_EmptyString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x036D, ImportType::Function, "XuiDefault_IntegerZero"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x036E, ImportType::Function, "XuiCopyString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x036F, ImportType::Function, "XuiRealloc"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0370, ImportType::Function, "XuiControlPlayOptionalVisual"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0371, ImportType::Function, "XuiKillTimer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0372, ImportType::Function, "XuiElementEnableInput"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0373, ImportType::Function, "XuiElementInputEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0374, ImportType::Function, "XuiIsInstanceOf"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0375, ImportType::Function, "XuiResourceComposeLocator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0376, ImportType::Function, "XuiResourceLocatorIsAbsolute"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0377, ImportType::Function, "XuiBroadcastMessage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0378, ImportType::Function, "XuiElementDisallowRecursiveTimelineControl"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0379, ImportType::Function, "XUIElementPropVal_Construct"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x037A, ImportType::Function, "XUIElementPropVal_Destruct"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x037B, ImportType::Function, "XUIElementPropVal_SetString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x037C, ImportType::Function, "XuiObjectSetProperty"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x037D, ImportType::Function, "XuiElementGetOpacity"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x037E, ImportType::Function, "XuiElementSetOpacity"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x037F, ImportType::Function, "XuiEditSetTextLimit"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0380, ImportType::Function, "XuiEditGetTextLimit"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0381, ImportType::Function, "XuiSliderSetValue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0382, ImportType::Function, "XuiSliderGetValue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0383, ImportType::Function, "XuiSliderSetRange"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0384, ImportType::Function, "XuiElementUnlink"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0385, ImportType::Function, "XuiElementInsertChild"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0386, ImportType::Function, "XuiSceneNavigateBackToFirst"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0387, ImportType::Function, "XuiProgressBarSetRange"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0388, ImportType::Function, "XuiProgressBarSetValue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0389, ImportType::Function, "XuiProgressBarGetValue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x038A, ImportType::Function, "XuiControlAttachVisual"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x038B, ImportType::Function, "XuiCreateTextureBrush"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x038C, ImportType::Function, "XuiDestroyBrush"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x038D, ImportType::Function, "XUIElementPropVal_SetColorFromUint"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x038E, ImportType::Function, "XuiFigureSetFill"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x038F, ImportType::Function, "XuiSliderGetRange"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0390, ImportType::Function, "XuiFigureSetTexture"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0391, ImportType::Function, "XuiControlGetItemAssociation"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0392, ImportType::Function, "XuiResourceLoadAll"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0393, ImportType::Function, "XuiImageElementSetImagePath"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0394, ImportType::Function, "XuiImageElementGetImagePath"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0395, ImportType::Function, "XuiControlGetVisual"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0396, ImportType::Function, "XuiControlGetNavigation"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0397, ImportType::Function, "XuiLookupStringTableByIndex"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0398, ImportType::Function, "XUIElementPropVal_SetBool"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0399, ImportType::Function, "XuiElementHasFocus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x039A, ImportType::Function, "XUIElementPropVal_SetUint"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x039B, ImportType::Function, "XUIElementPropVal_Clear"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x039C, ImportType::Function, "XuiEditSetTextFormatInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x039D, ImportType::Function, "XuiCreateSolidBrush"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x039E, ImportType::Function, "XuiSceneInterruptTransitions"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x039F, ImportType::Function, "XuiResourceOpen"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03A0, ImportType::Function, "XuiResourceRead"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03A1, ImportType::Function, "XuiResourceClose"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03A2, ImportType::Function, "XuiVisualCreateInstance"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03A3, ImportType::Function, "XuiElementGetTimeline"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03A4, ImportType::Function, "GetCodecVersion"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03A5, ImportType::Function, "XuiElementIsDescendant"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03A6, ImportType::Function, "XuiSetMessageFilter"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03A7, ImportType::Function, "XuiAttachTextureBrush"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03A8, ImportType::Function, "XuiElementBeginRender"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03A9, ImportType::Function, "XuiElementEndRender"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03AA, ImportType::Function, "XuiDrawShape"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03AB, ImportType::Function, "XuiSelectBrushEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03AC, ImportType::Function, "XuiFigureGetShape"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03AD, ImportType::Function, "XuiFillRect"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03AE, ImportType::Function, "XuiVec2TransformCoord"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03AF, ImportType::Function, "XuiMatrixMultiply"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03B0, ImportType::Function, "XuiElementGetXForm"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03B1, ImportType::Function, "XuiElementSetPosition"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03B2, ImportType::Function, "XuiSelectBrush"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03B3, ImportType::Function, "XuiElementRenderChildren"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03B4, ImportType::Function, "XuiFreeUnusedTextures"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03B5, ImportType::Function, "XuiListEnableItemOverride"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03B6, ImportType::Function, "XuiListGetDefaultItemSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03B7, ImportType::Function, "XuiResourceSeek"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03B8, ImportType::Function, "XuiElementDiscardResources"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03B9, ImportType::Function, "XuiTabSceneGoto"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03BA, ImportType::Function, "XuiTabSceneGetCurrentTab"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03BB, ImportType::Function, "XamShowWhatsOnUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03BC, ImportType::Function, "XamShowEditProfileUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03BD, ImportType::Function, "XamShowStorePickerUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03BE, ImportType::Function, "XamShowTermsOfUseUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03BF, ImportType::Function, "XamShowJoinPartyUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03C0, ImportType::Function, "XamShowWordRegisterUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03C1, ImportType::Function, "XamOverrideHudOpenType"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03C2, ImportType::Function, "XamShowAchievementsUIEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03C3, ImportType::Function, "XamUserGetUserTenure"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03C4, ImportType::Function, "XamUserGetSubscriptionType"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03C5, ImportType::Function, "XamShowGameVoiceChannelUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03C6, ImportType::Function, "XamShowAvatarAwardsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03C7, ImportType::Function, "XamShowAvatarAwardGamesUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03C8, ImportType::Function, "XamShowVideoRichPresenceUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03C9, ImportType::Function, "XamHudGetUserIndex"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03CA, ImportType::Function, "XGetAudioFlags"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03CB, ImportType::Function, "XGetAVPack"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03CC, ImportType::Function, "XGetGameRegion"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03CD, ImportType::Function, "XGetLanguage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03CE, ImportType::Function, "XapipGetLocale"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03CF, ImportType::Function, "XGetVideoFlags"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03D0, ImportType::Function, "XGetVideoStandard"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03D1, ImportType::Function, "XGetVideoMode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03D2, ImportType::Function, "XamGetLanguage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03D3, ImportType::Function, "XUITimeline_Run"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03D4, ImportType::Function, "XamSetAutomation"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03D5, ImportType::Function, "XAutomationpBindController"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03D6, ImportType::Function, "XAutomationpUnbindController"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03D7, ImportType::Function, "XAutomationpInputXenonButton"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03D8, ImportType::Function, "XAutomationpInputPress"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03D9, ImportType::Function, "XAutomationpInputSetState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03DA, ImportType::Function, "XamEnableOverdraw"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03DB, ImportType::Variable, "g_XuiAutomation"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03DC, ImportType::Function, "XamVoiceGetMicArrayAudio"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03DD, ImportType::Function, "XampSystemInput"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03DE, ImportType::Function, "XamInputControl"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03DF, ImportType::Function, "XuiElementGetPosition"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03E0, ImportType::Function, "XamIsMessageBoxActive"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03E1, ImportType::Function, "XamIsBackgroundSceneInTransition"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03E2, ImportType::Function, "XuiElementTreeHasFocus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03E3, ImportType::Function, "XuiFigureClose"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03E4, ImportType::Function, "GamerCardStartup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03E5, ImportType::Function, "GamerCardCleanup"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03E6, ImportType::Function, "GamerCardRegisterControls"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03E7, ImportType::Function, "GamerCardUnregisterControls"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03E8, ImportType::Function, "RtlFindFirstFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03E9, ImportType::Function, "RtlFindNextFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03EA, ImportType::Function, "RtlGetModuleFileName"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03EB, ImportType::Function, "RtlOutputDebugString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03EC, ImportType::Function, "RtlRemoveDirectory"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03ED, ImportType::Function, "RtlSleep"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03EE, ImportType::Function, "RtlGetLastError"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03EF, ImportType::Function, "RtlSetLastError"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03F0, ImportType::Function, "RtlSetLastNTError"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03F1, ImportType::Function, "RtlDebugPrint"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03F2, ImportType::Function, "RtlDebugError"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03F3, ImportType::Function, "XDebugWarning"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03F4, ImportType::Function, "RtlDebugTrace"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03F5, ImportType::Function, "RtlDebugEntry"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03F6, ImportType::Function, "RtlDebugExit"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03F7, ImportType::Function, "RtlGetAttributesOnHeapAlloc"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03F8, ImportType::Function, "RtlSetAttributesOnHeapAlloc"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03F9, ImportType::Function, "XuiFigureSetShape"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03FA, ImportType::Function, "RtlCreateHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03FB, ImportType::Function, "RtlDestroyHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03FC, ImportType::Function, "RtlAllocateHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03FD, ImportType::Function, "RtlAllocateHeapSlowly"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03FE, ImportType::Function, "RtlReAllocateHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x03FF, ImportType::Function, "RtlFreeHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0400, ImportType::Function, "RtlFreeHeapSlowly"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0401, ImportType::Function, "RtlSizeHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0402, ImportType::Function, "RtlZeroHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0403, ImportType::Function, "RtlDebugWalkHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0404, ImportType::Function, "RtlWalkHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0405, ImportType::Function, "RtlLockHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0406, ImportType::Function, "RtlUnlockHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0407, ImportType::Function, "RtlValidateHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0408, ImportType::Function, "RtlDebugCompactHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0409, ImportType::Function, "RtlCompactHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x040A, ImportType::Function, "XamAppSetTestOption"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x040B, ImportType::Function, "XamAppReportError"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x040C, ImportType::Function, "XamIsNuiUIActive"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x040D, ImportType::Function, "XamVerifyPasscode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x040E, ImportType::Function, "OutputDebugStringA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x040F, ImportType::Function, "DebugBreak"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0410, ImportType::Function, "GetCurrentThreadId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0411, ImportType::Function, "XDebugError"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0412, ImportType::Function, "XDebugWarning"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0413, ImportType::Function, "RtlDebugSetLevel"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0414, ImportType::Function, "CloseHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0415, ImportType::Function, "GetTickCount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0416, ImportType::Function, "GetLastError"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0417, ImportType::Function, "SetFilePointer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0418, ImportType::Function, "SetFilePointerEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0419, ImportType::Function, "SetLastError"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x041A, ImportType::Function, "MultiByteToWideChar"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x041B, ImportType::Function, "WideCharToMultiByte"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x041C, ImportType::Function, "ReadFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x041D, ImportType::Function, "FlushFileBuffers"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x041E, ImportType::Function, "WriteFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x041F, ImportType::Function, "OutputDebugStringW"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0420, ImportType::Function, "SetEvent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0421, ImportType::Function, "XapiFormatTimeOut"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0422, ImportType::Function, "CreateMutexA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0423, ImportType::Function, "OpenMutexA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0424, ImportType::Function, "ReleaseMutex"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0425, ImportType::Function, "WaitForSingleObject"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0426, ImportType::Function, "WaitForSingleObjectEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0427, ImportType::Function, "GetFileSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0428, ImportType::Function, "GetFileSizeEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0429, ImportType::Function, "XapiDirectoryInformationToFindData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x042A, ImportType::Function, "XapiFormatObjectAttributes"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x042B, ImportType::Function, "ResetEvent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x042C, ImportType::Function, "wsprintfA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x042D, ImportType::Function, "wsprintfW"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x042E, ImportType::Function, "GetOverlappedResult"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x042F, ImportType::Function, "QueryPerformanceCounter"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0430, ImportType::Function, "QueryPerformanceFrequency"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0431, ImportType::Function, "LocalAlloc"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0432, ImportType::Function, "LocalFree"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0433, ImportType::Function, "RaiseException"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0434, ImportType::Function, "RtlUniform"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0435, ImportType::Function, "RtlRandom"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0436, ImportType::Function, "Sleep"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0437, ImportType::Function, "SleepEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0438, ImportType::Function, "XMemSet"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0439, ImportType::Function, "XRegisterThreadNotifyRoutine"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x043A, ImportType::Function, "XGetOverlappedExtendedError"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x043B, ImportType::Function, "XGetOverlappedResult"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x043C, ImportType::Function, "CreateThread"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x043D, ImportType::Function, "ResumeThread"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x043E, ImportType::Function, "ExitThread"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x043F, ImportType::Function, "GetTimeZoneInformation"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0440, ImportType::Function, "GetSystemTimeAsFileTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0441, ImportType::Function, "SystemTimeToFileTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0442, ImportType::Function, "FileTimeToSystemTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0443, ImportType::Function, "GetSystemTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0444, ImportType::Function, "GetLocalTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0445, ImportType::Function, "CreateDirectoryA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0446, ImportType::Function, "CreateEventA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0447, ImportType::Function, "CreateFileA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0448, ImportType::Function, "DeleteFileA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0449, ImportType::Function, "FindFirstFileA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x044A, ImportType::Function, "FindNextFileA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x044B, ImportType::Function, "GetFileAttributesA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x044C, ImportType::Function, "XamLoaderGetCurrentTitleD3DVersion"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x044D, ImportType::Function, "GetFileAttributesExA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x044E, ImportType::Function, "GetModuleHandleA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x044F, ImportType::Function, "GetDiskFreeSpaceExA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0450, ImportType::Function, "CopyFileA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0451, ImportType::Function, "SetEndOfFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0452, ImportType::Function, "XamFamilyAddParentalExemptionToList"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0453, ImportType::Function, "XamFamilyIsParentalValidationRequired"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0454, ImportType::Function, "PIXBeginCapture"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0455, ImportType::Function, "PIXEndCapture"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0456, ImportType::Function, "PIXAddCounter"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0457, ImportType::Function, "PIXGetGPUSlot"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0458, ImportType::Function, "SetWaitableTimer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0459, ImportType::Function, "CancelWaitableTimer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x045A, ImportType::Function, "CreateWaitableTimerA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x045B, ImportType::Function, "DuplicateHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x045C, ImportType::Function, "XapipCreateThread"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x045D, ImportType::Function, "lstrcpyA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x045E, ImportType::Function, "lstrcpyW"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x045F, ImportType::Function, "lstrcpynA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0460, ImportType::Function, "lstrcpynW"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0461, ImportType::Function, "lstrcatA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0462, ImportType::Function, "lstrcatW"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0463, ImportType::Function, "lstrlenA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0464, ImportType::Function, "lstrlenW"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0465, ImportType::Function, "IsBadReadPtr"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0466, ImportType::Function, "IsBadWritePtr"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0467, ImportType::Function, "FileTimeToLocalFileTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0468, ImportType::Function, "XMemCpy"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0469, ImportType::Function, "XMemCpyStreaming"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x046A, ImportType::Function, "XamHudSetUserIndex"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x046B, ImportType::Function, "XamShowNuiTroubleshooterUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x046C, ImportType::Function, "XamTestShowNuiTroubleshooterUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x046D, ImportType::Function, "XamShowPasscodeVerifyUIEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x046E, ImportType::Function, "XamShowNuiAchievementsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x046F, ImportType::Function, "XamShowNuiCommunitySessionsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0470, ImportType::Function, "XamShowNuiDeviceSelectorUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0471, ImportType::Function, "XamShowNuiDirtyDiscErrorUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0472, ImportType::Function, "XamShowNuiFriendsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0473, ImportType::Function, "XamShowNuiGameInviteUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0474, ImportType::Function, "XamShowNuiGamerCardUIForXUID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0475, ImportType::Function, "XamShowNuiMarketplaceDownloadItemsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0476, ImportType::Function, "XamShowNuiMarketplaceUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0477, ImportType::Function, "XamShowNuiMessageBoxUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0478, ImportType::Function, "XamShowNuiPartyUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0479, ImportType::Function, "XamShowNuiFriendRequestUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x047A, ImportType::Function, "XamShowNuiSigninUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x047B, ImportType::Function, "XamShowNuiControllerRequiredUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x047C, ImportType::Function, "XamShowNuiGamesUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x047D, ImportType::Function, "XamShowNuiHardwareRequiredUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x047E, ImportType::Function, "XamCacheStoreFileByString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x047F, ImportType::Function, "XamCacheFetchFileByString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0480, ImportType::Function, "XamCacheDeleteFileByString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0481, ImportType::Function, "XamGetCachedTitleNameEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0482, ImportType::Function, "XamXlfsInitializeUploadQueue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0483, ImportType::Function, "XamXlfsUninitializeUploadQueue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0484, ImportType::Function, "XamXlfsMountUploadQueueInstance"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0485, ImportType::Function, "XamXlfsUnmountUploadQueueInstance"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0486, ImportType::Function, "XamVoiceRecordUserPrivileges"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0487, ImportType::Function, "XamXlfsInitializeUploadQueueWithTestHooks"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0488, ImportType::Function, "XamXlfsNotifyContentDeletion"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0489, ImportType::Function, "XMemAlloc"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x048A, ImportType::Function, "XMemFree"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x048B, ImportType::Function, "XMemSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x048C, ImportType::Function, "XamVoiceSetMicArrayIdleUsers"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x048D, ImportType::Function, "XamVoiceMuteMicArray"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x048E, ImportType::Function, "XamVoiceGetMicArrayUnderrunStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x048F, ImportType::Function, "XuiSceneEnableTransitionDependency"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0490, ImportType::Function, "XamVoiceGetMicArrayAudioEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0491, ImportType::Function, "XamVoiceDisableMicArray"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0497, ImportType::Function, "XamVoiceIsActiveProcess"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x04B0, ImportType::Function, "XMPRegisterCodec"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0514, ImportType::Function, "XamIsCurrentTitleIptv"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0515, ImportType::Function, "XamIsIptvEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0516, ImportType::Function, "XamIsDvrRecording"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0517, ImportType::Function, "XamIptvUninstall"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0518, ImportType::Function, "XamGetDvrStorage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0519, ImportType::Function, "XamSetDvrStorage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x051A, ImportType::Function, "XamIptvGetServiceName"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x051B, ImportType::Function, "XamNuiHudGetEngagedEnrollmentIndex"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0578, ImportType::Function, "XamReminderGetItems"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0579, ImportType::Function, "XamReminderClearItems"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x057A, ImportType::Function, "XamReminderItemAdd"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x057B, ImportType::Function, "XamReminderItemRemove"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x057C, ImportType::Function, "XamReminderGetNextItem"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x057D, ImportType::Function, "XamReminderGetModifiedTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x057E, ImportType::Function, "XamReminderClearCache"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05DC, ImportType::Function, "XamAvatarInitialize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05DD, ImportType::Function, "XamAvatarShutdown"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05DE, ImportType::Function, "XamAvatarGetManifestLocalUser"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05DF, ImportType::Function, "XamAvatarGetManifestsByXuid"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05E0, ImportType::Function, "XamAvatarGetAssetsResultSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05E1, ImportType::Function, "XamAvatarGetAssets"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05E2, ImportType::Function, "XamAvatarGenerateMipMaps"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05E3, ImportType::Function, "XamAvatarSetCustomAsset"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05E4, ImportType::Function, "XamAvatarSetManifest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05E5, ImportType::Function, "EnumerateMediaObjects"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05E6, ImportType::Function, "EnumerateMediaObjects"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05E7, ImportType::Function, "XamAvatarLoadAnimation"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05E8, ImportType::Function, "XamAvatarBeginEnumAssets"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05E9, ImportType::Function, "XamAvatarEndEnumAssets"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05EA, ImportType::Function, "XamAvatarEnumAssets"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05EB, ImportType::Function, "XamAvatarGetMetadataRandom"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05EC, ImportType::Function, "EnumerateMediaObjects"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05ED, ImportType::Function, "EnumerateMediaObjects"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05EE, ImportType::Function, "XamAvatarGetMetadataSignedOutProfileCount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05EF, ImportType::Function, "XamAvatarGetMetadataSignedOutProfile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05F0, ImportType::Function, "EnumerateMediaObjects"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05F1, ImportType::Function, "XamAvatarManifestGetBodyType"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05F2, ImportType::Function, "XamAvatarGetInstrumentation"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05F3, ImportType::Function, "XamAvatarGetAssetIcon"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05F4, ImportType::Function, "XamAvatarWearNow"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05F5, ImportType::Function, "XamAvatarGetAssetBinary"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05F6, ImportType::Function, "XamAvatarReinstallAwardedAsset"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05F7, ImportType::Function, "XamAvatarGetInstalledAssetPackageDescription"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x05F8, ImportType::Function, "XamAvatarSetMocks"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x060E, ImportType::Function, "XamContentMountInstalledGame"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x060F, ImportType::Function, "XamContentIsGameInstalledToHDD"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0610, ImportType::Function, "XamContentQueryLicenseInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0611, ImportType::Function, "XamContentGetDeviceVolumePath"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0612, ImportType::Function, "XamContentDeviceCheckUpdates"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0613, ImportType::Function, "XamContentGetHeaderInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0640, ImportType::Function, "XamPackageManagerFindPackageContainingIndexedXEX"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0641, ImportType::Function, "XamPackageManagerReinitialize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0642, ImportType::Function, "XamPackageManagerGetAuthoritativeManifestVersion"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0643, ImportType::Function, "XamGetCurrentSystemOnlineManifestRevision"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0644, ImportType::Function, "XamPackageManagerDeleteExtendedPartition"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0645, ImportType::Function, "XamPackageManagerHasExtendedPartition"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0646, ImportType::Function, "XamPackageManagerGetExperienceMode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0647, ImportType::Function, "XamPackageManagerGetFeatureRequiresUpdateStrings"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0648, ImportType::Function, "XamPackageManagerGetFileSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0649, ImportType::Function, "XampDemandUpdateGetAttributes"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x064A, ImportType::Function, "XampDemandUpdateGetExtendedAttributes"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x064B, ImportType::Function, "XampDemandUpdateGetInstance"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x064C, ImportType::Function, "XampDemandUpdateSetRefreshTestFlags"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x064D, ImportType::Function, "XampDemandUpdateIsRefreshTestFlagSet"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x064E, ImportType::Function, "XampDemandUpdateGetManifestLocalPath"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x064F, ImportType::Function, "XampDemandUpdateRefreshManifest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0650, ImportType::Function, "XdfInitialize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0651, ImportType::Function, "XdfShutdown"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0652, ImportType::Function, "XdfGetExpectedDownloadSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0653, ImportType::Function, "XdfGetItem"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0654, ImportType::Function, "XdfCacheItem"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0655, ImportType::Function, "XdfLoadXexFromCache"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0656, ImportType::Function, "XdfLoadXex"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0657, ImportType::Function, "XdfCancelRequest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0658, ImportType::Function, "XdfResumeDelayedItem"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0659, ImportType::Function, "XdfLaunchNewImageFromCache"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x065A, ImportType::Function, "XampDemandUpdateRefreshManifestDuringLogon"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x065B, ImportType::Function, "XampDemandUpdateCheckOnlineManifestChanged"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x065C, ImportType::Function, "XampDemandUpdateRunCacheCleaner"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0686, ImportType::Function, "XamXStudioRequest"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x06A4, ImportType::Function, "XamShowAvatarMiniCreatorUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x06A5, ImportType::Function, "XamShowGoldUpgradeUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x06A6, ImportType::Function, "XamResumeUpdaterUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x06A7, ImportType::Function, "XamShowDirectAcquireUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x06A8, ImportType::Function, "XamShowPaymentOptionsUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0708, ImportType::Function, "XamGetLiveHiveValueA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0709, ImportType::Function, "XamGetLiveHiveValueW"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x070A, ImportType::Function, "XamGetLiveHiveValueDuringLogonAttemptA"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x076C, ImportType::Function, "XamDownloadMarketplaceStoresList"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x076D, ImportType::Function, "XamGetStoreFront"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x076E, ImportType::Function, "XamSetStagingMode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x076F, ImportType::Function, "XamGetStagingMode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0770, ImportType::Function, "XamAppGetSessionId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07D0, ImportType::Function, "XamDoesOmniNeedConfiguration"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07D1, ImportType::Function, "XamFirstRunExperienceShouldRun"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07D2, ImportType::Function, "GetProcessHeap"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07D3, ImportType::Function, "UnhandledExceptionFilter"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07D4, ImportType::Function, "SetUnhandledExceptionFilter"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07D5, ImportType::Function, "XamIsOptionalMediaUpdateInstalled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07D6, ImportType::Function, "XamShowOptionalMediaUpdateRequiredUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07D7, ImportType::Function, "XamShowOptionalMediaUpdateRequiredUIEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07D8, ImportType::Function, "XamShowFirstRunWelcomeUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07D9, ImportType::Function, "XamTaskCreateQueueEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07DA, ImportType::Function, "XamSetDashBackstackData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07DB, ImportType::Function, "XamLaunchAvatarEditor"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07DC, ImportType::Function, "XamGetDashBackstackData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07DD, ImportType::Function, "XamGetDashBackstackNodesCount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07DE, ImportType::Function, "XamSetLastActiveUserData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07DF, ImportType::Function, "XamGetLastActiveUserData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07E0, ImportType::Function, "XamSetActiveDashAppInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x07E1, ImportType::Function, "XamGetActiveDashAppInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0802, ImportType::Function, "XamUserCreateAvatarAssetEnumerator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0803, ImportType::Function, "XamInitializeGameTileCache"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0804, ImportType::Function, "XamDestroyGameTileCache"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0805, ImportType::Function, "XamReadGameTileImage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0806, ImportType::Function, "XamShouldThrottleAccountInfoCall"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0807, ImportType::Function, "XuiClassDerivesFrom"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0808, ImportType::Function, "XuiFreeVisuals"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0809, ImportType::Function, "XuiGetBaseClass"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x080A, ImportType::Function, "XuiLoadVisualFromBinary"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x080B, ImportType::Function, "XuiResourceGetBuffer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x080C, ImportType::Function, "XuiResourceGetTotalSize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x080D, ImportType::Function, "XuiElementGetUserData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x080E, ImportType::Function, "XuiElementSetUserData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x080F, ImportType::Function, "XuiTabSceneGetCount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0810, ImportType::Function, "XuiSliderGetStep"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0811, ImportType::Function, "XuiSliderSetStep"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0812, ImportType::Function, "XuiProgressBarGetRange"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0813, ImportType::Function, "XuiElementSetHittable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0814, ImportType::Function, "XuiElementPlayNamedFrames"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0815, ImportType::Function, "XuiElementGetPivot"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0816, ImportType::Function, "XuiElementGetPrev"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0817, ImportType::Function, "XuiElementGetScale"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0818, ImportType::Function, "XuiElementSetPivot"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0819, ImportType::Function, "XuiElementSetRotation"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x081A, ImportType::Function, "XuiElementSetScale"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x081B, ImportType::Function, "XuiControlWantsUnfocusedInput"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x081C, ImportType::Function, "XuiResourceOpenNoLoc"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x081D, ImportType::Function, "XuiResourceReleasePackage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x081E, ImportType::Function, "XuiResourceGetPackageEntryInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x081F, ImportType::Function, "XuiResourceGetPackageEntryCount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0820, ImportType::Function, "XuiResourceOpenPackage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0821, ImportType::Function, "XamCodeCoverageFileOpen"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0822, ImportType::Function, "XamCodeCoverageFileClose"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0823, ImportType::Function, "XamCodeCoverageFileLseek"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0824, ImportType::Function, "XamCodeCoverageFileRead"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0825, ImportType::Function, "XamCodeCoverageFileWrite"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0826, ImportType::Function, "Refresh"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0827, ImportType::Function, "XampHeapGetInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0828, ImportType::Function, "XampHeapGetCount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0829, ImportType::Function, "XamShowPamUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x082A, ImportType::Function, "XuiElementLayoutTree"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x082B, ImportType::Function, "XamRegisterScreenSaverCallback"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x082C, ImportType::Function, "XUIElementPropVal_SetInt"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x082D, ImportType::Function, "XUIElementPropVal_SetFloat"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x082E, ImportType::Function, "XuiObjectGetPropertyDef"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x082F, ImportType::Function, "XuiRenderGetDevice"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0830, ImportType::Function, "XuiRenderRestoreState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0831, ImportType::Function, "XuiElementGetFullXForm"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0832, ImportType::Function, "XuiRenderGetViewTransform"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0833, ImportType::Function, "XuiRenderGetColorSpace"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0834, ImportType::Function, "XamPngEncode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0835, ImportType::Function, "XamPngDecode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0836, ImportType::Function, "XamPngEncodeEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0837, ImportType::Function, "XuiTextElementMeasureText"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0838, ImportType::Function, "XamLoaderShouldConfirmReboot"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0839, ImportType::Function, "XamLoaderRebootToDash"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x083A, ImportType::Function, "XamNuiHudGetEngagedTrackingID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x083B, ImportType::Function, "XamLoaderLaunchTitleForReason"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x083C, ImportType::Function, "XamNuiHudSetEngagedTrackingID"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x083E, ImportType::Function, "XamSetupTexture"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0841, ImportType::Function, "XamSetupCameraPreviewStuff"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0842, ImportType::Function, "XamReleaseCameraPreviewStuff"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0843, ImportType::Function, "XamRenderCameraPreviewStuff"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0848, ImportType::Function, "XamAccountRecoveryGetSetTitleSyncTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0849, ImportType::Function, "XamReadBiometricData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x084A, ImportType::Function, "XamWriteBiometricData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x084B, ImportType::Function, "XamD3DResourceDescriptorCreate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x084C, ImportType::Function, "XamD3DResourceDescriptorAddRef"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x084D, ImportType::Function, "XamD3DResourceDescriptorRelease"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x084E, ImportType::Function, "XamD3DResourceAddRef"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x084F, ImportType::Function, "XamD3DResourceSet"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0850, ImportType::Function, "XamD3DResourceIsBusy"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0851, ImportType::Function, "XamD3DResourceRelease"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x085E, ImportType::Function, "XamNuiEnableChatMic"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x085F, ImportType::Function, "XamNuiIsChatMicEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0860, ImportType::Function, "XamNuiGetDepthCalibration"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0861, ImportType::Function, "XamNuiStoreDepthCalibration"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0862, ImportType::Function, "XamUserNuiIsBiometricEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0863, ImportType::Function, "XamUserNuiEnableBiometric"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0864, ImportType::Function, "XamNuiCameraSetFlags"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0865, ImportType::Function, "XamNuiCameraRememberFloor"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0866, ImportType::Function, "XamUserNuiGetUserIndexForBind"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0867, ImportType::Function, "XamUserNuiGetUserIndexForSignin"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0868, ImportType::Function, "XamUserNuiBind"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0869, ImportType::Function, "XamUserNuiGetUserIndex"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x086A, ImportType::Function, "XamUserNuiGetEnrollmentIndex"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x086B, ImportType::Function, "XamUserNuiUnbind"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x086C, ImportType::Function, "XamNuiIdentityGetQualityFlagsMessage"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x086D, ImportType::Function, "XamNuiCameraTiltSetCallback"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x086E, ImportType::Function, "XamNuiHudIsEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x086F, ImportType::Function, "XamNuiCameraGetTiltControllerType"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0870, ImportType::Function, "XamNuiCameraTiltGetStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0871, ImportType::Function, "XamNuiIdentityGetQualityFlags"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0872, ImportType::Function, "XamNuiIdentityEnrollForSignIn"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0873, ImportType::Function, "XamNuiIdentityGetSessionId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0874, ImportType::Function, "XamNuiIdentityIdentifyWithBiometric"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0875, ImportType::Function, "ControlPackGetHandleManager"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0876, ImportType::Function, "XamEnableNuiAutomation"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0877, ImportType::Function, "XamNuiGetSystemGestureControl"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0878, ImportType::Function, "XamGetPasscodeKeyFromVirtualKey"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0879, ImportType::Function, "XamEnableNatalPlayback"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x087A, ImportType::Function, "XamIsNuiAutomationEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x087B, ImportType::Function, "XamIsNatalPlaybackEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x087C, ImportType::Function, "XamNuiHudInterpretFrame"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x087D, ImportType::Function, "XamNuiHudEnableInputFilter"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x087E, ImportType::Function, "ControlpackNuiCursorSetTrackingId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x087F, ImportType::Function, "XamNuiHudGetInitializeFlags"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0880, ImportType::Function, "XamNuiCameraElevationSetAngle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0881, ImportType::Function, "XamNuiCameraElevationGetAngle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0882, ImportType::Function, "XamNuiCameraElevationAutoTilt"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0883, ImportType::Function, "XamNuiCameraElevationStopMovement"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0884, ImportType::Function, "XamNuiCameraElevationSetCallback"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0885, ImportType::Function, "XamNuiGetDeviceStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0886, ImportType::Function, "XamNuiNatalCameraUpdateStarting"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0887, ImportType::Function, "XamNuiNatalCameraUpdateComplete"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0888, ImportType::Function, "XamNuiHudGetVersions"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0889, ImportType::Function, "XamGetHUDElementByPath"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x088A, ImportType::Function, "XamGetHUDElementByAutoId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x088B, ImportType::Function, "XuiElementGetScreenPositionCenter"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x088C, ImportType::Function, "XamNuiCameraElevationReverseAutoTilt"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x088D, ImportType::Function, "ControlPackSimpleCursorGetRayFromScreenPosition"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x088E, ImportType::Function, "ControlPackSideNavControlGetNuiHandle"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x088F, ImportType::Function, "XamFindHUDElementByXuiId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0890, ImportType::Function, "XamNuiIsDeviceReady"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0891, ImportType::Function, "XamNuiSetForceDeviceOff"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0892, ImportType::Function, "XamNuiPlayerEngagementUpdate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0893, ImportType::Function, "XamNuiSkeletonGetBestSkeletonIndex"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0894, ImportType::Function, "XamNuiSkeletonScoreUpdate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0895, ImportType::Function, "XamNuiCameraTiltReportStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0896, ImportType::Function, "XamNuiCameraAdjustTilt"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0898, ImportType::Function, "D3DDevice_CreateVertexShader"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0899, ImportType::Function, "D3DDevice_CreatePixelShader"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x089A, ImportType::Function, "D3DDevice_CreateTexture"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x089B, ImportType::Function, "D3DDevice_CreateVertexBuffer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x089C, ImportType::Function, "D3DDevice_CreateIndexBuffer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x089D, ImportType::Function, "D3DDevice_CreateVertexDeclaration"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x089E, ImportType::Function, "D3DVertexBuffer_Unlock"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x089F, ImportType::Function, "D3DVertexBuffer_Lock"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08A0, ImportType::Function, "D3DIndexBuffer_Unlock"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08A1, ImportType::Function, "D3DIndexBuffer_Lock"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08A2, ImportType::Function, "D3DTexture_UnlockRect"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08A3, ImportType::Function, "D3DTexture_LockRect"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08A4, ImportType::Function, "D3DDevice_Clear"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08A5, ImportType::Function, "D3DDevice_SetViewport"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08A6, ImportType::Function, "D3DDevice_GetViewport"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08A7, ImportType::Function, "D3DVertexShader_Release"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08A8, ImportType::Function, "D3DPixelShader_Release"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08A9, ImportType::Function, "D3DVertexDeclaration_Release"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08AA, ImportType::Function, "D3DResource_Release"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08AB, ImportType::Function, "D3DDevice_Release"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08AC, ImportType::Function, "D3DDevice_SetVertexShader"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08AD, ImportType::Function, "D3DDevice_SetPixelShader"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08AE, ImportType::Function, "D3DDevice_SetTexture"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08AF, ImportType::Function, "D3DDevice_SetVertexDeclaration"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08B0, ImportType::Function, "D3DDevice_SetIndices"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08B1, ImportType::Function, "D3DDevice_SetStreamSource"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08B2, ImportType::Function, "D3DDevice_DrawVertices"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08B3, ImportType::Function, "D3DDevice_DrawVerticesUP"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08B4, ImportType::Function, "D3DDevice_DrawIndexedVertices"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08B5, ImportType::Function, "D3DDevice_DrawIndexedVerticesUP"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08B6, ImportType::Function, "D3DDevice_SetVertexShaderConstantF_ParameterCheck"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08B7, ImportType::Function, "D3DDevice_SetPixelShaderConstantF_ParameterCheck"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08B8, ImportType::Function, "D3DDevice_SetSamplerState_ParameterCheck"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08B9, ImportType::Function, "D3DDevice_SetRenderState_ParameterCheck"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08BA, ImportType::Function, "D3DDevice_GetRenderState_ParameterCheck"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08BB, ImportType::Function, "D3DDevice_SetVertexShaderConstantFN"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08BC, ImportType::Function, "D3DDevice_SetPixelShaderConstantFN"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08BD, ImportType::Function, "D3DDevice_GetRenderState_ZEnable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08BE, ImportType::Function, "D3DDevice_GetRenderState_CullMode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08BF, ImportType::Function, "D3DDevice_GetRenderState_AlphaBlendEnable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08C0, ImportType::Function, "D3DDevice_GetRenderState_SrcBlendAlpha"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08C1, ImportType::Function, "D3DDevice_GetRenderState_DestBlendAlpha"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08C2, ImportType::Function, "D3DDevice_GetRenderState_BlendOp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08C3, ImportType::Function, "D3DDevice_GetRenderState_ViewportEnable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08C4, ImportType::Function, "D3DDevice_SetRenderState_ZEnable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08C5, ImportType::Function, "D3DDevice_SetRenderState_CullMode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08C6, ImportType::Function, "D3DDevice_SetRenderState_AlphaBlendEnable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08C7, ImportType::Function, "D3DDevice_SetRenderState_SrcBlendAlpha"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08C8, ImportType::Function, "D3DDevice_SetRenderState_DestBlendAlpha"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08C9, ImportType::Function, "D3DDevice_SetRenderState_BlendOp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08CA, ImportType::Function, "D3DDevice_SetRenderState_ViewportEnable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08CB, ImportType::Function, "D3DDevice_SetSamplerState_MagFilter"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08CC, ImportType::Function, "D3DDevice_SetSamplerState_MinFilter"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08CD, ImportType::Function, "D3DDevice_SetSamplerState_AddressU"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08CE, ImportType::Function, "D3DDevice_SetSamplerState_AddressV"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08CF, ImportType::Function, "XGSetTextureHeader"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08D0, ImportType::Function, "XGGetTextureDesc"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08D1, ImportType::Function, "XGOffsetResourceAddress"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08D2, ImportType::Function, "D3DResource_AddRef"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08D3, ImportType::Function, "D3DVertexShader_AddRef"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08D4, ImportType::Function, "D3DPixelShader_AddRef"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08D5, ImportType::Function, "D3DVertexDeclaration_AddRef"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08D6, ImportType::Function, "XGSetTextureHeaderEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08D7, ImportType::Function, "D3DDevice_GetRenderTarget"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08D8, ImportType::Function, "D3DDevice_SetRenderTarget"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08D9, ImportType::Function, "D3DDevice_GetDepthStencilSurface"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08DA, ImportType::Function, "D3DDevice_SetDepthStencilSurface"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08DB, ImportType::Function, "D3DDevice_Resolve"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08DC, ImportType::Function, "D3DDevice_SetPixelShaderConstantB"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08DD, ImportType::Function, "XamNuiGetDeviceSerialNumber"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08FC, ImportType::Function, "XamXtwManagerGetImportType::VariableCount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08FD, ImportType::Function, "XamXtwManagerGetId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08FE, ImportType::Function, "XamXtwManagerGetValue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x08FF, ImportType::Function, "XamXtwManagerSetValue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0900, ImportType::Function, "XamXtwManagerIncrement"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0901, ImportType::Function, "XamXtwManagerDecrement"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0902, ImportType::Function, "XamXtwManagerResetValue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0903, ImportType::Function, "XamXtwManagerResetAll"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0904, ImportType::Function, "XamXtwManagerGetDataFilePath"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0905, ImportType::Function, "XamXtwManagerDeleteDataFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0906, ImportType::Function, "XamXtwManagerSave"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0907, ImportType::Function, "XamXtwManagerLoad"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0908, ImportType::Function, "XamGetXTweakManager"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09C4, ImportType::Function, "XamBackgroundDownloadSetMode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09C5, ImportType::Function, "XamBackgroundDownloadIsEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09C6, ImportType::Function, "XamBackgroundDownloadGetActiveItem"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09C7, ImportType::Function, "XamBackgroundDownloadGetItems"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09C8, ImportType::Function, "XamBackgroundDownloadClearItems"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09C9, ImportType::Function, "XamBackgroundDownloadItemAdd"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09CA, ImportType::Function, "XamBackgroundDownloadItemRemove"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09CB, ImportType::Function, "XamBackgroundDownloadItemMakeFirst"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09CC, ImportType::Function, "XamBackgroundDownloadSetForegroundPriority"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09CD, ImportType::Function, "XamBackgroundDownloadGetForegroundPriority"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09CE, ImportType::Function, "XamBackgroundDownloadItemToContentData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09CF, ImportType::Function, "XamBackgroundDownloadItemGetStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09D0, ImportType::Function, "XamBackgroundDownloadHistoryGetItem"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09D1, ImportType::Function, "XamBackgroundDownloadItemGetHistoryStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09D2, ImportType::Function, "XamBackgroundDownloadItemSetHistoryStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09D3, ImportType::Function, "XamBackgroundDownloadItemGetStatusAsync"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09D4, ImportType::Function, "XamBackgroundDownloadItemGetStatusEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09D5, ImportType::Function, "XamBackgroundDownloadItemGetHistoryStatusEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09D6, ImportType::Function, "XamBackgroundDownloadBindItems"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09D7, ImportType::Function, "XamBackgroundDownloadSetPollingActive"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09D8, ImportType::Function, "XamBackgroundDownloadGetPollingActive"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09D9, ImportType::Function, "XamBackgroundDownloadGetMode"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09DA, ImportType::Function, "XamBackgroundDownloadGetUnexpectedChangeCount"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09DB, ImportType::Function, "XamBackgroundDownloadIsItemForThisConsole"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09DC, ImportType::Function, "XamBackgroundDownloadSelectDevice"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09DD, ImportType::Function, "XamBackgroundDownloadItemModify"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09DE, ImportType::Function, "XamBackgroundDownloadCacheLegacyMappingInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09DF, ImportType::Function, "XamBackgroundDownloadGetLegacyMappingInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09E0, ImportType::Function, "XamBackgroundDownloadGetLegacyId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x09E1, ImportType::Function, "XamBackgroundDownloadDoFail"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A28, ImportType::Function, "XamSwapDisc"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A29, ImportType::Variable, "XamSwapDiscPatchAddress"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A2A, ImportType::Function, "XamSwapCancel"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A32, ImportType::Function, "XamRamDriveCreate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A33, ImportType::Function, "XamRamDriveDestroy"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5A, ImportType::Function, "XamPlayTimerGetData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5B, ImportType::Function, "XamPlayTimerSetData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5C, ImportType::Function, "XamPlayTimerResume"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5D, ImportType::Function, "XamPlayTimerSuspend"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5E, ImportType::Function, "XamPlayTimerIsRunning"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5F, ImportType::Function, "XamPlayTimerIsEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A60, ImportType::Function, "XamPlayTimerGetNextResetDate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A61, ImportType::Function, "XamPlayTimerFormatDurationString"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A62, ImportType::Function, "XamPlayTimerGetTimeRemaining"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A63, ImportType::Function, "XamPlayTimerUpdateTimeRemaining"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A64, ImportType::Function, "XamPlayTimerForceNotification"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A65, ImportType::Function, "XamPlayTimerRefreshResetDate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A6E, ImportType::Function, "UpnpAVServerSearchInitialize"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A6F, ImportType::Function, "UpnpAVServerSearchDestroy"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A70, ImportType::Function, "UpnpAVServerSearchStart"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A71, ImportType::Function, "Destroy"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A72, ImportType::Function, "UpnpAVServerSearchDoWork"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A73, ImportType::Function, "UpnpAVServerSearchGetNextServer"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A8C, ImportType::Function, "XCustomBroadcastGamercardEvent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0A8D, ImportType::Function, "XamCustomGetCurrentActions"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AA0, ImportType::Function, "XamInstrumentationLogEvent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AA1, ImportType::Function, "XamRegisterSMCNotification"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AAA, ImportType::Function, "XamInstrumentationLogEventEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AAB, ImportType::Function, "XamInstrumentationGetSourceConfig"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AAC, ImportType::Function, "XamInstrumentationDebugConfig"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0ADC, ImportType::Function, "CurlCreateCacheEntry"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0ADD, ImportType::Function, "CurlOpenCacheEntry"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0ADE, ImportType::Function, "CurlSetCacheEntryExpireTime"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0ADF, ImportType::Function, "CurlReadCacheEntryHeaders"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE0, ImportType::Function, "CurlReadCacheEntryContent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE1, ImportType::Function, "CurlWriteCacheEntryContent"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE2, ImportType::Function, "CurlCloseCacheEntry"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE3, ImportType::Function, "CurlEnumerateCacheEntry"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE5, ImportType::Function, "CurlWipeBackingFiles"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE7, ImportType::Function, "CurlOpenTitleBackingFile"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF0, ImportType::Function, "XamSetSecurityViolationDetected"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF1, ImportType::Function, "XamIsSecurityViolationDetected"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF2, ImportType::Function, "XamIsAnySecurityViolationDetected"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF3, ImportType::Function, "XamGetSecurityViolationsDetected"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF4, ImportType::Function, "XamActivateCounterMeasure"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF5, ImportType::Function, "XamDeactivateCounterMeasure"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF6, ImportType::Function, "XamIsCounterMeasureActivated"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF7, ImportType::Function, "XamGetActiveCounterMeasures"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AFC, ImportType::Function, "XamPartyCreate"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AFD, ImportType::Function, "XamPartyLeave"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AFE, ImportType::Function, "XamPartySendInviteDeprecated"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0AFF, ImportType::Function, "XamPartyGetUserList"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B00, ImportType::Function, "XamPartySendGameInvites"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B01, ImportType::Function, "XamPartyJoin"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B02, ImportType::Function, "XamPartyKickUser"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B03, ImportType::Function, "XamPartyAddLocalUsers"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B04, ImportType::Function, "XamConvertEmoticons"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B05, ImportType::Function, "XamGetLocaleTimeFormat"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B06, ImportType::Function, "XamPartyRemoveLocalUsers"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B07, ImportType::Function, "XamPartyGetUserListInternal"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B08, ImportType::Function, "XamPartySetJoinable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B09, ImportType::Function, "XamPartyGetJoinable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0A, ImportType::Function, "XamPartyGetInfo"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0B, ImportType::Function, "XamPartySetCustomData"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0C, ImportType::Function, "XamPartySetConnectivityGraph"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0D, ImportType::Function, "XamPartyGetRoutingTable"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0E, ImportType::Function, "XamPartyAutomationInprocCall"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0F, ImportType::Function, "XamPartyGetState"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B10, ImportType::Function, "XamPartyGetBandwidth"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B11, ImportType::Function, "XamPartyGetNetworkCounters"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B12, ImportType::Function, "XamShowQuickLaunchUI"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B13, ImportType::Function, "XamPartyIsCoordinator"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B14, ImportType::Function, "XamPartyGetFormation"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B15, ImportType::Function, "XamPartySendInvite"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B16, ImportType::Function, "XamPartySetTestDelay"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B17, ImportType::Function, "XamPartyOverrideNatType"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B18, ImportType::Function, "XamPartyGetAccessLevel"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B19, ImportType::Function, "XamPartySetTestFlags"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B1A, ImportType::Function, "XamIsSystemExperienceTitleId"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B22, ImportType::Function, "XamTaskSetCancelSubTasks"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B23, ImportType::Function, "XamTaskGetCompletionStatus"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B24, ImportType::Function, "XamTaskCancelWaitAndCloseWaitTask"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B2C, ImportType::Function, "XamWebInstrumentationCreateReport"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B2D, ImportType::Function, "XamWebInstrumentationSetUserVar"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B2E, ImportType::Function, "XamWebInstrumentationSetUserVarNoEscape"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B2F, ImportType::Function, "XamWebInstrumentationGetURL"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B30, ImportType::Function, "XamWebInstrumentationSendReport"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B31, ImportType::Function, "XamWebInstrumentationDestroyReport"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B32, ImportType::Function, "XamWebInstrumentationCreateSampledReport"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B33, ImportType::Function, "XampSetSamplingRandomValue"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B34, ImportType::Function, "XampWebInstrumentationSetProfileCounts"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B35, ImportType::Function, "XamWebInstrumentationGetURLEx"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B36, ImportType::Function, "XampSetOmnitureCallbackImportType::Function"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B37, ImportType::Function, "XamShowQuickChatUIp"),
+    LOAD_IMPORT(XboxLibrary::Xam, 0x0B4A, ImportType::Function, "XamVerifyXSignerSignature"),
 
-static inline Import* findImport_FromLib(std::string libName, uint32_t ordinal)
+
+    //
+    // XboxKrnl
+    //
+
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0001, ImportType::Function, "DbgBreakPoint"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0002, ImportType::Function, "DbgBreakPointWithStatus"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0003, ImportType::Function, "DbgPrint"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0004, ImportType::Function, "DbgPrompt"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0005, ImportType::Function, "DumpGetRawDumpInfo"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0006, ImportType::Function, "DumpWriteDump"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0007, ImportType::Function, "ExAcquireReadWriteLockExclusive"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0008, ImportType::Function, "ExAcquireReadWriteLockShared"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0009, ImportType::Function, "ExAllocatePool"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000A, ImportType::Function, "ExAllocatePoolWithTag"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000B, ImportType::Function, "ExAllocatePoolTypeWithTag"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000C, ImportType::Variable, "ExConsoleGameRegion"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000D, ImportType::Function, "ExCreateThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000E, ImportType::Function, "ExEventObjectType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000F, ImportType::Function, "ExFreePool"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0010, ImportType::Function, "ExGetXConfigSetting"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0011, ImportType::Function, "ExInitializeReadWriteLock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0012, ImportType::Function, "ExMutantObjectType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0013, ImportType::Function, "ExQueryPoolBlockSize"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0014, ImportType::Function, "ExRegisterThreadNotification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0015, ImportType::Function, "ExRegisterTitleTerminateNotification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0016, ImportType::Function, "ExReleaseReadWriteLock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0017, ImportType::Function, "ExSemaphoreObjectType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0018, ImportType::Function, "ExSetXConfigSetting"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0019, ImportType::Function, "ExTerminateThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001A, ImportType::Function, "ExTerminateTitleProcess"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001B, ImportType::Function, "ExThreadObjectType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001C, ImportType::Function, "ExTimerObjectType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001D, ImportType::Function, "MmDoubleMapMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001E, ImportType::Function, "MmUnmapMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001F, ImportType::Function, "XeKeysGetConsoleCertificate"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0020, ImportType::Function, "FscGetCacheElementCount"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0021, ImportType::Function, "FscSetCacheElementCount"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0022, ImportType::Function, "HalGetCurrentAVPack"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0023, ImportType::Function, "HalGpioControl"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0024, ImportType::Function, "HalOpenCloseODDTray"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0025, ImportType::Function, "HalReadWritePCISpace"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0026, ImportType::Function, "HalRegisterPowerDownNotification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0027, ImportType::Function, "HalRegisterSMCNotification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0028, ImportType::Function, "HalReturnToFirmware"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0029, ImportType::Function, "HalSendSMCMessage"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002A, ImportType::Function, "HalSetAudioEnable"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002B, ImportType::Function, "InterlockedFlushSList"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002C, ImportType::Function, "InterlockedPopEntrySList"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002D, ImportType::Function, "InterlockedPushEntrySList"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002E, ImportType::Function, "IoAcquireDeviceObjectLock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002F, ImportType::Function, "IoAllocateIrp"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0030, ImportType::Function, "IoBuildAsynchronousFsdRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0031, ImportType::Function, "IoBuildDeviceIoControlRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0032, ImportType::Function, "IoBuildSynchronousFsdRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0033, ImportType::Function, "IoCallDriver"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0034, ImportType::Function, "IoCheckShareAccess"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0035, ImportType::Function, "IoCompleteRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0036, ImportType::Function, "IoCompletionObjectType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0037, ImportType::Function, "IoCreateDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0038, ImportType::Function, "IoCreateFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0039, ImportType::Function, "IoDeleteDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003A, ImportType::Function, "IoDeviceObjectType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003B, ImportType::Function, "IoDismountVolume"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003C, ImportType::Function, "IoDismountVolumeByFileHandle"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003D, ImportType::Function, "IoDismountVolumeByName"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003E, ImportType::Function, "IoFileObjectType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003F, ImportType::Function, "IoFreeIrp"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0040, ImportType::Function, "IoInitializeIrp"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0041, ImportType::Function, "IoInvalidDeviceRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0042, ImportType::Function, "ExSetBetaFeaturesEnabled"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0043, ImportType::Function, "IoQueueThreadIrp"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0044, ImportType::Function, "IoReleaseDeviceObjectLock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0045, ImportType::Function, "IoRemoveShareAccess"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0046, ImportType::Function, "IoSetIoCompletion"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0047, ImportType::Function, "IoSetShareAccess"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0048, ImportType::Function, "IoStartNextPacket"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0049, ImportType::Function, "IoStartNextPacketByKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004A, ImportType::Function, "IoStartPacket"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004B, ImportType::Function, "IoSynchronousDeviceIoControlRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004C, ImportType::Function, "IoSynchronousFsdRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004D, ImportType::Function, "KeAcquireSpinLockAtRaisedIrql"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004E, ImportType::Function, "KeAlertResumeThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004F, ImportType::Function, "KeAlertThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0050, ImportType::Function, "KeBlowFuses"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0051, ImportType::Function, "KeBoostPriorityThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0052, ImportType::Function, "KeBugCheck"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0053, ImportType::Function, "KeBugCheckEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0054, ImportType::Function, "KeCancelTimer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0055, ImportType::Function, "KeConnectInterrupt"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0056, ImportType::Function, "KeContextFromKframes"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0057, ImportType::Function, "KeContextToKframes"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0058, ImportType::Function, "KeCreateUserMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0059, ImportType::Variable, "KeDebugMonitorData"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005A, ImportType::Function, "KeDelayExecutionThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005B, ImportType::Function, "KeDeleteUserMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005C, ImportType::Function, "KeDisconnectInterrupt"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005D, ImportType::Function, "KeEnableFpuExceptions"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005E, ImportType::Function, "KeEnablePPUPerformanceMonitor"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005F, ImportType::Function, "KeEnterCriticalRegion"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0060, ImportType::Function, "KeEnterUserMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0061, ImportType::Function, "KeFlushCacheRange"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0062, ImportType::Function, "KeFlushCurrentEntireTb"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0063, ImportType::Function, "KeFlushEntireTb"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0064, ImportType::Function, "KeFlushUserModeCurrentTb"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0065, ImportType::Function, "KeFlushUserModeTb"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0066, ImportType::Function, "KeGetCurrentProcessType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0067, ImportType::Function, "KeGetPMWRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0068, ImportType::Function, "KeGetPRVRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0069, ImportType::Function, "KeGetSocRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006A, ImportType::Function, "KeGetSpecialPurposeRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006B, ImportType::Function, "KeLockL2"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006C, ImportType::Function, "KeUnlockL2"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006D, ImportType::Function, "KeInitializeApc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006E, ImportType::Function, "KeInitializeDeviceQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006F, ImportType::Function, "KeInitializeDpc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0070, ImportType::Function, "KeInitializeEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0071, ImportType::Function, "KeInitializeInterrupt"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0072, ImportType::Function, "KeInitializeMutant"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0073, ImportType::Function, "KeInitializeQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0074, ImportType::Function, "KeInitializeSemaphore"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0075, ImportType::Function, "KeInitializeTimerEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0076, ImportType::Function, "KeInsertByKeyDeviceQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0077, ImportType::Function, "KeInsertDeviceQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0078, ImportType::Function, "KeInsertHeadQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0079, ImportType::Function, "KeInsertQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007A, ImportType::Function, "KeInsertQueueApc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007B, ImportType::Function, "KeInsertQueueDpc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007C, ImportType::Function, "KeIpiGenericCall"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007D, ImportType::Function, "KeLeaveCriticalRegion"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007E, ImportType::Function, "KeLeaveUserMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007F, ImportType::Function, "KePulseEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0080, ImportType::Function, "KeQueryBackgroundProcessors"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0081, ImportType::Function, "KeQueryBasePriorityThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0082, ImportType::Function, "KeQueryInterruptTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0083, ImportType::Function, "KeQueryPerformanceFrequency"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0084, ImportType::Function, "KeQuerySystemTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0085, ImportType::Function, "KeRaiseIrqlToDpcLevel"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0086, ImportType::Function, "KeRegisterDriverNotification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0087, ImportType::Function, "KeReleaseMutant"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0088, ImportType::Function, "KeReleaseSemaphore"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0089, ImportType::Function, "KeReleaseSpinLockFromRaisedIrql"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008A, ImportType::Function, "KeRemoveByKeyDeviceQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008B, ImportType::Function, "KeRemoveDeviceQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008C, ImportType::Function, "KeRemoveEntryDeviceQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008D, ImportType::Function, "KeRemoveQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008E, ImportType::Function, "KeRemoveQueueDpc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008F, ImportType::Function, "KeResetEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0090, ImportType::Function, "KeRestoreFloatingPointState"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0091, ImportType::Function, "KeRestoreVectorUnitState"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0092, ImportType::Function, "KeResumeThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0093, ImportType::Function, "KeRetireDpcList"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0094, ImportType::Function, "KeRundownQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0095, ImportType::Function, "KeSaveFloatingPointState"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0096, ImportType::Function, "KeSaveVectorUnitState"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0097, ImportType::Function, "KeSetAffinityThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0098, ImportType::Function, "KeSetBackgroundProcessors"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0099, ImportType::Function, "KeSetBasePriorityThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009A, ImportType::Function, "KeSetCurrentProcessType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009B, ImportType::Function, "KeSetCurrentStackPointers"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009C, ImportType::Function, "KeSetDisableBoostThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009D, ImportType::Function, "KeSetEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009E, ImportType::Function, "KeSetEventBoostPriority"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009F, ImportType::Function, "KeSetPMWRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A0, ImportType::Function, "KeSetPowerMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A1, ImportType::Function, "KeSetPRVRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A2, ImportType::Function, "KeSetPriorityClassThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A3, ImportType::Function, "KeSetPriorityThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A4, ImportType::Function, "KeSetSocRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A5, ImportType::Function, "KeSetSpecialPurposeRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A6, ImportType::Function, "KeSetTimer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A7, ImportType::Function, "KeSetTimerEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A8, ImportType::Function, "KeStallExecutionProcessor"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A9, ImportType::Function, "KeSuspendThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AA, ImportType::Function, "KeSweepDcacheRange"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AB, ImportType::Function, "KeSweepIcacheRange"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AC, ImportType::Function, "KeTestAlertThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AD, ImportType::Variable, "KeTimeStampBundle"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AE, ImportType::Function, "KeTryToAcquireSpinLockAtRaisedIrql"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AF, ImportType::Function, "KeWaitForMultipleObjects"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B0, ImportType::Function, "KeWaitForSingleObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B1, ImportType::Function, "KfAcquireSpinLock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B2, ImportType::Function, "KfRaiseIrql"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B3, ImportType::Function, "KfLowerIrql"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B4, ImportType::Function, "KfReleaseSpinLock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B5, ImportType::Variable, "KiBugCheckData"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B6, ImportType::Function, "LDICreateDecompression"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B7, ImportType::Function, "LDIDecompress"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B8, ImportType::Function, "LDIDestroyDecompression"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B9, ImportType::Function, "MmAllocatePhysicalMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BA, ImportType::Function, "MmAllocatePhysicalMemoryEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BB, ImportType::Function, "MmCreateKernelStack"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BC, ImportType::Function, "MmDeleteKernelStack"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BD, ImportType::Function, "MmFreePhysicalMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BE, ImportType::Function, "MmGetPhysicalAddress"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BF, ImportType::Function, "MmIsAddressValid"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C0, ImportType::Function, "MmLockAndMapSegmentArray"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C1, ImportType::Function, "MmLockUnlockBufferPages"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C2, ImportType::Function, "MmMapIoSpace"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C3, ImportType::Function, "MmPersistPhysicalMemoryAllocation"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C4, ImportType::Function, "MmQueryAddressProtect"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C5, ImportType::Function, "MmQueryAllocationSize"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C6, ImportType::Function, "MmQueryStatistics"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C7, ImportType::Function, "MmSetAddressProtect"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C8, ImportType::Function, "MmSplitPhysicalMemoryAllocation"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C9, ImportType::Function, "MmUnlockAndUnmapSegmentArray"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CA, ImportType::Function, "MmUnmapIoSpace"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CB, ImportType::Variable, "Nls844UnicodeCaseTable"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CC, ImportType::Function, "NtAllocateVirtualMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CD, ImportType::Function, "NtCancelTimer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CE, ImportType::Function, "NtClearEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CF, ImportType::Function, "NtClose"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D0, ImportType::Function, "NtCreateDirectoryObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D1, ImportType::Function, "NtCreateEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D2, ImportType::Function, "NtCreateFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D3, ImportType::Function, "NtCreateIoCompletion"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D4, ImportType::Function, "NtCreateMutant"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D5, ImportType::Function, "NtCreateSemaphore"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D6, ImportType::Function, "NtCreateSymbolicLinkObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D7, ImportType::Function, "NtCreateTimer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D8, ImportType::Function, "NtDeleteFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D9, ImportType::Function, "NtDeviceIoControlFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DA, ImportType::Function, "NtDuplicateObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DB, ImportType::Function, "NtFlushBuffersFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DC, ImportType::Function, "NtFreeVirtualMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DD, ImportType::Function, "NtMakeTemporaryObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DE, ImportType::Function, "NtOpenDirectoryObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DF, ImportType::Function, "NtOpenFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E0, ImportType::Function, "NtOpenSymbolicLinkObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E1, ImportType::Function, "NtProtectVirtualMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E2, ImportType::Function, "NtPulseEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E3, ImportType::Function, "NtQueueApcThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E4, ImportType::Function, "NtQueryDirectoryFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E5, ImportType::Function, "NtQueryDirectoryObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E6, ImportType::Function, "NtQueryEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E7, ImportType::Function, "NtQueryFullAttributesFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E8, ImportType::Function, "NtQueryInformationFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E9, ImportType::Function, "NtQueryIoCompletion"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00EA, ImportType::Function, "NtQueryMutant"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00EB, ImportType::Function, "NtQuerySemaphore"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00EC, ImportType::Function, "NtQuerySymbolicLinkObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00ED, ImportType::Function, "NtQueryTimer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00EE, ImportType::Function, "NtQueryVirtualMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00EF, ImportType::Function, "NtQueryVolumeInformationFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F0, ImportType::Function, "NtReadFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F1, ImportType::Function, "NtReadFileScatter"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F2, ImportType::Function, "NtReleaseMutant"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F3, ImportType::Function, "NtReleaseSemaphore"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F4, ImportType::Function, "NtRemoveIoCompletion"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F5, ImportType::Function, "NtResumeThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F6, ImportType::Function, "NtSetEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F7, ImportType::Function, "NtSetInformationFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F8, ImportType::Function, "NtSetIoCompletion"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F9, ImportType::Function, "NtSetSystemTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FA, ImportType::Function, "NtSetTimerEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FB, ImportType::Function, "NtSignalAndWaitForSingleObjectEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FC, ImportType::Function, "NtSuspendThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FD, ImportType::Function, "NtWaitForSingleObjectEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FE, ImportType::Function, "NtWaitForMultipleObjectsEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FF, ImportType::Function, "NtWriteFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0100, ImportType::Function, "NtWriteFileGather"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0101, ImportType::Function, "NtYieldExecution"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0102, ImportType::Function, "ObCreateObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0103, ImportType::Function, "ObCreateSymbolicLink"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0104, ImportType::Function, "ObDeleteSymbolicLink"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0105, ImportType::Function, "ObDereferenceObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0106, ImportType::Function, "ObDirectoryObjectType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0107, ImportType::Function, "ObGetWaitableObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0108, ImportType::Function, "ObInsertObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0109, ImportType::Function, "ObIsTitleObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010A, ImportType::Function, "ObLookupAnyThreadByThreadId"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010B, ImportType::Function, "ObLookupThreadByThreadId"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010C, ImportType::Function, "ObMakeTemporaryObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010D, ImportType::Function, "ObOpenObjectByName"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010E, ImportType::Function, "ObOpenObjectByPointer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010F, ImportType::Function, "ObReferenceObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0110, ImportType::Function, "ObReferenceObjectByHandle"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0111, ImportType::Function, "ObReferenceObjectByName"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0112, ImportType::Function, "ObSymbolicLinkObjectType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0113, ImportType::Function, "ObTranslateSymbolicLink"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0114, ImportType::Function, "RtlAnsiStringToUnicodeString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0115, ImportType::Function, "RtlAppendStringToString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0116, ImportType::Function, "RtlAppendUnicodeStringToString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0117, ImportType::Function, "RtlAppendUnicodeToString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0118, ImportType::Function, "RtlAssert"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0119, ImportType::Function, "RtlCaptureContext"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011A, ImportType::Function, "RtlCompareMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011B, ImportType::Function, "RtlCompareMemoryUlong"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011C, ImportType::Function, "RtlCompareString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011D, ImportType::Function, "RtlCompareStringN"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011E, ImportType::Function, "RtlCompareUnicodeString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011F, ImportType::Function, "RtlCompareUnicodeStringN"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0120, ImportType::Function, "RtlCompareUtf8ToUnicode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0121, ImportType::Function, "RtlCopyString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0122, ImportType::Function, "RtlCopyUnicodeString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0123, ImportType::Function, "RtlCreateUnicodeString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0124, ImportType::Function, "RtlDowncaseUnicodeChar"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0125, ImportType::Function, "RtlEnterCriticalSection"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0126, ImportType::Function, "RtlFillMemoryUlong"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0127, ImportType::Function, "RtlFreeAnsiString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0128, ImportType::Function, "RtlFreeAnsiString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0129, ImportType::Function, "RtlGetCallersAddress"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012A, ImportType::Function, "RtlGetStackLimits"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012B, ImportType::Function, "RtlImageXexHeaderField"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012C, ImportType::Function, "RtlInitAnsiString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012D, ImportType::Function, "RtlInitUnicodeString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012E, ImportType::Function, "RtlInitializeCriticalSection"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012F, ImportType::Function, "RtlInitializeCriticalSectionAndSpinCount"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0130, ImportType::Function, "RtlLeaveCriticalSection"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0131, ImportType::Function, "RtlLookupImportType::FunctionEntry"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0132, ImportType::Function, "RtlLowerChar"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0133, ImportType::Function, "RtlMultiByteToUnicodeN"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0134, ImportType::Function, "RtlMultiByteToUnicodeSize"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0135, ImportType::Function, "RtlNtStatusToDosError"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0136, ImportType::Function, "RtlRaiseException"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0137, ImportType::Function, "RtlRaiseStatus"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0138, ImportType::Function, "RtlRip"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0139, ImportType::Function, "_scprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013A, ImportType::Function, "_snprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013B, ImportType::Function, "sprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013C, ImportType::Function, "_scwprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013D, ImportType::Function, "_snwprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013E, ImportType::Function, "_swprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013F, ImportType::Function, "RtlTimeFieldsToTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0140, ImportType::Function, "RtlTimeToTimeFields"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0141, ImportType::Function, "RtlTryEnterCriticalSection"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0142, ImportType::Function, "RtlUnicodeStringToAnsiString"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0143, ImportType::Function, "RtlUnicodeToMultiByteN"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0144, ImportType::Function, "RtlUnicodeToMultiByteSize"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0145, ImportType::Function, "RtlUnicodeToUtf8"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0146, ImportType::Function, "RtlUnicodeToUtf8Size"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0147, ImportType::Function, "RtlUnwind"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0148, ImportType::Function, "RtlUnwind2"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0149, ImportType::Function, "RtlUpcaseUnicodeChar"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014A, ImportType::Function, "RtlUpperChar"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014B, ImportType::Function, "RtlVirtualUnwind"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014C, ImportType::Function, "_vscprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014D, ImportType::Function, "_vsnprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014E, ImportType::Function, "vsprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014F, ImportType::Function, "_vscwprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0150, ImportType::Function, "_vsnwprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0151, ImportType::Function, "_vswprintf"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0152, ImportType::Function, "KeTlsAlloc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0153, ImportType::Function, "KeTlsFree"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0154, ImportType::Function, "KeTlsGetValue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0155, ImportType::Function, "KeTlsSetValue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0156, ImportType::Variable, "XboxHardwareInfo"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0157, ImportType::Variable, "XboxKrnlBaseVersion"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0158, ImportType::Variable, "XboxKrnlVersion"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0159, ImportType::Function, "XeCryptAesKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015A, ImportType::Function, "XeCryptAesEcb"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015B, ImportType::Function, "XeCryptAesCbc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015C, ImportType::Function, "XeCryptBnDwLeDhEqualBase"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015D, ImportType::Function, "XeCryptBnDwLeDhInvalBase"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015E, ImportType::Function, "XeCryptBnDwLeDhModExp"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015F, ImportType::Function, "XeCryptBnDw_Copy"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0160, ImportType::Function, "XeCryptBnDw_SwapLeBe"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0161, ImportType::Function, "XeCryptBnDw_Zero"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0162, ImportType::Function, "XeCryptBnDwLePkcs1Format"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0163, ImportType::Function, "XeCryptBnDwLePkcs1Verify"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0164, ImportType::Function, "XeCryptBnQwBeSigCreate"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0165, ImportType::Function, "XeCryptBnQwBeSigFormat"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0166, ImportType::Function, "XeCryptBnQwBeSigVerify"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0167, ImportType::Function, "XeCryptBnQwNeModExp"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0168, ImportType::Function, "XeCryptBnQwNeModExpRoot"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0169, ImportType::Function, "XeCryptBnQwNeModInv"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016A, ImportType::Function, "XeCryptBnQwNeModMul"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016B, ImportType::Function, "XeCryptBnQwNeRsaKeyGen"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016C, ImportType::Function, "XeCryptBnQwNeRsaPrvCrypt"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016D, ImportType::Function, "XeCryptBnQwNeRsaPubCrypt"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016E, ImportType::Function, "XeCryptBnQw_Copy"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016F, ImportType::Function, "XeCryptBnQw_SwapDwQw"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0170, ImportType::Function, "XeCryptBnQw_SwapDwQwLeBe"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0171, ImportType::Function, "XeCryptBnQw_SwapLeBe"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0172, ImportType::Function, "XeCryptBnQw_Zero"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0173, ImportType::Function, "XeCryptChainAndSumMac"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0174, ImportType::Function, "XeCryptDesParity"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0175, ImportType::Function, "XeCryptDesKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0176, ImportType::Function, "XeCryptDesEcb"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0177, ImportType::Function, "XeCryptDesCbc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0178, ImportType::Function, "XeCryptDes3Key"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0179, ImportType::Function, "XeCryptDes3Ecb"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017A, ImportType::Function, "XeCryptDes3Cbc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017B, ImportType::Function, "XeCryptHmacMd5Init"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017C, ImportType::Function, "XeCryptHmacMd5Update"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017D, ImportType::Function, "XeCryptHmacMd5Final"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017E, ImportType::Function, "XeCryptHmacMd5"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017F, ImportType::Function, "XeCryptHmacShaInit"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0180, ImportType::Function, "XeCryptHmacShaUpdate"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0181, ImportType::Function, "XeCryptHmacShaFinal"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0182, ImportType::Function, "XeCryptHmacSha"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0183, ImportType::Function, "XeCryptHmacShaVerify"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0184, ImportType::Function, "XeCryptMd5Init"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0185, ImportType::Function, "XeCryptMd5Update"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0186, ImportType::Function, "XeCryptMd5Final"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0187, ImportType::Function, "XeCryptMd5"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0188, ImportType::Function, "XeCryptParveEcb"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0189, ImportType::Function, "XeCryptParveCbcMac"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018A, ImportType::Function, "XeCryptRandom"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018B, ImportType::Function, "XeCryptRc4Key"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018C, ImportType::Function, "XeCryptRc4Ecb"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018D, ImportType::Function, "XeCryptRc4"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018E, ImportType::Function, "XeCryptRotSumSha"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018F, ImportType::Function, "XeCryptShaInit"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0190, ImportType::Function, "XeCryptShaUpdate"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0191, ImportType::Function, "XeCryptShaFinal"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0192, ImportType::Function, "XeCryptSha"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0193, ImportType::Variable, "XexExecutableModuleHandle"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0194, ImportType::Function, "XexCheckExecutablePrivilege"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0195, ImportType::Function, "XexGetModuleHandle"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0196, ImportType::Function, "XexGetModuleSection"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0197, ImportType::Function, "XexGetProcedureAddress"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0198, ImportType::Function, "XexLoadExecutable"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0199, ImportType::Function, "XexLoadImage"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019A, ImportType::Function, "XexLoadImageFromMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019B, ImportType::Function, "XexLoadImageHeaders"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019C, ImportType::Function, "XexPcToFileHeader"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019D, ImportType::Function, "KiApcNormalRoutineNop"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019E, ImportType::Function, "XexRegisterPatchDescriptor"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019F, ImportType::Function, "XexSendDeferredNotifications"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A0, ImportType::Function, "XexStartExecutable"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A1, ImportType::Function, "XexUnloadImage"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A2, ImportType::Function, "XexUnloadImageAndExitThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A3, ImportType::Function, "XexUnloadTitleModules"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A4, ImportType::Function, "XexVerifyImageHeaders"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A5, ImportType::Function, "__C_specific_handler"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A6, ImportType::Function, "DbgLoadImageSymbols"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A7, ImportType::Function, "DbgUnLoadImageSymbols"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A8, ImportType::Function, "RtlImageDirectoryEntryToData"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A9, ImportType::Function, "RtlImageNtHeader"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AA, ImportType::Function, "ExDebugMonitorService"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AB, ImportType::Function, "MmDbgReadCheck"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AC, ImportType::Function, "MmDbgReleaseAddress"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AD, ImportType::Function, "MmDbgWriteCheck"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AE, ImportType::Variable, "ExLoadedCommandLine"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AF, ImportType::Variable, "ExLoadedImageName"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B0, ImportType::Function, "VdBlockUntilGUIIdle"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B1, ImportType::Function, "VdCallGraphicsNotificationRoutines"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B2, ImportType::Function, "VdDisplayFatalError"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B3, ImportType::Function, "VdEnableClosedCaption"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B4, ImportType::Function, "VdEnableDisableClockGating"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B5, ImportType::Function, "VdEnableDisablePowerSavingMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B6, ImportType::Function, "VdEnableRingBufferRPtrWriteBack"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B7, ImportType::Function, "VdGenerateGPUCSCCoefficients"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B8, ImportType::Function, "VdGetClosedCaptionReadyStatus"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B9, ImportType::Function, "VdGetCurrentDisplayGamma"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BA, ImportType::Function, "VdGetCurrentDisplayInformation"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BB, ImportType::Function, "VdGetDisplayModeOverride"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BC, ImportType::Function, "VdGetGraphicsAsicID"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BD, ImportType::Function, "VdGetSystemCommandBuffer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BE, ImportType::Variable, "VdGlobalDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BF, ImportType::Variable, "VdGlobalXamDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C0, ImportType::Variable, "VdGpuClockInMHz"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C1, ImportType::Variable, "VdHSIOCalibrationLock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C2, ImportType::Function, "VdInitializeEngines"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C3, ImportType::Function, "VdInitializeRingBuffer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C4, ImportType::Function, "VdInitializeScaler"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C5, ImportType::Function, "VdInitializeScalerCommandBuffer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C6, ImportType::Function, "VdIsHSIOTrainingSucceeded"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C7, ImportType::Function, "VdPersistDisplay"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C8, ImportType::Function, "VdQuerySystemCommandBuffer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C9, ImportType::Function, "VdQueryVideoFlags"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CA, ImportType::Function, "VdQueryVideoMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CB, ImportType::Function, "VdReadDVERegisterUlong"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CC, ImportType::Function, "VdReadWriteHSIOCalibrationFlag"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CD, ImportType::Function, "VdRegisterGraphicsNotification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CE, ImportType::Function, "VdRegisterXamGraphicsNotification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CF, ImportType::Function, "VdSendClosedCaptionData"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D0, ImportType::Function, "VdSetCGMSOption"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D1, ImportType::Function, "VdSetColorProfileAdjustment"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D2, ImportType::Function, "VdSetCscMatricesOverride"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D3, ImportType::Function, "VdSetDisplayMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D4, ImportType::Function, "VdSetDisplayModeOverride"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D5, ImportType::Function, "VdSetGraphicsInterruptCallback"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D6, ImportType::Function, "VdSetHDCPOption"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D7, ImportType::Function, "VdSetMacrovisionOption"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D8, ImportType::Function, "VdSetSystemCommandBuffer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D9, ImportType::Function, "VdSetSystemCommandBufferGpuIdentifierAddress"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DA, ImportType::Function, "VdSetWSSData"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DB, ImportType::Function, "VdSetWSSOption"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DC, ImportType::Function, "VdShutdownEngines"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DD, ImportType::Function, "VdTurnDisplayOff"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DE, ImportType::Function, "VdTurnDisplayOn"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DF, ImportType::Function, "KiApcNormalRoutineNop"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E0, ImportType::Function, "VdWriteDVERegisterUlong"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E1, ImportType::Function, "XVoicedHeadsetPresent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E2, ImportType::Function, "XVoicedSubmitPacket"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E3, ImportType::Function, "XVoicedClose"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E4, ImportType::Function, "XVoicedActivate"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E5, ImportType::Function, "XInputdGetCapabilities"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E6, ImportType::Function, "XInputdReadState"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E7, ImportType::Function, "XInputdWriteState"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E8, ImportType::Function, "XInputdNotify"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E9, ImportType::Function, "XInputdRawState"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01EA, ImportType::Function, "HidGetCapabilities"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01EB, ImportType::Function, "HidReadKeys"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01EC, ImportType::Function, "XInputdGetDeviceStats"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01ED, ImportType::Function, "XInputdResetDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01EE, ImportType::Function, "XInputdSetRingOfLight"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01EF, ImportType::Function, "XInputdSetRFPowerMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F0, ImportType::Function, "XInputdSetRadioFrequency"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F1, ImportType::Function, "HidGetLastInputTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F2, ImportType::Function, "XAudioRenderDriverInitialize"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F3, ImportType::Function, "XAudioRegisterRenderDriverClient"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F4, ImportType::Function, "XAudioUnregisterRenderDriverClient"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F5, ImportType::Function, "XAudioSubmitRenderDriverFrame"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F6, ImportType::Function, "XAudioRenderDriverLock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F7, ImportType::Function, "XAudioGetVoiceCategoryVolumeChangeMask"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F8, ImportType::Function, "XAudioGetVoiceCategoryVolume"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F9, ImportType::Function, "XAudioSetVoiceCategoryVolume"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FA, ImportType::Function, "XAudioBeginDigitalBypassMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FB, ImportType::Function, "XAudioEndDigitalBypassMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FC, ImportType::Function, "XAudioSubmitDigitalPacket"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FD, ImportType::Function, "XAudioQueryDriverPerformance"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FE, ImportType::Function, "XAudioGetRenderDriverThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FF, ImportType::Function, "XAudioGetSpeakerConfig"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0200, ImportType::Function, "XAudioSetSpeakerConfig"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0201, ImportType::Function, "NicSetUnicastAddress"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0202, ImportType::Function, "NicAttach"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0203, ImportType::Function, "NicDetach"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0204, ImportType::Function, "NicXmit"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0205, ImportType::Function, "NicUpdateMcastMembership"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0206, ImportType::Function, "NicFlushXmitQueue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0207, ImportType::Function, "NicShutdown"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0208, ImportType::Function, "NicGetLinkState"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0209, ImportType::Function, "NicGetStats"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020A, ImportType::Function, "NicGetOpt"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020B, ImportType::Function, "NicSetOpt"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020C, ImportType::Function, "DrvSetSysReqCallback"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020D, ImportType::Function, "DrvSetUserBindingCallback"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020E, ImportType::Function, "DrvSetContentStorageCallback"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020F, ImportType::Function, "DrvSetAutobind"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0210, ImportType::Function, "DrvGetContentStorageNotification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0211, ImportType::Function, "MtpdBeginTransaction"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0212, ImportType::Function, "MtpdCancelTransaction"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0213, ImportType::Function, "MtpdEndTransaction"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0214, ImportType::Function, "MtpdGetCurrentDevices"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0215, ImportType::Function, "MtpdReadData"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0216, ImportType::Function, "MtpdReadEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0217, ImportType::Function, "MtpdResetDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0218, ImportType::Function, "MtpdSendData"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0219, ImportType::Function, "MtpdVerifyProximity"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021A, ImportType::Function, "XUsbcamSetCaptureMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021B, ImportType::Function, "XUsbcamGetConfig"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021C, ImportType::Function, "XUsbcamSetConfig"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021D, ImportType::Function, "XUsbcamGetState"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021E, ImportType::Function, "XUsbcamReadFrame"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021F, ImportType::Function, "XUsbcamSnapshot"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0220, ImportType::Function, "XUsbcamSetView"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0221, ImportType::Function, "XUsbcamGetView"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0222, ImportType::Function, "XUsbcamCreate"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0223, ImportType::Function, "XUsbcamDestroy"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0224, ImportType::Function, "XMACreateContext"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0225, ImportType::Function, "XMAInitializeContext"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0226, ImportType::Function, "XMAReleaseContext"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0227, ImportType::Function, "XMAEnableContext"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0228, ImportType::Function, "XMADisableContext"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0229, ImportType::Function, "XMAGetOutputBufferWriteOffset"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022A, ImportType::Function, "XMASetOutputBufferReadOffset"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022B, ImportType::Function, "XMAGetOutputBufferReadOffset"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022C, ImportType::Function, "XMASetOutputBufferValid"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022D, ImportType::Function, "XMAIsOutputBufferValid"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022E, ImportType::Function, "XMASetInputBuffer0Valid"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022F, ImportType::Function, "XMAIsInputBuffer0Valid"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0230, ImportType::Function, "XMASetInputBuffer1Valid"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0231, ImportType::Function, "XMAIsInputBuffer1Valid"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0232, ImportType::Function, "XMASetInputBuffer0"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0233, ImportType::Function, "XMASetInputBuffer1"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0234, ImportType::Function, "XMAGetPacketMetadata"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0235, ImportType::Function, "XMABlockWhileInUse"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0236, ImportType::Function, "XMASetLoopData"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0237, ImportType::Function, "XMASetInputBufferReadOffset"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0238, ImportType::Function, "XMAGetInputBufferReadOffset"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0239, ImportType::Function, "ExIsBetaFeatureEnabled"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023A, ImportType::Function, "XeKeysGetFactoryChallenge"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023B, ImportType::Function, "XeKeysSetFactoryResponse"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023C, ImportType::Function, "XeKeysInitializeFuses"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023D, ImportType::Function, "XeKeysSaveBootLoader"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023E, ImportType::Function, "XeKeysSaveKeyVault"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023F, ImportType::Function, "XeKeysGetStatus"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0240, ImportType::Function, "XeKeysGeneratePrivateKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0241, ImportType::Function, "XeKeysGetKeyProperties"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0242, ImportType::Function, "XeKeysSetKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0243, ImportType::Function, "XeKeysGenerateRandomKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0244, ImportType::Function, "XeKeysGetKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0245, ImportType::Function, "XeKeysGetDigest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0246, ImportType::Function, "XeKeysGetConsoleID"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0247, ImportType::Function, "XeKeysGetConsoleType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0248, ImportType::Function, "XeKeysQwNeRsaPrvCrypt"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0249, ImportType::Function, "XeKeysHmacSha"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024A, ImportType::Function, "XInputdPassThroughRFCommand"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024B, ImportType::Function, "XeKeysAesCbc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024C, ImportType::Function, "XeKeysDes2Cbc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024D, ImportType::Function, "XeKeysDesCbc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024E, ImportType::Function, "XeKeysObscureKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024F, ImportType::Function, "XeKeysHmacShaUsingKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0250, ImportType::Function, "XeKeysSaveBootLoaderEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0251, ImportType::Function, "XeKeysAesCbcUsingKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0252, ImportType::Function, "XeKeysDes2CbcUsingKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0253, ImportType::Function, "XeKeysDesCbcUsingKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0254, ImportType::Function, "XeKeysObfuscate"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0255, ImportType::Function, "XeKeysUnObfuscate"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0256, ImportType::Function, "XeKeysConsolePrivateKeySign"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0257, ImportType::Function, "XeKeysConsoleSignatureVerification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0258, ImportType::Function, "XeKeysVerifyRSASignature"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0259, ImportType::Function, "StfsCreateDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025A, ImportType::Function, "StfsControlDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025B, ImportType::Function, "VdSwap"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025C, ImportType::Variable, "HalFsbInterruptCount"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025D, ImportType::Function, "XeKeysSaveSystemUpdate"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025E, ImportType::Function, "XeKeysLockSystemUpdate"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025F, ImportType::Function, "XeKeysExecute"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0260, ImportType::Function, "XeKeysGetVersions"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0261, ImportType::Function, "XInputdPowerDownDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0262, ImportType::Function, "AniBlockOnAnimation"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0263, ImportType::Function, "AniTerminateAnimation"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0264, ImportType::Function, "XUsbcamReset"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0265, ImportType::Function, "AniSetLogo"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0266, ImportType::Variable, "KeCertMonitorData"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0267, ImportType::Function, "HalIsExecutingPowerDownDpc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0268, ImportType::Function, "VdInitializeEDRAM"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0269, ImportType::Function, "VdRetrainEDRAM"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026A, ImportType::Function, "VdRetrainEDRAMWorker"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026B, ImportType::Variable, "VdHSIOTrainCount"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026C, ImportType::Function, "HalGetPowerUpCause"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026D, ImportType::Variable, "VdHSIOTrainingStatus"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026E, ImportType::Variable, "RgcBindInfo"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026F, ImportType::Function, "VdReadEEDIDBlock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0270, ImportType::Function, "VdEnumerateVideoModes"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0271, ImportType::Function, "VdEnableHDCP"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0272, ImportType::Function, "VdRegisterHDCPNotification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0273, ImportType::Function, "HidReadMouseChanges"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0274, ImportType::Function, "DumpSetCollectionFacility"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0275, ImportType::Function, "XexTransformImageKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0276, ImportType::Function, "XAudioOverrideSpeakerConfig"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0277, ImportType::Function, "XInputdReadTextKeystroke"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0278, ImportType::Function, "DrvXenonButtonPressed"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0279, ImportType::Function, "DrvBindToUser"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027A, ImportType::Function, "XexGetModuleImportVersions"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027B, ImportType::Function, "RtlComputeCrc32"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027C, ImportType::Function, "XeKeysSetRevocationList"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027D, ImportType::Function, "HalRegisterPowerDownCallback"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027E, ImportType::Function, "VdGetDisplayDiscoveryData"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027F, ImportType::Function, "XInputdSendStayAliveRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0280, ImportType::Function, "XVoicedSendVPort"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0281, ImportType::Function, "XVoicedGetBatteryStatus"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0282, ImportType::Function, "XInputdFFGetDeviceInfo"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0283, ImportType::Function, "XInputdFFSetEffect"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0284, ImportType::Function, "XInputdFFUpdateEffect"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0285, ImportType::Function, "XInputdFFEffectOperation"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0286, ImportType::Function, "XInputdFFDeviceControl"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0287, ImportType::Function, "XInputdFFSetDeviceGain"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0288, ImportType::Function, "XInputdFFCancelIo"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0289, ImportType::Function, "XInputdFFSetRumble"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028A, ImportType::Function, "NtAllocateEncryptedMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028B, ImportType::Function, "NtFreeEncryptedMemory"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028C, ImportType::Function, "XeKeysExSaveKeyVault"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028D, ImportType::Function, "XeKeysExSetKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028E, ImportType::Function, "XeKeysExGetKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028F, ImportType::Function, "DrvSetDeviceConfigChangeCallback"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0290, ImportType::Function, "DrvDeviceConfigChange"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0291, ImportType::Function, "HalRegisterHdDvdRomNotification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0292, ImportType::Function, "XeKeysSecurityInitialize"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0293, ImportType::Function, "XeKeysSecurityLoadSettings"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0294, ImportType::Function, "XeKeysSecuritySaveSettings"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0295, ImportType::Function, "XeKeysSecuritySetDetected"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0296, ImportType::Function, "XeKeysSecurityGetDetected"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0297, ImportType::Function, "XeKeysSecuritySetActivated"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0298, ImportType::Function, "XeKeysSecurityGetActivated"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0299, ImportType::Function, "XeKeysDvdAuthAP25InstallTable"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029A, ImportType::Function, "XeKeysDvdAuthAP25GetTableVersion"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029B, ImportType::Function, "XeKeysGetProtectedFlag"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029C, ImportType::Function, "XeKeysSetProtectedFlag"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029D, ImportType::Function, "KeEnablePFMInterrupt"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029E, ImportType::Function, "KeDisablePFMInterrupt"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029F, ImportType::Function, "KeSetProfilerISR"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A0, ImportType::Function, "VdStartDisplayDiscovery"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A1, ImportType::Function, "VdSetHDCPRevocationList"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A2, ImportType::Function, "XeKeysGetUpdateSequence"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A3, ImportType::Function, "XeKeysDvdAuthExActivate"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A4, ImportType::Function, "KeGetImagePageTableEntry"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A5, ImportType::Function, "HalRegisterBackgroundModeTransitionCallback"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A6, ImportType::Function, "AniStartBootAnimation"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A7, ImportType::Function, "HalClampUnclampOutputDACs"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A8, ImportType::Function, "HalPowerDownToBackgroundMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A9, ImportType::Function, "HalNotifyAddRemoveBackgroundTask"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AA, ImportType::Function, "HalCallBackgroundModeNotificationRoutines"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AB, ImportType::Variable, "HalFsbResetCount"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AC, ImportType::Function, "HalGetMemoryInformation"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AD, ImportType::Function, "XInputdGetLastTextInputTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AE, ImportType::Function, "VdEnableWMAProOverHDMI"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AF, ImportType::Function, "XeKeysRevokeSaveSettings"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B0, ImportType::Function, "XInputdSetTextMessengerIndicator"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B1, ImportType::Function, "MicDeviceRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B2, ImportType::Function, "XeKeysGetMediaID"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B3, ImportType::Function, "XeKeysLoadKeyVault"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B4, ImportType::Function, "KeGetVidInfo"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B5, ImportType::Function, "HalNotifyBackgroundModeTransitionComplete"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B6, ImportType::Function, "IoAcquireCancelSpinLock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B7, ImportType::Function, "IoReleaseCancelSpinLock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B8, ImportType::Function, "NtCancelIoFile"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B9, ImportType::Function, "NtCancelIoFileEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BA, ImportType::Function, "HalFinalizePowerLossRecovery"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BB, ImportType::Function, "HalSetPowerLossRecovery"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BC, ImportType::Function, "ExReadModifyWriteXConfigSettingUlong"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BD, ImportType::Function, "HalRegisterXamPowerDownCallback"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BE, ImportType::Function, "ExCancelAlarm"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BF, ImportType::Function, "ExInitializeAlarm"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C0, ImportType::Function, "ExSetAlarm"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C1, ImportType::Function, "XexActivationGetNonce"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C2, ImportType::Function, "XexActivationSetLicense"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C3, ImportType::Function, "IptvSetBoundaryKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C4, ImportType::Function, "IptvSetSessionKey"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C5, ImportType::Function, "IptvVerifyOmac1Signature"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C6, ImportType::Function, "IptvGetAesCtrTransform"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C7, ImportType::Function, "SataCdRomRecordReset"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C8, ImportType::Function, "XInputdSetTextDeviceKeyLocks"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C9, ImportType::Function, "XInputdGetTextDeviceKeyLocks"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CA, ImportType::Function, "XexActivationVerifyOwnership"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CB, ImportType::Function, "XexDisableVerboseDbgPrint"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CC, ImportType::Function, "SvodCreateDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CD, ImportType::Function, "RtlCaptureStackBackTrace"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CE, ImportType::Function, "XeKeysRevokeUpdateDynamic"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CF, ImportType::Function, "XexImportTraceEnable"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D0, ImportType::Function, "ExRegisterXConfigNotification"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D1, ImportType::Function, "XeKeysSecuritySetStat"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D2, ImportType::Function, "VdQueryRealVideoMode"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D3, ImportType::Function, "XexSetExecutablePrivilege"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D4, ImportType::Function, "XAudioSuspendRenderDriverClients"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D5, ImportType::Function, "IptvGetSessionKeyHash"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D6, ImportType::Function, "VdSetCGMSState"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D7, ImportType::Function, "VdSetSCMSState"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D8, ImportType::Function, "KeFlushMultipleTb"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D9, ImportType::Function, "VdGetOption"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DA, ImportType::Function, "VdSetOption"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DB, ImportType::Variable, "UsbdBootEnumerationDoneEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DC, ImportType::Variable, "StfsDeviceErrorEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DD, ImportType::Function, "ExTryToAcquireReadWriteLockExclusive"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DE, ImportType::Function, "ExTryToAcquireReadWriteLockShared"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DF, ImportType::Function, "XexSetLastKdcTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E0, ImportType::Function, "XInputdControl"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E1, ImportType::Function, "RmcDeviceRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E2, ImportType::Function, "LDIResetDecompression"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E3, ImportType::Function, "NicRegisterDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E4, ImportType::Function, "UsbdAddDeviceComplete"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E5, ImportType::Function, "UsbdCancelAsyncTransfer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E6, ImportType::Function, "UsbdGetDeviceSpeed"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E7, ImportType::Function, "UsbdGetDeviceTopology"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E8, ImportType::Function, "UsbdGetEndpointDescriptor"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E9, ImportType::Function, "UsbdIsDeviceAuthenticated"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02EA, ImportType::Function, "UsbdOpenDefaultEndpoint"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02EB, ImportType::Function, "UsbdOpenEndpoint"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02EC, ImportType::Function, "UsbdQueueAsyncTransfer"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02ED, ImportType::Function, "UsbdQueueCloseDefaultEndpoint"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02EE, ImportType::Function, "UsbdQueueCloseEndpoint"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02EF, ImportType::Function, "UsbdRemoveDeviceComplete"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F0, ImportType::Function, "KeRemoveQueueApc"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F1, ImportType::Variable, "UsbdDriverLoadRequiredEvent"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F2, ImportType::Function, "UsbdGetRequiredDrivers"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F3, ImportType::Function, "UsbdRegisterDriverObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F4, ImportType::Function, "UsbdUnregisterDriverObject"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F5, ImportType::Function, "UsbdCallAndBlockOnDpcRoutine"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F6, ImportType::Function, "UsbdResetDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F7, ImportType::Function, "UsbdGetDeviceDescriptor"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F8, ImportType::Function, "NomnilGetExtension"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F9, ImportType::Function, "NomnilStartCloseDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FA, ImportType::Function, "WifiBeginAuthentication"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FB, ImportType::Function, "WifiCheckCounterMeasures"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FC, ImportType::Function, "WifiChooseAuthenCipherSetFromBSSID"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FD, ImportType::Function, "WifiCompleteAuthentication"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FE, ImportType::Function, "WifiGetAssociationIE"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FF, ImportType::Function, "WifiOnMICError"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0300, ImportType::Function, "WifiPrepareAuthenticationContext"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0301, ImportType::Function, "WifiRecvEAPOLPacket"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0302, ImportType::Function, "WifiDeduceNetworkType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0303, ImportType::Function, "NicUnregisterDevice"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0304, ImportType::Function, "DumpXitThread"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0305, ImportType::Function, "XInputdSetWifiChannel"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0306, ImportType::Function, "NomnilSetLed"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0307, ImportType::Function, "WifiCalculateRegulatoryDomain"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0308, ImportType::Function, "WifiSelectAdHocChannel"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0309, ImportType::Function, "WifiChannelToFrequency"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030A, ImportType::Function, "MmGetPoolPagesType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030B, ImportType::Function, "ExExpansionInstall"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030C, ImportType::Function, "ExExpansionCall"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030D, ImportType::Function, "PsCamDeviceRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030E, ImportType::Function, "McaDeviceRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030F, ImportType::Function, "DetroitDeviceRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0310, ImportType::Function, "XeCryptSha256Init"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0311, ImportType::Function, "XeCryptSha256Update"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0312, ImportType::Function, "XeCryptSha256Final"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0313, ImportType::Function, "XeCryptSha256"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0314, ImportType::Function, "XeCryptSha384Init"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0315, ImportType::Function, "XeCryptSha384Update"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0316, ImportType::Function, "XInputdGetDevicePid"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0317, ImportType::Function, "HalGetNotedArgonErrors"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0318, ImportType::Function, "XeCryptSha384Final"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0319, ImportType::Function, "HalReadArgonEeprom"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031A, ImportType::Function, "HalWriteArgonEeprom"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031B, ImportType::Function, "XeKeysFcrtLoad"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031C, ImportType::Function, "XeKeysFcrtSave"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031D, ImportType::Function, "XeKeysFcrtSet"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031E, ImportType::Function, "XeCryptSha384"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031F, ImportType::Function, "XeCryptSha512Init"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0320, ImportType::Function, "XAudioRegisterRenderDriverMECClient"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0321, ImportType::Function, "XAudioUnregisterRenderDriverMECClient"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0322, ImportType::Function, "XAudioCaptureRenderDriverFrame"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0323, ImportType::Function, "XeCryptSha512Update"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0324, ImportType::Function, "XeCryptSha512Final"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0325, ImportType::Function, "XeCryptSha512"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0326, ImportType::Function, "XeCryptBnQwNeCompare"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0327, ImportType::Function, "XVoicedGetDirectionalData"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0328, ImportType::Function, "DrvSetMicArrayStartCallback"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0329, ImportType::Function, "DevAuthGetStatistics"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032A, ImportType::Function, "NullCableRequest"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032B, ImportType::Function, "XeKeysRevokeIsDeviceRevoked"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032C, ImportType::Function, "DumpUpdateDumpSettings"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032D, ImportType::Function, "EtxConsumerDisableEventType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032E, ImportType::Function, "EtxConsumerEnableEventType"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032F, ImportType::Function, "EtxConsumerProcessLogs"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0330, ImportType::Function, "EtxConsumerRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0331, ImportType::Function, "EtxConsumerUnregister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0332, ImportType::Function, "EtxProducerLog"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0333, ImportType::Function, "EtxProducerLogV"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0334, ImportType::Function, "EtxProducerRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0335, ImportType::Function, "EtxProducerUnregister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0336, ImportType::Function, "EtxConsumerFlushBuffers"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0337, ImportType::Function, "EtxProducerLogXwpp"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0338, ImportType::Function, "EtxProducerLogXwppV"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0339, ImportType::Function, "UsbdEnableDisableRootHubPort"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033A, ImportType::Function, "EtxBufferRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033B, ImportType::Function, "EtxBufferUnregister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033C, ImportType::Function, "DumpRegisterDedicatedDataBlock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033D, ImportType::Function, "XeKeysDvdAuthExSave"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033E, ImportType::Function, "XeKeysDvdAuthExInstall"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033F, ImportType::Function, "XexShimDisable"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0340, ImportType::Function, "XexShimEnable"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0341, ImportType::Function, "XexShimEntryDisable"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0342, ImportType::Function, "XexShimEntryEnable"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0343, ImportType::Function, "XexShimEntryRegister"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0344, ImportType::Function, "XexShimLock"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0345, ImportType::Variable, "XboxKrnlVersion4Digit"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0346, ImportType::Function, "XeKeysObfuscateEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0347, ImportType::Function, "XeKeysUnObfuscateEx"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0348, ImportType::Function, "XexTitleHash"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0349, ImportType::Function, "XexTitleHashClose"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034A, ImportType::Function, "XexTitleHashContinue"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034B, ImportType::Function, "XexTitleHashOpen"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034C, ImportType::Function, "XAudioGetRenderDriverTic"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034D, ImportType::Function, "XAudioEnableDucker"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034E, ImportType::Function, "XAudioSetDuckerLevel"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034F, ImportType::Function, "XAudioIsDuckerEnabled"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0350, ImportType::Function, "XAudioGetDuckerLevel"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0351, ImportType::Function, "XAudioGetDuckerThreshold"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0352, ImportType::Function, "XAudioSetDuckerThreshold"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0353, ImportType::Function, "XAudioGetDuckerAttackTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0354, ImportType::Function, "XAudioSetDuckerAttackTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0355, ImportType::Function, "XAudioGetDuckerReleaseTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0356, ImportType::Function, "XAudioSetDuckerReleaseTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0357, ImportType::Function, "XAudioGetDuckerHoldTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0358, ImportType::Function, "XAudioSetDuckerHoldTime"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0359, ImportType::Function, "DevAuthShouldAlwaysEnforce"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x035A, ImportType::Function, "XAudioGetUnderrunCount"),
+    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x035C, ImportType::Function, "XVoicedIsActiveProcess"),
+
+
+
+    // xbmd
+
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0001, ImportType::Function, "DmAllocatePool"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0002, ImportType::Function, "DmAllocatePoolWithTag"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0003, ImportType::Function, "DmCloseCounters"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0004, ImportType::Function, "DmCloseModuleSections"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0005, ImportType::Function, "DmCloseModuleSections"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0006, ImportType::Function, "DmCloseNotificationSession"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0007, ImportType::Function, "DmClosePerformanceCounter"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0008, ImportType::Function, "DmContinueThread"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0009, ImportType::Function, "DmFreePool"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x000A, ImportType::Function, "DmGetMemory"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x000B, ImportType::Function, "DmGetModuleLongName"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x000C, ImportType::Function, "DmGetProcAddress"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x000D, ImportType::Function, "DmGetThreadContext"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x000F, ImportType::Function, "DmGetThreadList"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0010, ImportType::Function, "DmGetXbeInfo"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0011, ImportType::Function, "DmGetXboxName"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0013, ImportType::Function, "DmGo"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0014, ImportType::Function, "DmHaltThread"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0015, ImportType::Function, "DmIsDebuggerPresent"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0016, ImportType::Function, "DmIsThreadStopped"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0017, ImportType::Function, "DmLoadExtension"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0018, ImportType::Function, "DmNotify"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0019, ImportType::Function, "DmOpenNotificationSession"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x001A, ImportType::Function, "DmOpenPerformanceCounter"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x001B, ImportType::Function, "DmQueryPerformanceCounterHandle"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x001C, ImportType::Function, "DmReboot"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x001E, ImportType::Function, "DmRegisterCommandProcessor"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0020, ImportType::Function, "DmRegisterNotificationProcessor"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0021, ImportType::Function, "DmRegisterPerformanceCounter"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0022, ImportType::Function, "DmRemoveBreakpoint"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0023, ImportType::Function, "DmResumeThread"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0024, ImportType::Function, "DmSendNotificationString"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0025, ImportType::Function, "DmSetBreakpoint"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0026, ImportType::Function, "DmSetDataBreakpoint"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0027, ImportType::Function, "DmSetInitialBreakpoint"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0028, ImportType::Function, "DmSetMemory"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0029, ImportType::Function, "DmSetThreadContext"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x002A, ImportType::Function, "DmSetTitle"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x002B, ImportType::Function, "DmSetXboxName"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x002D, ImportType::Function, "DmStop"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x002E, ImportType::Function, "DmStopOn"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0030, ImportType::Function, "DmSuspendThread"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0031, ImportType::Function, "DmThreadUserData"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0032, ImportType::Function, "DmUnloadExtension"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0033, ImportType::Function, "DmWalkLoadedModules"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0034, ImportType::Function, "DmWalkModuleSections"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0035, ImportType::Function, "DmWalkPerformanceCounters"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0037, ImportType::Function, "DmCloseCounters"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0038, ImportType::Function, "DmIsBreakpoint"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0039, ImportType::Function, "DmCloseCounters"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003A, ImportType::Function, "DmSetUserAccess"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003B, ImportType::Function, "DmGetUserAccess"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003C, ImportType::Function, "DmWalkUserList"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003D, ImportType::Function, "DmAddUser"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003E, ImportType::Function, "DmEnableSecurity"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003F, ImportType::Function, "DmIsSecurityEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0040, ImportType::Function, "DmRemoveUser"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0041, ImportType::Function, "__CAP_Start_Profiling"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0042, ImportType::Function, "__CAP_End_Profiling"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0046, ImportType::Function, "__CAP_Enter_ImportType::Function"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0047, ImportType::Function, "__CAP_Exit_ImportType::Function"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0048, ImportType::Function, "DmRegisterCommandProcessorEx"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0049, ImportType::Function, "DmStartProfiling"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004A, ImportType::Function, "DmStopProfiling"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004B, ImportType::Function, "DmQueryMemoryStatistics"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004C, ImportType::Function, "DmEnableStackTrace"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004D, ImportType::Function, "DmQueryAllocationTypeName"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004E, ImportType::Function, "DmRegisterAllocationType"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004F, ImportType::Function, "DmInsertAllocationEntry"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0050, ImportType::Function, "DmRemoveAllocationEntry"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0051, ImportType::Function, "DmSetTitleEx"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0052, ImportType::Function, "DmCaptureStackBackTrace"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0053, ImportType::Function, "DmCrashDump"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0054, ImportType::Function, "DmIsFastCAPEnabled"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0055, ImportType::Function, "DmGetFileAccessCount"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0058, ImportType::Function, "DmGetUtilityDriveInfo"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0059, ImportType::Function, "DmGetThreadInfoEx"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x005A, ImportType::Function, "DmSetProfilingOptions"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x005B, ImportType::Function, "DmQuerySystemSettings"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x005C, ImportType::Function, "DmSaveSystemSettings"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006A, ImportType::Function, "DmpGetPgoModuleHandleForBaseAddress"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006B, ImportType::Function, "DmpOnPgoModuleLoad"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006C, ImportType::Function, "DmPgoStartDataCollection"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006D, ImportType::Function, "DmPgoStopDataCollection"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006E, ImportType::Function, "DmPgoSaveSnapshot"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006F, ImportType::Function, "IrtClientAbort"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0070, ImportType::Function, "IrtPogoInit"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0071, ImportType::Function, "IrtSetStaticInfo"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0072, ImportType::Function, "IrtAutoSweepW"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0073, ImportType::Function, "IrtAutoSweepA"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0075, ImportType::Function, "DmGetDumpMode"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0076, ImportType::Function, "DmSetDumpMode"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0077, ImportType::Function, "DmGetDumpSettings"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0078, ImportType::Function, "DmSetDumpSettings"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0079, ImportType::Function, "DmGetEventDeferFlags"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x007A, ImportType::Function, "DmSetEventDeferFlags"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x007B, ImportType::Function, "DmWalkCommittedMemory"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x007C, ImportType::Function, "DmCloseCounters"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x007D, ImportType::Function, "DmRebootEx"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0082, ImportType::Function, "DmMountFdfxVolume"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0083, ImportType::Function, "DmCapGetFileHeader"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0084, ImportType::Function, "DmCapFreeFileHeader"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0085, ImportType::Function, "DmTraceStartRecording"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0086, ImportType::Function, "DmTraceStartRecordingImportType::Function"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0087, ImportType::Function, "DmTraceSetBufferSize"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0088, ImportType::Function, "DmTraceStopRecording"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0089, ImportType::Function, "DmTraceSaveBuffer"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x008C, ImportType::Function, "DmGetConsoleType"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x008D, ImportType::Function, "DmMapDevkitDrive"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x008E, ImportType::Function, "DmWalkLoadedModulesEx"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x008F, ImportType::Function, "DmGetXexHeaderField"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0090, ImportType::Function, "DmGetMouseChanges"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0091, ImportType::Function, "DmFindPdbSignature"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0092, ImportType::Function, "DmGetProfilingStatus"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0093, ImportType::Function, "DmOpticalDiscLogStart"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0094, ImportType::Function, "DmOpticalDiscLogStop"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0095, ImportType::Function, "DmStartSamplingProfiler"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0096, ImportType::Function, "DmStopSamplingProfiler"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0097, ImportType::Function, "DmGetSamplingProfilerInfo"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0098, ImportType::Function, "DmStartFileEventCapture"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0099, ImportType::Function, "DmStopFileEventCapture"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009A, ImportType::Function, "DmSetFileEventMarker"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009B, ImportType::Function, "DmMarkPseudoCreateBegin"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009C, ImportType::Function, "DmMarkPseudoCreateEnd"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009D, ImportType::Function, "DmMarkPseudoEventBegin"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009E, ImportType::Function, "DmMarkPseudoEventEnd"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009F, ImportType::Function, "DmMarkFileEventWorkerThreadBegin"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A0, ImportType::Function, "DmMarkFileEventWorkerThreadEnd"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A1, ImportType::Function, "DmGetSystemInfo"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A2, ImportType::Function, "DmAbortProfiling"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A3, ImportType::Function, "DmNetCaptureStart"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A4, ImportType::Function, "DmNetCaptureStop"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A5, ImportType::Function, "DmQueryTitleMemoryStatistics"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A6, ImportType::Function, "DmAutomationGetInputProcess"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A7, ImportType::Function, "DmAutomationBindController"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A8, ImportType::Function, "DmAutomationUnbindController"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A9, ImportType::Function, "DmAutomationConnectController"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AA, ImportType::Function, "DmAutomationDisconnectController"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AB, ImportType::Function, "DmAutomationSetGamepadState"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AC, ImportType::Function, "DmAutomationQueueGamepadState"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AD, ImportType::Function, "DmAutomationClearGamepadQueue"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AE, ImportType::Function, "DmAutomationQueryGamepadQueue"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AF, ImportType::Function, "DmAutomationGetUserDefaultProfile"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B0, ImportType::Function, "DmAutomationSetUserDefaultProfile"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B1, ImportType::Function, "DmTraceIsRecording"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B2, ImportType::Function, "DmLoadDebuggerExtension"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B3, ImportType::Function, "DmUnloadDebuggerExtension"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B4, ImportType::Function, "DmCreateSystemThread"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B5, ImportType::Function, "PEPLELookup"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B6, ImportType::Function, "PEPLELookupCompact"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B7, ImportType::Function, "PVPLELookup"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B8, ImportType::Function, "PVPLELookupCompact"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B9, ImportType::Function, "PVPLELookupCompactMDS"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BA, ImportType::Function, "PVPLEFilteredLookup"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BB, ImportType::Function, "PVPLEFilteredLookupCompact"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BC, ImportType::Function, "PVPLEFilteredLookupCompactMDS"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BD, ImportType::Function, "PVPLETemplatedLookup"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BE, ImportType::Function, "PVPLETemplatedLookupCompact"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BF, ImportType::Function, "PVPLETemplatedLookupCompactMDS"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C0, ImportType::Function, "DmpPgoCounterOverflow"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C1, ImportType::Function, "UpdateMDSProbeState"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C2, ImportType::Function, "DmGetHttpRegistration"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C3, ImportType::Function, "DmTraceSetIOThread"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C4, ImportType::Function, "DmPMCInstallAndStart"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C5, ImportType::Function, "DmPMCStopAndReport"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C6, ImportType::Function, "DmPMCInstallSetup"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C7, ImportType::Function, "DmPMCUnInstallSetup"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C8, ImportType::Function, "DmPMCResetCounters"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C9, ImportType::Function, "DmPMCSetTriggerProcessor"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CA, ImportType::Function, "DmPMCStart"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CB, ImportType::Function, "DmPMCStop"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CC, ImportType::Function, "DmPMCGetCounter"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CD, ImportType::Function, "DmPMCGetCounters"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CE, ImportType::Function, "DmPMCGetCounterName"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CF, ImportType::Function, "DmPMCDumpCounters"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D0, ImportType::Function, "DmPMCDumpCountersVerbose"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D1, ImportType::Function, "DmPMCGetCounterCostEstimate"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D2, ImportType::Function, "DmPMCGetCounterSource"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D3, ImportType::Function, "DmPMCComputeFrequency"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D4, ImportType::Function, "DmGetAdditionalTitleMemorySetting"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D5, ImportType::Function, "DmGetDebugMemorySize"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D6, ImportType::Function, "DmGetConsoleDebugMemoryStatus"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D7, ImportType::Function, "DmNetSimSetLinkStatusHidden"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D8, ImportType::Function, "DmNetSimInsertQueue"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D9, ImportType::Function, "DmNetSimRemoveQueue"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DA, ImportType::Function, "DmNetSimRemoveAllQueues"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DB, ImportType::Function, "DmNetSimModifyQueueSettings"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DC, ImportType::Function, "DmGetConsoleFeatures"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DD, ImportType::Function, "DmNetSimGetQueueStats"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DE, ImportType::Function, "DmNetSimGetQueueSettings"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DF, ImportType::Function, "DmNetSimGetNumQueues"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00E0, ImportType::Function, "DmNetSimInsertIpv4Redirect"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00E1, ImportType::Function, "DmNetSimRemoveIpv4Redirect"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00E2, ImportType::Function, "DmNetSimGetNumIpv4Redirects"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x012C, ImportType::Function, "XLFAllocate"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x012D, ImportType::Function, "XLFFree"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x012E, ImportType::Function, "XLFQueueAdd"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x012F, ImportType::Function, "XLFQueueAllocated"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0130, ImportType::Function, "XLFQueueCreate"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0131, ImportType::Function, "XLFQueueDestroy"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0132, ImportType::Function, "XLFQueueGetEntryCount"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0133, ImportType::Function, "XLFQueueIsEmpty"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0134, ImportType::Function, "XLFQueueRemove"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0135, ImportType::Function, "XLFQueueUnsafeDump"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0136, ImportType::Function, "XLFStackAllocated"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0137, ImportType::Function, "XLFStackCreate"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0138, ImportType::Function, "XLFStackDestroy"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0139, ImportType::Function, "XLFStackGetEntryCount"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x013A, ImportType::Function, "XLFStackIsEmpty"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x013B, ImportType::Function, "XLFStackPop"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x013C, ImportType::Function, "XLFStackPush"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x013D, ImportType::Function, "XLFStackUnsafeDump"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0140, ImportType::Function, "XLFPriorityQueueAdd"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0141, ImportType::Function, "XLFPriorityQueueAllocated"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0142, ImportType::Function, "XLFPriorityQueueCreate"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0143, ImportType::Function, "XLFPriorityQueueDestroy"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0144, ImportType::Function, "XLFPriorityQueueGetEntryCount"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0145, ImportType::Function, "XLFPriorityQueueIsEmpty"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0146, ImportType::Function, "XLFPriorityQueueRemoveFirst"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0147, ImportType::Function, "XLFPriorityQueueRemove"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0148, ImportType::Function, "XLFPriorityQueueUnsafeDump"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014A, ImportType::Function, "XLFHashTableAdd"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014B, ImportType::Function, "XLFHashTableAllocated"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014C, ImportType::Function, "XLFHashTableCreate"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014D, ImportType::Function, "XLFHashTableDestroy"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014E, ImportType::Function, "XLFHashTableGetEntryCount"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014F, ImportType::Function, "XLFHashTableIsEmpty"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0150, ImportType::Function, "XLFHashTableRemoveFirst"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0151, ImportType::Function, "XLFHashTableRemove"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0152, ImportType::Function, "XLFHashTableUnsafeDump"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0154, ImportType::Function, "XLFPoolAcquireLock"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0155, ImportType::Function, "XLFPoolAllocated"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0156, ImportType::Function, "XLFPoolCreate"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0157, ImportType::Function, "XLFPoolCreateLock"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0158, ImportType::Function, "XLFPoolDestroy"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0159, ImportType::Function, "XLFPoolDestroyLock"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015A, ImportType::Function, "XLFPoolIncreaseEvents"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015B, ImportType::Function, "XLFPoolIncreaseLocks"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015C, ImportType::Function, "XLFPoolInitializeLock"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015D, ImportType::Function, "XLFPoolNumberOfEvents"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015E, ImportType::Function, "XLFPoolNumberOfLocks"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015F, ImportType::Function, "XLFPoolReleaseLock"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0163, ImportType::Function, "XLFStartLog"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0164, ImportType::Function, "XLFStartUserLog"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0165, ImportType::Function, "XLFInitializeLog"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0166, ImportType::Function, "XLFInitializeUserLog"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0168, ImportType::Function, "XLFEndLog"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0169, ImportType::Function, "XLFLogPrint"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x016A, ImportType::Function, "XLFLogPrintV"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x016B, ImportType::Function, "XLFLogBuffer"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x016C, ImportType::Function, "XLFLogMessageStats"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0172, ImportType::Function, "XLockFreeGetErrorHandler"),
+    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0173, ImportType::Function, "XLockFreeSetErrorHandler"),
+};
+
+
+#undef LOAD_IMPORT
+
+// Dense ordinal -> import_table index for each library, built at compile time
+// ordinals are small and mostly contiguous (xam tops out around 0xB50), so a flat array is the perfect hash
+namespace ImportTableIndex
 {
-    bool libFound = false;
-    bool ordFound = false;
+    constexpr size_t EntryCount = sizeof(import_table) / sizeof(import_table[0]);
+    constexpr uint16_t NoEntry = 0xFFFF;
+    static_assert(EntryCount < NoEntry, "import_table index doesn't fit in 16 bits");
 
-    if(strcmp(libName.c_str(), "xboxkrnl.exe") == 0)
+    constexpr uint32_t maxOrdinal(XboxLibrary lib)
     {
-        for (Import* imp : import_table)
+        uint32_t max = 0;
+        for (size_t i = 0; i < EntryCount; i++)
         {
-            if (imp->library == XboxLibrary::XboxKrnl)
+            if (import_table[i].library == lib && import_table[i].ordinal > max)
             {
-                libFound = true;
-
-                if(imp->ordinal == ordinal)
-                {
-                    ordFound = true;
-                    return imp;
-                }
+                max = import_table[i].ordinal;
             }
         }
+        return max;
     }
 
-    if (strcmp(libName.c_str(), "xam.xex") == 0)
+    template <XboxLibrary Lib>
+    constexpr std::array<uint16_t, maxOrdinal(Lib) + 1> build()
     {
-        for (Import* imp : import_table)
+        std::array<uint16_t, maxOrdinal(Lib) + 1> index{};
+        for (auto& slot : index)
         {
-            if (imp->library == XboxLibrary::Xam)
+            slot = NoEntry;
+        }
+        for (size_t i = 0; i < EntryCount; i++)
+        {
+            if (import_table[i].library == Lib)
             {
-                libFound = true;
-
-                if (imp->ordinal == ordinal)
-                {
-                    ordFound = true;
-                    return imp;
-                }
+                index[import_table[i].ordinal] = (uint16_t)i;
             }
         }
+        return index;
     }
 
-    if(!libFound)
+    inline constexpr auto xboxKrnl = build<XboxLibrary::XboxKrnl>();
+    inline constexpr auto xam = build<XboxLibrary::Xam>();
+    inline constexpr auto xbdm = build<XboxLibrary::Xbdm>();
+    inline constexpr auto xapi = build<XboxLibrary::Xapi>();
+
+    template <size_t N>
+    constexpr const ImportEntry* lookup(const std::array<uint16_t, N>& index, uint32_t ordinal)
     {
-        printf("No Lib with name: %s found\n", libName.c_str());
-        return nullptr;
+        if (ordinal >= N || index[ordinal] == NoEntry)
+        {
+            return nullptr;
+        }
+        return &import_table[index[ordinal]];
     }
+}
 
-    if (!ordFound)
+// nullptr when the ordinal isn't in the table
+constexpr const ImportEntry* findImport(XboxLibrary lib, uint32_t ordinal)
+{
+    switch (lib)
     {
-        printf("No Import in Lib: %s with ordinal i% found\n", libName.c_str(), ordinal);
-        return nullptr;
+    case XboxLibrary::XboxKrnl: return ImportTableIndex::lookup(ImportTableIndex::xboxKrnl, ordinal);
+    case XboxLibrary::Xam:      return ImportTableIndex::lookup(ImportTableIndex::xam, ordinal);
+    case XboxLibrary::Xbdm:     return ImportTableIndex::lookup(ImportTableIndex::xbdm, ordinal);
+    case XboxLibrary::Xapi:     return ImportTableIndex::lookup(ImportTableIndex::xapi, ordinal);
     }
+    return nullptr;
 }
 
-
-static inline void initImportTable()
+// Library of an import descriptor name ("xboxkrnl.exe", "xam.xex", ...), false if it isn't a system library
+inline bool findImportLibrary(const std::string& libName, XboxLibrary& lib)
 {
-    //
-    // Xapi
-    // 
-
-    LOAD_IMPORT(XboxLibrary::Xapi, 0x0001, ImportType::Variable, "XapiProcessHeap");
-    LOAD_IMPORT(XboxLibrary::Xapi, 0x0002, ImportType::Variable, "_locktable");
-    LOAD_IMPORT(XboxLibrary::Xapi, 0x0003, ImportType::Variable, "__tlsindexXapi");
-    LOAD_IMPORT(XboxLibrary::Xapi, 0x0004, ImportType::Function, "XapiTermHeapNoop");
-    LOAD_IMPORT(XboxLibrary::Xapi, 0x0005, ImportType::Variable, "XapiDebugHeap");
-
-    //
-    // Xam
-    //
-
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0001, ImportType::Function, "NetDll_WSAStartup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0002, ImportType::Function, "NetDll_WSACleanup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0003, ImportType::Function, "NetDll_socket");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0004, ImportType::Function, "NetDll_closesocket");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0005, ImportType::Function, "NetDll_shutdown");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0006, ImportType::Function, "NetDll_ioctlsocket");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0007, ImportType::Function, "NetDll_setsockopt");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0008, ImportType::Function, "NetDll_getsockopt");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0009, ImportType::Function, "NetDll_getsockname");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x000A, ImportType::Function, "NetDll_getpeername");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x000B, ImportType::Function, "NetDll_bind");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x000C, ImportType::Function, "NetDll_connect");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x000D, ImportType::Function, "NetDll_listen");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x000E, ImportType::Function, "NetDll_accept");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x000F, ImportType::Function, "NetDll_select");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0010, ImportType::Function, "NetDll_WSAGetOverlappedResult");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0011, ImportType::Function, "NetDll_WSACancelOverlappedIO");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0012, ImportType::Function, "NetDll_recv");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0013, ImportType::Function, "NetDll_WSARecv");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0014, ImportType::Function, "NetDll_recvfrom");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0015, ImportType::Function, "NetDll_WSARecvFrom");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0016, ImportType::Function, "NetDll_send");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0017, ImportType::Function, "NetDll_WSASend");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0018, ImportType::Function, "NetDll_sendto");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0019, ImportType::Function, "NetDll_WSASendTo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x001A, ImportType::Function, "NetDll_inet_addr");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x001B, ImportType::Function, "NetDll_WSAGetLastError");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x001C, ImportType::Function, "NetDll_WSASetLastError");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x001D, ImportType::Function, "NetDll_WSACreateEvent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x001E, ImportType::Function, "NetDll_WSACloseEvent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x001F, ImportType::Function, "NetDll_WSASetEvent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0020, ImportType::Function, "NetDll_WSAResetEvent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0021, ImportType::Function, "NetDll_WSAWaitForMultipleEvents");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0022, ImportType::Function, "NetDll___WSAFDIsSet");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0023, ImportType::Function, "NetDll_WSAEventSelect");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0024, ImportType::Function, "NetDll_WSAStartupEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0033, ImportType::Function, "NetDll_XNetStartup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0034, ImportType::Function, "NetDll_XNetCleanup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0035, ImportType::Function, "NetDll_XNetRandom");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0036, ImportType::Function, "NetDll_XNetCreateKey");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0037, ImportType::Function, "NetDll_XNetRegisterKey");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0038, ImportType::Function, "NetDll_XNetUnregisterKey");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0039, ImportType::Function, "NetDll_XNetXnAddrToInAddr");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x003A, ImportType::Function, "NetDll_XNetServerToInAddr");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x003B, ImportType::Function, "NetDll_XNetTsAddrToInAddr");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x003C, ImportType::Function, "NetDll_XNetInAddrToXnAddr");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x003D, ImportType::Function, "NetDll_XNetInAddrToServer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x003E, ImportType::Function, "NetDll_XNetInAddrToString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x003F, ImportType::Function, "NetDll_XNetUnregisterInAddr");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0040, ImportType::Function, "NetDll_XNetXnAddrToMachineId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0041, ImportType::Function, "NetDll_XNetConnect");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0042, ImportType::Function, "NetDll_XNetGetConnectStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0043, ImportType::Function, "NetDll_XNetDnsLookup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0044, ImportType::Function, "NetDll_XNetDnsRelease");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0045, ImportType::Function, "NetDll_XNetQosListen");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0046, ImportType::Function, "NetDll_XNetQosLookup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0047, ImportType::Function, "NetDll_XNetQosServiceLookup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0048, ImportType::Function, "NetDll_XNetQosRelease");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0049, ImportType::Function, "NetDll_XNetGetTitleXnAddr");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x004A, ImportType::Function, "NetDll_XNetGetDebugXnAddr");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x004B, ImportType::Function, "NetDll_XNetGetEthernetLinkStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x004C, ImportType::Function, "NetDll_XNetGetBroadcastVersionStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x004D, ImportType::Function, "NetDll_XNetQosGetListenStats");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x004E, ImportType::Function, "NetDll_XNetGetOpt");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x004F, ImportType::Function, "NetDll_XNetSetOpt");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0050, ImportType::Function, "NetDll_XNetStartupEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0051, ImportType::Function, "NetDll_XNetReplaceKey");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0052, ImportType::Function, "NetDll_XNetGetXnAddrPlatform");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0053, ImportType::Function, "NetDll_XNetGetSystemLinkPort");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0054, ImportType::Function, "NetDll_XNetSetSystemLinkPort");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0065, ImportType::Function, "NetDll_XnpLoadConfigParams");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0066, ImportType::Function, "NetDll_XnpSaveConfigParams");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0067, ImportType::Function, "NetDll_XnpConfigUPnP");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0068, ImportType::Function, "NetDll_XnpConfig");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0069, ImportType::Function, "NetDll_XnpGetConfigStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x006A, ImportType::Function, "NetDll_XnpLoadMachineAccount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x006B, ImportType::Function, "NetDll_XnpSaveMachineAccount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x006C, ImportType::Function, "NetDll_XnpCapture");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x006D, ImportType::Function, "NetDll_XnpEthernetInterceptSetCallbacks");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x006E, ImportType::Function, "NetDll_XnpEthernetInterceptXmit");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x006F, ImportType::Function, "NetDll_XnpEthernetInterceptRecv");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0070, ImportType::Function, "NetDll_XnpLogonGetStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0071, ImportType::Function, "NetDll_XnpLogonGetQFlags");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0072, ImportType::Function, "NetDll_XnpLogonSetQFlags");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0073, ImportType::Function, "NetDll_XnpLogonSetQEvent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0074, ImportType::Function, "NetDll_XnpLogonClearQEvent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0075, ImportType::Function, "NetDll_XnpLogonGetQVals");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0076, ImportType::Function, "NetDll_XnpLogonSetQVals");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0077, ImportType::Function, "NetDll_XnpLogonSetPState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0078, ImportType::Function, "NetDll_XnpGetVlanXboxName");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0079, ImportType::Function, "NetDll_XnpSetVlanXboxName");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x007A, ImportType::Function, "NetDll_XnpGetActiveSocketList");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x007B, ImportType::Function, "NetDll_XnpNoteSystemTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x007C, ImportType::Function, "NetDll_XnpRegisterKeyForCallerType");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x007D, ImportType::Function, "NetDll_XnpUnregisterKeyForCallerType");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x007E, ImportType::Function, "NetDll_XnpLogonGetChallenge");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x007F, ImportType::Function, "NetDll_XnpLogonClearChallenge");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0080, ImportType::Function, "NetDll_XnpLogonSetChallengeResponse");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0081, ImportType::Function, "NetDll_XnpGetSecAssocList");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0082, ImportType::Function, "NetDll_XnpGetKeyList");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0083, ImportType::Function, "NetDll_XnpGetQosLookupList");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0084, ImportType::Function, "NetDll_XnpPersistTitleState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0085, ImportType::Function, "NetDll_XnpReplaceKeyForCallerType");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0086, ImportType::Function, "NetDll_XnpEthernetInterceptSetExtendedReceiveCallback");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0087, ImportType::Function, "NetDll_XnpQosHistoryLoad");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0088, ImportType::Function, "NetDll_XnpQosHistorySaveMeasurements");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0089, ImportType::Function, "NetDll_XnpQosHistoryGetEntries");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x008A, ImportType::Function, "NetDll_XnpQosHistoryGetAggregateMeasurement");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x008B, ImportType::Function, "NetDll_XnpToolSetCallbacks");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x008C, ImportType::Function, "NetDll_XnpToolIpProxyInject");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x008D, ImportType::Function, "NetDll_XnpUpdateConfigParams");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x008E, ImportType::Function, "NetDll_XnpEthernetInterceptXmitAsIp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0097, ImportType::Function, "NetDll_XmlDownloadStart");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0098, ImportType::Function, "NetDll_XmlDownloadContinue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0099, ImportType::Function, "NetDll_XmlDownloadStop");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x009A, ImportType::Function, "NetDll_XmlDownloadGetParseTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x009B, ImportType::Function, "NetDll_XmlDownloadGetReceivedDataSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00C6, ImportType::Function, "XnpGetXwppMemoryLogSnapshot");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00C7, ImportType::Function, "XnpGetXwppRuntimeFilter");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00C9, ImportType::Function, "NetDll_XHttpStartup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00CA, ImportType::Function, "NetDll_XHttpShutdown");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00CB, ImportType::Function, "NetDll_XHttpOpen");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00CC, ImportType::Function, "NetDll_XHttpCloseHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00CD, ImportType::Function, "NetDll_XHttpConnect");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00CE, ImportType::Function, "NetDll_XHttpSetStatusCallback");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00CF, ImportType::Function, "NetDll_XHttpOpenRequest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00D0, ImportType::Function, "NetDll_XHttpOpenRequestUsingMemory");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00D1, ImportType::Function, "NetDll_XHttpSendRequest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00D2, ImportType::Function, "NetDll_XHttpReceiveResponse");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00D3, ImportType::Function, "NetDll_XHttpQueryHeaders");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00D4, ImportType::Function, "NetDll_XHttpReadData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00D5, ImportType::Function, "NetDll_XHttpWriteData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00D6, ImportType::Function, "NetDll_XHttpQueryOption");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00D7, ImportType::Function, "NetDll_XHttpSetOption");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00D8, ImportType::Function, "NetDll_XHttpDoWork");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00D9, ImportType::Function, "NetDll_XHttpSetCredentials");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00DA, ImportType::Function, "NetDll_XHttpQueryAuthSchemes");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00DB, ImportType::Function, "NetDll_XHttpCrackUrl");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00FB, ImportType::Function, "NetDll_UpnpStartup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00FC, ImportType::Function, "NetDll_UpnpCleanup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00FD, ImportType::Function, "NetDll_UpnpSearchCreate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00FE, ImportType::Function, "NetDll_UpnpSearchGetDevices");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x00FF, ImportType::Function, "NetDll_UpnpDescribeCreate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0100, ImportType::Function, "NetDll_UpnpDescribeGetResults");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0101, ImportType::Function, "NetDll_UpnpActionCalculateWorkBufferSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0102, ImportType::Function, "NetDll_UpnpActionCreate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0103, ImportType::Function, "NetDll_UpnpActionGetResults");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0104, ImportType::Function, "NetDll_UpnpEventCreate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0105, ImportType::Function, "NetDll_UpnpEventGetCurrentState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0106, ImportType::Function, "NetDll_UpnpEventUnsubscribe");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0107, ImportType::Function, "NetDll_UpnpDoWork");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0108, ImportType::Function, "NetDll_UpnpCloseHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x012D, ImportType::Function, "XNetLogonGetLoggedOnUsers");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x012E, ImportType::Function, "XNetLogonGetNatType");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x012F, ImportType::Function, "XNetLogonTaskStart");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0130, ImportType::Function, "XNetLogonTaskClose");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0131, ImportType::Function, "XNetLogonTaskContinue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0132, ImportType::Function, "XNetLogonGetServiceInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0133, ImportType::Function, "XNetLogonGetUserPrivileges");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0134, ImportType::Function, "XNetLogonSetConsoleCertificate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0135, ImportType::Function, "XNetLogonGetMachineID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0136, ImportType::Function, "XNetLogonGetTitleID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0137, ImportType::Function, "XNetLogonGetTitleVersion");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0138, ImportType::Function, "XNetLogonGetServiceNetworkID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0139, ImportType::Function, "XNetLogonGetDnsString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x013A, ImportType::Function, "XNetLogonSetTitleID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x013B, ImportType::Function, "XNetLogonGetExtendedStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x013C, ImportType::Function, "XNetLogonClearTicketCaches");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x013D, ImportType::Function, "XNetLogonInitOverrideInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x013E, ImportType::Function, "XNetLogonGetLastUPnPStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x013F, ImportType::Function, "XNetLogonGetFlowToken");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0140, ImportType::Function, "XNetLogonGetTicketOpt");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0141, ImportType::Function, "XNetLogonSetTicketOpt");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0190, ImportType::Function, "XamInputGetCapabilities");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0191, ImportType::Function, "XamInputGetState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0192, ImportType::Function, "XamInputSetState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0193, ImportType::Function, "XamInputGetKeystroke");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0194, ImportType::Function, "XamInputEnableAutobind");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0195, ImportType::Function, "XamInputRawState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0196, ImportType::Function, "XamEnableSystemAppInput");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0197, ImportType::Function, "XamInputGetDeviceStats");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0198, ImportType::Function, "XamInputGetKeystrokeEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0199, ImportType::Function, "XamInputGetKeystrokeHud");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x019A, ImportType::Function, "XamInputSetLayoutKeyboard");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x019B, ImportType::Function, "XamInputToggleKeyLocks");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x019C, ImportType::Function, "XamInputResetLayoutKeyboard");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x019D, ImportType::Function, "XamInputGetKeystrokeHudEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x019E, ImportType::Function, "XamInputSetKeyboardTranslationHud");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x019F, ImportType::Function, "XamSetInactivityTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01A0, ImportType::Function, "XamEnableInactivityProcessing");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01A1, ImportType::Function, "XamResetInactivity");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01A2, ImportType::Function, "XamSetInactivityTimeFromConfig");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01A3, ImportType::Function, "XamLoaderGetMediaInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01A4, ImportType::Function, "XamLoaderLaunchTitle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01A5, ImportType::Function, "XamLoaderLaunchTitleEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01A6, ImportType::Function, "XamLoaderSetLaunchData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01A7, ImportType::Function, "XamLoaderGetLaunchDataSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01A8, ImportType::Function, "XamLoaderGetLaunchData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01A9, ImportType::Function, "XamLoaderTerminateTitle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01AA, ImportType::Function, "XamLoaderGetDvdTrayState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01AB, ImportType::Function, "XamLoaderGetGameInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01AC, ImportType::Function, "XamLoaderLaunchTitleOnDvd");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01AD, ImportType::Function, "XamLoaderSetSpindleSpeed");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01AE, ImportType::Function, "XamTaskCreateQueue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01AF, ImportType::Function, "XamTaskSchedule");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01B0, ImportType::Function, "XamTaskReschedule");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01B1, ImportType::Function, "XamTaskCloseHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01B2, ImportType::Function, "XamTaskCancel");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01B3, ImportType::Function, "XamTaskShouldExit");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01B4, ImportType::Function, "XamTaskWaitOnCompletion");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01B5, ImportType::Function, "XamTaskModify");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01B6, ImportType::Function, "XamTaskGetCurrentTask");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01B7, ImportType::Function, "XamTaskGetAttributes");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01B8, ImportType::Function, "XamExecutingOnBehalfOfTitle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01B9, ImportType::Function, "XamInputSendStayAliveRequest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01BA, ImportType::Function, "XamInputGetUserVibrationLevel");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01BB, ImportType::Function, "XamIsSystemTitleId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01BC, ImportType::Function, "XamLoaderIsTitleTerminatePending");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01BD, ImportType::Function, "XamInputSetTextMessengerIndicator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01BE, ImportType::Function, "XamLoaderGetPriorTitleId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01BF, ImportType::Function, "XamIsXbox1TitleId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01C0, ImportType::Function, "XamInputSetKeyLocks");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01C1, ImportType::Function, "XamInputGetKeyLocks");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01C2, ImportType::Function, "XamTaskGetStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01C3, ImportType::Function, "XamGetRootObj");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01C4, ImportType::Function, "XamDevAuthSetFault");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01C5, ImportType::Function, "XamGetDefaultSystemImage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01C6, ImportType::Function, "XamGetWCNConfigFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01C7, ImportType::Function, "XamSetPowerMode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01C8, ImportType::Function, "XamExecuteChallenge");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01C9, ImportType::Function, "XamGetDefaultImage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01CA, ImportType::Function, "XamMuteSound");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01CB, ImportType::Function, "XamGetOnlineSchema");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01CC, ImportType::Function, "XamSetDashContext");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01CD, ImportType::Function, "XamGetDashContext");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01CE, ImportType::Function, "XamIsCurrentTitleDash");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01CF, ImportType::Function, "XamGetCurrentTitleId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01D0, ImportType::Function, "XamSetCurrentTitleDash");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01D1, ImportType::Function, "XamAllocHeapFreeSpace");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01D2, ImportType::Function, "XamSetDashContextEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01D3, ImportType::Function, "XamGetDashContextEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01D4, ImportType::Function, "XamSetHudContext");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01D5, ImportType::Function, "XamGetHudContext");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01D6, ImportType::Function, "XCustomGetBannerImage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01D7, ImportType::Function, "Refresh");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01D8, ImportType::Function, "XCustomSetAction");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01D9, ImportType::Function, "XCustomGetLastActionPress");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01DA, ImportType::Function, "XCustomSetDynamicActions");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01DB, ImportType::Function, "XCustomBroadcastActionEvent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01DC, ImportType::Function, "XCustomGetLastActionPressEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01DD, ImportType::Function, "XCustomRegisterDynamicActions");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01DE, ImportType::Function, "XCustomUnregisterDynamicActions");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01DF, ImportType::Function, "XCustomGetCurrentGamercard");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01E0, ImportType::Function, "XamDbgPrint");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01E1, ImportType::Function, "XamDbgSetOutputLevel");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01E2, ImportType::Function, "XamDbgSetBreakLevel");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01E3, ImportType::Function, "XamLoaderGetMediaInfoEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01E4, ImportType::Function, "XamLoaderSetGameInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01E5, ImportType::Function, "XamFormatMessage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01E6, ImportType::Function, "XamUniSortCmpString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01E7, ImportType::Function, "XamFormatTimeString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01E8, ImportType::Function, "XamFormatDateString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01E9, ImportType::Function, "XamGetLocaleDateFormat");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01EA, ImportType::Function, "XamAlloc");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01EB, ImportType::Function, "XamAllocEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01EC, ImportType::Function, "XamFree");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01ED, ImportType::Function, "XamAllocSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01EE, ImportType::Function, "XamAllocMountIPTVHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01EF, ImportType::Function, "XamAllocUnmountIPTVHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01F0, ImportType::Function, "XamAllocFreeIPTVHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01F1, ImportType::Function, "XamDeviceRemap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01F2, ImportType::Function, "XamLoaderGetClearCache");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01F3, ImportType::Function, "XamLoaderSetClearCache");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01F4, ImportType::Function, "XMsgInProcessCall");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01F5, ImportType::Function, "XMsgCompleteIORequest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01F6, ImportType::Function, "XMsgSystemProcessCall");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01F7, ImportType::Function, "XMsgStartIORequest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01F8, ImportType::Function, "XMsgCancelIORequest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01F9, ImportType::Function, "XMsgAcquireAsyncMessageFromOverlapped");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01FA, ImportType::Function, "XMsgReleaseAsyncMessageToOverlapped");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01FB, ImportType::Function, "XamGetOverlappedResult");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01FC, ImportType::Function, "XMsgStartIORequestEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01FD, ImportType::Function, "XamAppAllocateInterappWorkspace");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01FE, ImportType::Function, "XamAppGetInterappWorkspace");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x01FF, ImportType::Function, "XamAppFreeInterappWorkspace");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0200, ImportType::Function, "XamFeatureEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0201, ImportType::Function, "XamFeatureEnforceImageBudget");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0202, ImportType::Function, "XamFeatureSetMask");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0203, ImportType::Function, "XamFeatureEnableDisable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0204, ImportType::Function, "XuiControlSetItemAssociation");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0205, ImportType::Function, "XamGetTitleGlobalStorageValue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0206, ImportType::Function, "XamSetTitleGlobalStorageValue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0207, ImportType::Function, "XamUserValidateAvatarManifest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0208, ImportType::Function, "XamUserGetDeviceContext");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0209, ImportType::Function, "XamUserLookupDevice");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x020A, ImportType::Function, "XamUserGetXUID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x020B, ImportType::Function, "XamUserLogon");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x020C, ImportType::Function, "XamUserGetGamerTag");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x020D, ImportType::Function, "XamUserGetUserIndexMask");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x020E, ImportType::Function, "XamUserGetName");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x020F, ImportType::Function, "XamLookupCommonStringByIndex");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0210, ImportType::Function, "XamUserGetSigninState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0211, ImportType::Function, "XamUserGetIndexFromXUID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0212, ImportType::Function, "XamUserCheckPrivilege");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0213, ImportType::Function, "XamUserAreUsersFriends");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0214, ImportType::Function, "XamSetUserPresetPresenceState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0215, ImportType::Function, "XamGetUserPresetPresenceState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0216, ImportType::Function, "XamUserGetUserFlagsFromXUID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0217, ImportType::Function, "XamUserGetMembershipTierFromXUID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0218, ImportType::Function, "XamUserGetOnlineCountryFromXUID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0219, ImportType::Function, "XamUserReadProfileSettings");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x021A, ImportType::Function, "XamUserWriteProfileSettings");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x021B, ImportType::Function, "XamUserGetMembershipTier");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x021C, ImportType::Function, "XamUserGetUserFlags");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x021D, ImportType::Function, "XamUserGetRequestedUserIndexMask");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x021E, ImportType::Function, "XamUserIsGuest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x021F, ImportType::Function, "XamUserProfileSync");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0220, ImportType::Function, "XamUserFlushLogonQueue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0221, ImportType::Function, "XamUserIsOnlineEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0222, ImportType::Function, "XamUserGetCachedUserFlags");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0223, ImportType::Function, "XamAreMixedAccountsSignedIn");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0224, ImportType::Function, "XamUserLogonEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0225, ImportType::Function, "XamSetUserShowMessengerFriends");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0226, ImportType::Function, "XamGetUserShowMessengerFriends");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0227, ImportType::Function, "XamUserGetSigninInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0228, ImportType::Function, "XamUserIsPartial");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0229, ImportType::Function, "XamUserGetOnlineLanguageFromXUID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x022A, ImportType::Function, "XamUserReadProfileSettingsEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x022B, ImportType::Function, "XamSystemUpdaterLogon");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x022C, ImportType::Function, "XamUserGetUsersMissingAvatars");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x022D, ImportType::Function, "XamIsChildAccountSignedIn");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x022E, ImportType::Function, "XamUserPrefetchProfileSettings");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x022F, ImportType::Function, "XamUserInvalidateProfileSetting");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0230, ImportType::Function, "XamProfileCreate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0231, ImportType::Function, "XamProfileCreateEnumerator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0232, ImportType::Function, "XamProfileEnumerate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0233, ImportType::Function, "XamProfileDelete");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0234, ImportType::Function, "XamProfileGetCreationStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0235, ImportType::Function, "XamProfileFindAccount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0236, ImportType::Function, "XamProfileRenameAccount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0237, ImportType::Function, "XamProfileOpen");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0238, ImportType::Function, "XamProfileClose");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0239, ImportType::Function, "XamProfileSaveAccountInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x023A, ImportType::Function, "XamProfileLoadAccountInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x023B, ImportType::Function, "XamProfileRecoverTitle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x023C, ImportType::Function, "XamProfileSaveWindowsLiveCredentials");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x023D, ImportType::Function, "XamProfileLoadWindowsLiveCredentials");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x023E, ImportType::Function, "XamProfileIsSaveWindowsLiveCredsEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x023F, ImportType::Function, "XamProfileSetSaveWindowsLiveCredsEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0240, ImportType::Function, "XamSetProfileReadTestHook");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0241, ImportType::Function, "XamProfileGetLastSync");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0242, ImportType::Function, "XamAccountRecoveryRecoverTitle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0243, ImportType::Function, "XamProfileControlPec");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0244, ImportType::Function, "XamAppLoad");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0245, ImportType::Function, "XamAppUnloadSelf");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0246, ImportType::Function, "XamAppUnloadStack");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0247, ImportType::Function, "XamSendMessageToLoadedApps");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0248, ImportType::Function, "XamAppRequestLoad");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0249, ImportType::Function, "XamAppUnrequestLoad");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x024A, ImportType::Function, "XamNavigate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x024B, ImportType::Function, "XamRegisterSysApp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x024C, ImportType::Function, "XamUnregisterSysApp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x024D, ImportType::Function, "XamAppReinitialize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x024E, ImportType::Function, "XamCreateEnumeratorHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x024F, ImportType::Function, "XamGetPrivateEnumStructureFromHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0250, ImportType::Function, "XamEnumerate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0251, ImportType::Function, "XamLoadSysApp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0252, ImportType::Function, "XamUnloadSysApp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0253, ImportType::Function, "XamReloadSysApp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0254, ImportType::Function, "XamAppLoadPass2SysApps");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0255, ImportType::Function, "XamProfileGetLiveLegalLocale");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0256, ImportType::Function, "XamUserIsParentalControlled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0257, ImportType::Function, "XamContentLaunchImageFromFileInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0258, ImportType::Function, "XamContentCreate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0259, ImportType::Function, "XamContentCreateEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x025A, ImportType::Function, "XamContentClose");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x025B, ImportType::Function, "XamContentDelete");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x025C, ImportType::Function, "XamContentCreateEnumerator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x025D, ImportType::Function, "XamContentCreateDeviceEnumerator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x025E, ImportType::Function, "XamContentGetDeviceData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x025F, ImportType::Function, "XamContentGetDeviceName");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0260, ImportType::Function, "XamContentSetThumbnail");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0261, ImportType::Function, "XamContentGetThumbnail");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0262, ImportType::Function, "XamContentGetCreator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0263, ImportType::Function, "XamContentLaunchImage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0264, ImportType::Function, "XamContentGetAttributes");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0265, ImportType::Function, "XamContentGetDeviceState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0266, ImportType::Function, "XamContentGetLicenseMask");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0267, ImportType::Function, "XamContentFlush");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0268, ImportType::Function, "XamContentResolve");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0269, ImportType::Function, "XamContentOpenFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x026A, ImportType::Function, "XamContentInstall");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x026B, ImportType::Function, "XamContentLockUnlockPackageHeaders");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x026C, ImportType::Function, "XamContentCopyInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x026D, ImportType::Function, "XamContentMoveInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x026E, ImportType::Function, "XamContentGetMetaDataInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x026F, ImportType::Function, "XamContentCreateEnumeratorInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0270, ImportType::Function, "XamContentDeleteInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0271, ImportType::Function, "XamContentCreateInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0272, ImportType::Function, "XamContentSetThumbnailInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0273, ImportType::Function, "XamContentLaunchImageInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0274, ImportType::Function, "XamContentWritePackageHeader");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0275, ImportType::Function, "XamContentDismountAndClosePackage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0276, ImportType::Function, "XamContentResolveInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0277, ImportType::Function, "XamContentGetAttributesInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0278, ImportType::Function, "XamContentOpenFileInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0279, ImportType::Function, "XamContentAggregateCreateEnumerator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x027A, ImportType::Function, "XamContentCreateAndMountPackage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x027B, ImportType::Function, "XamContentOpenPackageFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x027C, ImportType::Function, "XamContentMountPackage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x027D, ImportType::Function, "XamContentFlushPackage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x027E, ImportType::Function, "XamContentClosePackageFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x027F, ImportType::Function, "XamContentDuplicateFileHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0280, ImportType::Function, "XamGetExecutionId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0281, ImportType::Function, "XamGetGameRatings");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0282, ImportType::Function, "XamGetSystemVersion");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0283, ImportType::Function, "XamContentGetLocalizedString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0284, ImportType::Function, "XamContentGetDefaultDevice");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0285, ImportType::Function, "XamContentInstallInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0286, ImportType::Function, "XamContentSetMediaMetaDataInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0287, ImportType::Function, "XamContentGetDeviceSerialNumber");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0288, ImportType::Function, "XamContentGetMountedPackageByRootName");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0289, ImportType::Function, "XamContentRegisterChangeCallback");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x028A, ImportType::Function, "XamNotifyCreateListener");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x028B, ImportType::Function, "XNotifyGetNext");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x028C, ImportType::Function, "XNotifyPositionUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x028D, ImportType::Function, "XNotifyDelayUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x028E, ImportType::Function, "XNotifyBroadcast");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x028F, ImportType::Function, "XNotifyRegisterArea");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0290, ImportType::Function, "XNotifyQueueUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0291, ImportType::Function, "XamNotifyCreateListenerInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0292, ImportType::Function, "XNotifyUISetOptions");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0293, ImportType::Function, "XNotifyUIGetOptions");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0294, ImportType::Function, "XamContentLaunchImageInternalEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0295, ImportType::Function, "XamShutdown");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0296, ImportType::Function, "XamAllocDevkitHeapAvailable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0297, ImportType::Function, "XamNotifyCreateListenerRangeInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0298, ImportType::Function, "XNotifyQueueUIEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0299, ImportType::Function, "XamAppRequestLoadEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x029A, ImportType::Function, "XuiPNGTextureLoader");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x029B, ImportType::Function, "XuiRenderGetXuiDevice");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x029C, ImportType::Function, "XuiDefault_False");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x029D, ImportType::Function, "XamUserGetReportingInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x029E, ImportType::Function, "XamUpdateStart");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x029F, ImportType::Function, "XamUpdateGetProgress");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02A0, ImportType::Function, "XamUpdateGetExtenderInstance");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02A1, ImportType::Function, "XamUpdateFinish");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02A2, ImportType::Function, "XamUpdateAttachExtenderInstance");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02A3, ImportType::Function, "XamUpdateAllocateExtenderBuffer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02A4, ImportType::Function, "XamRestartTitleLoadAfterUpdate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02A5, ImportType::Function, "XamUIThreadDisableFontPatching");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02A6, ImportType::Function, "XamUpdateGetBaseSystemVersion");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02A7, ImportType::Function, "XamUpdateGetCurrentSystemVersion");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02A8, ImportType::Function, "XamUIThreadEnableFontPatching");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02A9, ImportType::Function, "XamTerminateTitleForUpdate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02AA, ImportType::Function, "XamSystemUpdateInstallLocal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02AB, ImportType::Function, "XamUpdateChainPass3FromPass2");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02AD, ImportType::Function, "XamInputGetCapabilitiesEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02AE, ImportType::Function, "XamUserIsUnsafeProgrammingAllowed");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02AF, ImportType::Function, "XamDevAuthSetFaultEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02B0, ImportType::Function, "XamUpdateGetData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02B1, ImportType::Function, "XamCacheIntegrityCheck");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02B2, ImportType::Function, "XamCacheStoreFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02B3, ImportType::Function, "XamCacheFetchFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02B4, ImportType::Function, "XamCacheOpenFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02B5, ImportType::Function, "XamCacheCloseFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02B6, ImportType::Function, "XamGetCachedTitleName");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02B7, ImportType::Function, "XamCacheReset");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02B8, ImportType::Function, "XamGetCachedGamerTag");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02B9, ImportType::Function, "XamGetCachedGamerTagW");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02BA, ImportType::Function, "XamCacheDeleteFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02BB, ImportType::Function, "XamCacheRenameFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02BC, ImportType::Function, "XamShowSigninUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02BD, ImportType::Function, "XamShowSigninUIEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02BE, ImportType::Function, "XamShowSigninUIp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02BF, ImportType::Function, "XamShowFriendsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02C0, ImportType::Function, "XamShowMessagesUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02C1, ImportType::Function, "XamShowKeyboardUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02C2, ImportType::Function, "XamShowQuickChatUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02C3, ImportType::Function, "XamShowVoiceMailUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02C4, ImportType::Function, "XamShowGamerCardUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02C5, ImportType::Function, "XamShowAchievementsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02C6, ImportType::Function, "XamShowPlayerReviewUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02C7, ImportType::Function, "XamShowMarketplaceUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02C8, ImportType::Function, "XamShowPlayersUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02C9, ImportType::Function, "XamShowUpdaterUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02CA, ImportType::Function, "XamShowMessageBoxUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02CB, ImportType::Function, "XamShowDeviceSelectorUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02CC, ImportType::Function, "XamShowMessageComposeUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02CD, ImportType::Function, "XamShowGameInviteUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02CE, ImportType::Function, "XamShowFriendRequestUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02CF, ImportType::Function, "XamShowCreateProfileUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02D0, ImportType::Function, "XamShowGamesUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02D1, ImportType::Function, "XamShowLiveSignupUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02D2, ImportType::Function, "XamShowFriendsUIp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02D3, ImportType::Function, "XamShowComplaintUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02D4, ImportType::Function, "XamShowReputationUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02D5, ImportType::Function, "XamShowGamerCardUIForXUID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02D6, ImportType::Function, "XamShowForcedNameChangeUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02D7, ImportType::Function, "XamShowLiveUpsellUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02D8, ImportType::Function, "XamShowPasscodeVerifyUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02D9, ImportType::Function, "XamShowDirtyDiscErrorUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02DA, ImportType::Function, "XamShowSignupCreditCardUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02DB, ImportType::Function, "XamShowPrivateChatInviteUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02DC, ImportType::Function, "XamShowMessageBoxUIEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02DD, ImportType::Function, "XamShowRecentMessageUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02DE, ImportType::Function, "XamShowRecentMessageUIEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02DF, ImportType::Function, "XamShowMessagesUIEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02E0, ImportType::Function, "XamShowAchievementDetailsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02E1, ImportType::Function, "XamShowPersonalizationUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02E2, ImportType::Function, "XamShowChangeGamerTileUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02E3, ImportType::Function, "XamShowVoiceSettingsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02E4, ImportType::Function, "XamShowVideoChatInviteUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02E5, ImportType::Function, "XamShowCustomMessageComposeUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02E6, ImportType::Function, "XamShowCustomPlayerListUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02E7, ImportType::Function, "XamShowMarketplaceDownloadItemsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02E8, ImportType::Function, "XamShowMarketplaceUIEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02E9, ImportType::Function, "XamShowMessageBox");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02EA, ImportType::Function, "XamIsSysUiInvokedByXenonButton");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02EB, ImportType::Function, "XamIsSysUiInvokedByTitle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02EC, ImportType::Function, "XamIsUIActive");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02ED, ImportType::Function, "XamSysUiDisableAutoClose");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02EE, ImportType::Function, "XamUserCreateAchievementEnumerator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02EF, ImportType::Function, "XamReadTile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02F0, ImportType::Function, "XamWriteGamerTile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02F1, ImportType::Function, "XamWriteTile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02F2, ImportType::Function, "XamReadImage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02F3, ImportType::Function, "XamUserCreateTitlesPlayedEnumerator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02F4, ImportType::Function, "XamDecompressPNGToTexture");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02F5, ImportType::Function, "XamReadTileToTexture");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02F6, ImportType::Function, "XamReadString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02F7, ImportType::Function, "XamUserCreateStatsEnumerator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02F8, ImportType::Function, "XamPrepareGamerTiles");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02F9, ImportType::Function, "XamClearTitle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02FA, ImportType::Function, "XamReadStrings");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02FB, ImportType::Function, "XamWriteGamerTileEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02FC, ImportType::Function, "XamReadTileEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02FD, ImportType::Function, "XamReadTileToTextureEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02FE, ImportType::Function, "XamShowMessengerUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x02FF, ImportType::Function, "XamShowKeyboardUIMessenger");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0300, ImportType::Function, "XamShowLiveUpsellUIEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0301, ImportType::Function, "XamShowJoinSessionInProgressUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0302, ImportType::Function, "XamShowGraduateUserUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0303, ImportType::Function, "XamShowGamerCardUIForXUIDp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0304, ImportType::Function, "XamShowGuideUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0305, ImportType::Function, "XamShowPartyUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0306, ImportType::Function, "XamShowPartyInviteUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0307, ImportType::Function, "XamUserAddRecentPlayer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0308, ImportType::Function, "XamUserUpdateRecentPlayer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0309, ImportType::Function, "XamUserCreatePlayerEnumerator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x030A, ImportType::Function, "XamParseGamerTileKey");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x030B, ImportType::Function, "XamShowCommunitySessionsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x030C, ImportType::Function, "XamVoiceCreate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x030D, ImportType::Function, "XamVoiceHeadsetPresent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x030E, ImportType::Function, "XamVoiceSubmitPacket");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x030F, ImportType::Function, "XamVoiceClose");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0310, ImportType::Function, "XamVoiceGetBatteryStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0311, ImportType::Function, "Refresh");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0312, ImportType::Function, "Refresh");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0313, ImportType::Function, "XamShowJoinSessionByIdInProgressUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0314, ImportType::Function, "XamShowPartyJoinInProgressUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0315, ImportType::Function, "XamBuildSharedSystemResourceLocator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0316, ImportType::Function, "XamSessionCreateHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0317, ImportType::Function, "XamSessionRefObjByHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0318, ImportType::Function, "XamVoiceGetMicArrayStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0319, ImportType::Function, "XamVoiceSetAudioCaptureRoutine");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x031A, ImportType::Function, "XamVoiceGetDirectionalData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x031B, ImportType::Function, "XamBuildResourceLocator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x031C, ImportType::Function, "XamBuildLegacySystemResourceLocator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x031D, ImportType::Function, "XamBuildGamercardResourceLocator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x031E, ImportType::Function, "XamBuildDynamicResourceLocator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x031F, ImportType::Function, "XamBuildXamResourceLocator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0320, ImportType::Function, "XuiAnimRun");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0321, ImportType::Function, "XuiApplyLocale");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0322, ImportType::Function, "XuiBubbleMessage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0323, ImportType::Function, "XuiControlIsBackButton");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0324, ImportType::Function, "XuiControlIsNavButton");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0325, ImportType::Function, "XuiCreateObject");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0326, ImportType::Function, "XuiDestroyObject");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0327, ImportType::Function, "XuiDynamicCast");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0328, ImportType::Function, "XuiElementAddChild");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0329, ImportType::Function, "XuiElementFindNamedFrame");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x032A, ImportType::Function, "XuiElementGetChildById");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x032B, ImportType::Function, "XuiElementGetFirstChild");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x032C, ImportType::Function, "XuiElementGetFocus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x032D, ImportType::Function, "XuiElementGetFocusUser");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x032E, ImportType::Function, "XuiElementGetId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x032F, ImportType::Function, "XuiElementGetLastChild");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0330, ImportType::Function, "XuiElementGetNext");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0331, ImportType::Function, "XuiElementGetParent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0332, ImportType::Function, "XuiElementGetUserFocus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0333, ImportType::Function, "XuiElementInitFocus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0334, ImportType::Function, "XuiElementInitUserFocus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0335, ImportType::Function, "XuiElementPlayTimeline");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0336, ImportType::Function, "XuiElementSetBounds");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0337, ImportType::Function, "XuiElementSetFocus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0338, ImportType::Function, "XuiElementSetUserFocus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0339, ImportType::Function, "XuiElementTreeGetFocus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x033A, ImportType::Function, "XuiFindClass");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x033B, ImportType::Function, "XuiFreeStringTable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x033C, ImportType::Function, "XuiGetBaseObject");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x033D, ImportType::Function, "XuiGetClass");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x033E, ImportType::Function, "XuiGetObjectClass");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x033F, ImportType::Function, "XuiGetOuter");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0340, ImportType::Function, "XuiInit");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0341, ImportType::Function, "XuiLoadFromBinary");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0342, ImportType::Function, "XuiLoadStringTableFromFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0343, ImportType::Function, "XuiVisualGetBasePath");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0344, ImportType::Function, "XuiLookupStringTable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0345, ImportType::Function, "XuiNavButtonGetPressPath");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0346, ImportType::Function, "XuiObjectFromHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0347, ImportType::Function, "XuiObjectGetProperty");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0348, ImportType::Function, "XuiObjectGetPropertyId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0349, ImportType::Function, "XuiProcessInput");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x034A, ImportType::Function, "XuiRegisterClass");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x034B, ImportType::Function, "XuiRenderBegin");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x034C, ImportType::Function, "XuiRenderCreateDC");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x034D, ImportType::Function, "XuiRenderDCDeviceChanged");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x034E, ImportType::Function, "XuiRenderDestroyDC");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x034F, ImportType::Function, "XuiRenderEnd");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0350, ImportType::Function, "XuiRenderGetBackBufferSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0351, ImportType::Function, "XuiRenderInit");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0352, ImportType::Function, "XuiRenderInitShared");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0353, ImportType::Function, "XuiRenderPresent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0354, ImportType::Function, "XuiRenderSetViewTransform");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0355, ImportType::Function, "XuiRenderUninit");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0356, ImportType::Function, "XamShowNuiGuideUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0357, ImportType::Function, "XuiSceneCreate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0358, ImportType::Function, "XuiSceneNavigateBack");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0359, ImportType::Function, "XuiSceneNavigateFirst");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x035A, ImportType::Function, "XuiSceneNavigateForward");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x035B, ImportType::Function, "XuiScenePlayBackFromTransition");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x035C, ImportType::Function, "XuiScenePlayBackToTransition");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x035D, ImportType::Function, "XuiScenePlayFromTransition");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x035E, ImportType::Function, "XuiScenePlayToTransition");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x035F, ImportType::Function, "XuiSendMessage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0360, ImportType::Function, "XuiSetLocale");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0361, ImportType::Function, "XuiUninit");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0362, ImportType::Function, "XuiUnregisterClass");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0363, ImportType::Function, "XuiTextElementSetText");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0364, ImportType::Function, "XuiSetTimer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0365, ImportType::Function, "XuiTimersRun");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0366, ImportType::Function, "XuiTextElementGetText");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0367, ImportType::Function, "XuiVisualSetBasePath");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0368, ImportType::Function, "XuiHandleIsValid");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0369, ImportType::Function, "XuiAlloc");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x036A, ImportType::Function, "XuiFree");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x036B, ImportType::Function, "XuiDefault_True");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x036C, ImportType::Function, "XuiDefault_EmptyString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x036D, ImportType::Function, "XuiDefault_IntegerZero");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x036E, ImportType::Function, "XuiCopyString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x036F, ImportType::Function, "XuiRealloc");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0370, ImportType::Function, "XuiControlPlayOptionalVisual");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0371, ImportType::Function, "XuiKillTimer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0372, ImportType::Function, "XuiElementEnableInput");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0373, ImportType::Function, "XuiElementInputEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0374, ImportType::Function, "XuiIsInstanceOf");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0375, ImportType::Function, "XuiResourceComposeLocator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0376, ImportType::Function, "XuiResourceLocatorIsAbsolute");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0377, ImportType::Function, "XuiBroadcastMessage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0378, ImportType::Function, "XuiElementDisallowRecursiveTimelineControl");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0379, ImportType::Function, "XUIElementPropVal_Construct");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x037A, ImportType::Function, "XUIElementPropVal_Destruct");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x037B, ImportType::Function, "XUIElementPropVal_SetString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x037C, ImportType::Function, "XuiObjectSetProperty");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x037D, ImportType::Function, "XuiElementGetOpacity");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x037E, ImportType::Function, "XuiElementSetOpacity");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x037F, ImportType::Function, "XuiEditSetTextLimit");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0380, ImportType::Function, "XuiEditGetTextLimit");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0381, ImportType::Function, "XuiSliderSetValue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0382, ImportType::Function, "XuiSliderGetValue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0383, ImportType::Function, "XuiSliderSetRange");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0384, ImportType::Function, "XuiElementUnlink");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0385, ImportType::Function, "XuiElementInsertChild");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0386, ImportType::Function, "XuiSceneNavigateBackToFirst");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0387, ImportType::Function, "XuiProgressBarSetRange");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0388, ImportType::Function, "XuiProgressBarSetValue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0389, ImportType::Function, "XuiProgressBarGetValue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x038A, ImportType::Function, "XuiControlAttachVisual");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x038B, ImportType::Function, "XuiCreateTextureBrush");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x038C, ImportType::Function, "XuiDestroyBrush");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x038D, ImportType::Function, "XUIElementPropVal_SetColorFromUint");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x038E, ImportType::Function, "XuiFigureSetFill");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x038F, ImportType::Function, "XuiSliderGetRange");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0390, ImportType::Function, "XuiFigureSetTexture");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0391, ImportType::Function, "XuiControlGetItemAssociation");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0392, ImportType::Function, "XuiResourceLoadAll");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0393, ImportType::Function, "XuiImageElementSetImagePath");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0394, ImportType::Function, "XuiImageElementGetImagePath");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0395, ImportType::Function, "XuiControlGetVisual");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0396, ImportType::Function, "XuiControlGetNavigation");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0397, ImportType::Function, "XuiLookupStringTableByIndex");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0398, ImportType::Function, "XUIElementPropVal_SetBool");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0399, ImportType::Function, "XuiElementHasFocus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x039A, ImportType::Function, "XUIElementPropVal_SetUint");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x039B, ImportType::Function, "XUIElementPropVal_Clear");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x039C, ImportType::Function, "XuiEditSetTextFormatInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x039D, ImportType::Function, "XuiCreateSolidBrush");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x039E, ImportType::Function, "XuiSceneInterruptTransitions");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x039F, ImportType::Function, "XuiResourceOpen");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03A0, ImportType::Function, "XuiResourceRead");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03A1, ImportType::Function, "XuiResourceClose");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03A2, ImportType::Function, "XuiVisualCreateInstance");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03A3, ImportType::Function, "XuiElementGetTimeline");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03A4, ImportType::Function, "GetCodecVersion");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03A5, ImportType::Function, "XuiElementIsDescendant");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03A6, ImportType::Function, "XuiSetMessageFilter");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03A7, ImportType::Function, "XuiAttachTextureBrush");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03A8, ImportType::Function, "XuiElementBeginRender");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03A9, ImportType::Function, "XuiElementEndRender");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03AA, ImportType::Function, "XuiDrawShape");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03AB, ImportType::Function, "XuiSelectBrushEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03AC, ImportType::Function, "XuiFigureGetShape");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03AD, ImportType::Function, "XuiFillRect");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03AE, ImportType::Function, "XuiVec2TransformCoord");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03AF, ImportType::Function, "XuiMatrixMultiply");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03B0, ImportType::Function, "XuiElementGetXForm");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03B1, ImportType::Function, "XuiElementSetPosition");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03B2, ImportType::Function, "XuiSelectBrush");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03B3, ImportType::Function, "XuiElementRenderChildren");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03B4, ImportType::Function, "XuiFreeUnusedTextures");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03B5, ImportType::Function, "XuiListEnableItemOverride");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03B6, ImportType::Function, "XuiListGetDefaultItemSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03B7, ImportType::Function, "XuiResourceSeek");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03B8, ImportType::Function, "XuiElementDiscardResources");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03B9, ImportType::Function, "XuiTabSceneGoto");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03BA, ImportType::Function, "XuiTabSceneGetCurrentTab");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03BB, ImportType::Function, "XamShowWhatsOnUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03BC, ImportType::Function, "XamShowEditProfileUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03BD, ImportType::Function, "XamShowStorePickerUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03BE, ImportType::Function, "XamShowTermsOfUseUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03BF, ImportType::Function, "XamShowJoinPartyUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03C0, ImportType::Function, "XamShowWordRegisterUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03C1, ImportType::Function, "XamOverrideHudOpenType");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03C2, ImportType::Function, "XamShowAchievementsUIEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03C3, ImportType::Function, "XamUserGetUserTenure");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03C4, ImportType::Function, "XamUserGetSubscriptionType");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03C5, ImportType::Function, "XamShowGameVoiceChannelUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03C6, ImportType::Function, "XamShowAvatarAwardsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03C7, ImportType::Function, "XamShowAvatarAwardGamesUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03C8, ImportType::Function, "XamShowVideoRichPresenceUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03C9, ImportType::Function, "XamHudGetUserIndex");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03CA, ImportType::Function, "XGetAudioFlags");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03CB, ImportType::Function, "XGetAVPack");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03CC, ImportType::Function, "XGetGameRegion");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03CD, ImportType::Function, "XGetLanguage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03CE, ImportType::Function, "XapipGetLocale");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03CF, ImportType::Function, "XGetVideoFlags");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03D0, ImportType::Function, "XGetVideoStandard");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03D1, ImportType::Function, "XGetVideoMode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03D2, ImportType::Function, "XamGetLanguage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03D3, ImportType::Function, "XUITimeline_Run");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03D4, ImportType::Function, "XamSetAutomation");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03D5, ImportType::Function, "XAutomationpBindController");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03D6, ImportType::Function, "XAutomationpUnbindController");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03D7, ImportType::Function, "XAutomationpInputXenonButton");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03D8, ImportType::Function, "XAutomationpInputPress");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03D9, ImportType::Function, "XAutomationpInputSetState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03DA, ImportType::Function, "XamEnableOverdraw");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03DB, ImportType::Variable, "g_XuiAutomation");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03DC, ImportType::Function, "XamVoiceGetMicArrayAudio");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03DD, ImportType::Function, "XampSystemInput");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03DE, ImportType::Function, "XamInputControl");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03DF, ImportType::Function, "XuiElementGetPosition");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03E0, ImportType::Function, "XamIsMessageBoxActive");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03E1, ImportType::Function, "XamIsBackgroundSceneInTransition");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03E2, ImportType::Function, "XuiElementTreeHasFocus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03E3, ImportType::Function, "XuiFigureClose");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03E4, ImportType::Function, "GamerCardStartup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03E5, ImportType::Function, "GamerCardCleanup");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03E6, ImportType::Function, "GamerCardRegisterControls");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03E7, ImportType::Function, "GamerCardUnregisterControls");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03E8, ImportType::Function, "RtlFindFirstFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03E9, ImportType::Function, "RtlFindNextFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03EA, ImportType::Function, "RtlGetModuleFileName");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03EB, ImportType::Function, "RtlOutputDebugString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03EC, ImportType::Function, "RtlRemoveDirectory");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03ED, ImportType::Function, "RtlSleep");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03EE, ImportType::Function, "RtlGetLastError");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03EF, ImportType::Function, "RtlSetLastError");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03F0, ImportType::Function, "RtlSetLastNTError");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03F1, ImportType::Function, "RtlDebugPrint");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03F2, ImportType::Function, "RtlDebugError");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03F3, ImportType::Function, "XDebugWarning");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03F4, ImportType::Function, "RtlDebugTrace");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03F5, ImportType::Function, "RtlDebugEntry");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03F6, ImportType::Function, "RtlDebugExit");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03F7, ImportType::Function, "RtlGetAttributesOnHeapAlloc");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03F8, ImportType::Function, "RtlSetAttributesOnHeapAlloc");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03F9, ImportType::Function, "XuiFigureSetShape");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03FA, ImportType::Function, "RtlCreateHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03FB, ImportType::Function, "RtlDestroyHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03FC, ImportType::Function, "RtlAllocateHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03FD, ImportType::Function, "RtlAllocateHeapSlowly");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03FE, ImportType::Function, "RtlReAllocateHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x03FF, ImportType::Function, "RtlFreeHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0400, ImportType::Function, "RtlFreeHeapSlowly");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0401, ImportType::Function, "RtlSizeHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0402, ImportType::Function, "RtlZeroHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0403, ImportType::Function, "RtlDebugWalkHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0404, ImportType::Function, "RtlWalkHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0405, ImportType::Function, "RtlLockHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0406, ImportType::Function, "RtlUnlockHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0407, ImportType::Function, "RtlValidateHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0408, ImportType::Function, "RtlDebugCompactHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0409, ImportType::Function, "RtlCompactHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x040A, ImportType::Function, "XamAppSetTestOption");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x040B, ImportType::Function, "XamAppReportError");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x040C, ImportType::Function, "XamIsNuiUIActive");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x040D, ImportType::Function, "XamVerifyPasscode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x040E, ImportType::Function, "OutputDebugStringA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x040F, ImportType::Function, "DebugBreak");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0410, ImportType::Function, "GetCurrentThreadId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0411, ImportType::Function, "XDebugError");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0412, ImportType::Function, "XDebugWarning");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0413, ImportType::Function, "RtlDebugSetLevel");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0414, ImportType::Function, "CloseHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0415, ImportType::Function, "GetTickCount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0416, ImportType::Function, "GetLastError");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0417, ImportType::Function, "SetFilePointer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0418, ImportType::Function, "SetFilePointerEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0419, ImportType::Function, "SetLastError");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x041A, ImportType::Function, "MultiByteToWideChar");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x041B, ImportType::Function, "WideCharToMultiByte");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x041C, ImportType::Function, "ReadFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x041D, ImportType::Function, "FlushFileBuffers");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x041E, ImportType::Function, "WriteFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x041F, ImportType::Function, "OutputDebugStringW");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0420, ImportType::Function, "SetEvent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0421, ImportType::Function, "XapiFormatTimeOut");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0422, ImportType::Function, "CreateMutexA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0423, ImportType::Function, "OpenMutexA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0424, ImportType::Function, "ReleaseMutex");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0425, ImportType::Function, "WaitForSingleObject");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0426, ImportType::Function, "WaitForSingleObjectEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0427, ImportType::Function, "GetFileSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0428, ImportType::Function, "GetFileSizeEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0429, ImportType::Function, "XapiDirectoryInformationToFindData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x042A, ImportType::Function, "XapiFormatObjectAttributes");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x042B, ImportType::Function, "ResetEvent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x042C, ImportType::Function, "wsprintfA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x042D, ImportType::Function, "wsprintfW");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x042E, ImportType::Function, "GetOverlappedResult");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x042F, ImportType::Function, "QueryPerformanceCounter");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0430, ImportType::Function, "QueryPerformanceFrequency");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0431, ImportType::Function, "LocalAlloc");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0432, ImportType::Function, "LocalFree");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0433, ImportType::Function, "RaiseException");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0434, ImportType::Function, "RtlUniform");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0435, ImportType::Function, "RtlRandom");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0436, ImportType::Function, "Sleep");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0437, ImportType::Function, "SleepEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0438, ImportType::Function, "XMemSet");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0439, ImportType::Function, "XRegisterThreadNotifyRoutine");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x043A, ImportType::Function, "XGetOverlappedExtendedError");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x043B, ImportType::Function, "XGetOverlappedResult");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x043C, ImportType::Function, "CreateThread");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x043D, ImportType::Function, "ResumeThread");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x043E, ImportType::Function, "ExitThread");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x043F, ImportType::Function, "GetTimeZoneInformation");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0440, ImportType::Function, "GetSystemTimeAsFileTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0441, ImportType::Function, "SystemTimeToFileTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0442, ImportType::Function, "FileTimeToSystemTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0443, ImportType::Function, "GetSystemTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0444, ImportType::Function, "GetLocalTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0445, ImportType::Function, "CreateDirectoryA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0446, ImportType::Function, "CreateEventA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0447, ImportType::Function, "CreateFileA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0448, ImportType::Function, "DeleteFileA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0449, ImportType::Function, "FindFirstFileA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x044A, ImportType::Function, "FindNextFileA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x044B, ImportType::Function, "GetFileAttributesA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x044C, ImportType::Function, "XamLoaderGetCurrentTitleD3DVersion");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x044D, ImportType::Function, "GetFileAttributesExA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x044E, ImportType::Function, "GetModuleHandleA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x044F, ImportType::Function, "GetDiskFreeSpaceExA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0450, ImportType::Function, "CopyFileA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0451, ImportType::Function, "SetEndOfFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0452, ImportType::Function, "XamFamilyAddParentalExemptionToList");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0453, ImportType::Function, "XamFamilyIsParentalValidationRequired");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0454, ImportType::Function, "PIXBeginCapture");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0455, ImportType::Function, "PIXEndCapture");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0456, ImportType::Function, "PIXAddCounter");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0457, ImportType::Function, "PIXGetGPUSlot");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0458, ImportType::Function, "SetWaitableTimer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0459, ImportType::Function, "CancelWaitableTimer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x045A, ImportType::Function, "CreateWaitableTimerA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x045B, ImportType::Function, "DuplicateHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x045C, ImportType::Function, "XapipCreateThread");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x045D, ImportType::Function, "lstrcpyA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x045E, ImportType::Function, "lstrcpyW");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x045F, ImportType::Function, "lstrcpynA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0460, ImportType::Function, "lstrcpynW");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0461, ImportType::Function, "lstrcatA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0462, ImportType::Function, "lstrcatW");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0463, ImportType::Function, "lstrlenA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0464, ImportType::Function, "lstrlenW");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0465, ImportType::Function, "IsBadReadPtr");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0466, ImportType::Function, "IsBadWritePtr");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0467, ImportType::Function, "FileTimeToLocalFileTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0468, ImportType::Function, "XMemCpy");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0469, ImportType::Function, "XMemCpyStreaming");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x046A, ImportType::Function, "XamHudSetUserIndex");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x046B, ImportType::Function, "XamShowNuiTroubleshooterUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x046C, ImportType::Function, "XamTestShowNuiTroubleshooterUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x046D, ImportType::Function, "XamShowPasscodeVerifyUIEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x046E, ImportType::Function, "XamShowNuiAchievementsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x046F, ImportType::Function, "XamShowNuiCommunitySessionsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0470, ImportType::Function, "XamShowNuiDeviceSelectorUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0471, ImportType::Function, "XamShowNuiDirtyDiscErrorUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0472, ImportType::Function, "XamShowNuiFriendsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0473, ImportType::Function, "XamShowNuiGameInviteUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0474, ImportType::Function, "XamShowNuiGamerCardUIForXUID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0475, ImportType::Function, "XamShowNuiMarketplaceDownloadItemsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0476, ImportType::Function, "XamShowNuiMarketplaceUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0477, ImportType::Function, "XamShowNuiMessageBoxUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0478, ImportType::Function, "XamShowNuiPartyUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0479, ImportType::Function, "XamShowNuiFriendRequestUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x047A, ImportType::Function, "XamShowNuiSigninUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x047B, ImportType::Function, "XamShowNuiControllerRequiredUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x047C, ImportType::Function, "XamShowNuiGamesUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x047D, ImportType::Function, "XamShowNuiHardwareRequiredUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x047E, ImportType::Function, "XamCacheStoreFileByString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x047F, ImportType::Function, "XamCacheFetchFileByString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0480, ImportType::Function, "XamCacheDeleteFileByString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0481, ImportType::Function, "XamGetCachedTitleNameEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0482, ImportType::Function, "XamXlfsInitializeUploadQueue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0483, ImportType::Function, "XamXlfsUninitializeUploadQueue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0484, ImportType::Function, "XamXlfsMountUploadQueueInstance");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0485, ImportType::Function, "XamXlfsUnmountUploadQueueInstance");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0486, ImportType::Function, "XamVoiceRecordUserPrivileges");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0487, ImportType::Function, "XamXlfsInitializeUploadQueueWithTestHooks");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0488, ImportType::Function, "XamXlfsNotifyContentDeletion");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0489, ImportType::Function, "XMemAlloc");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x048A, ImportType::Function, "XMemFree");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x048B, ImportType::Function, "XMemSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x048C, ImportType::Function, "XamVoiceSetMicArrayIdleUsers");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x048D, ImportType::Function, "XamVoiceMuteMicArray");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x048E, ImportType::Function, "XamVoiceGetMicArrayUnderrunStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x048F, ImportType::Function, "XuiSceneEnableTransitionDependency");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0490, ImportType::Function, "XamVoiceGetMicArrayAudioEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0491, ImportType::Function, "XamVoiceDisableMicArray");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0497, ImportType::Function, "XamVoiceIsActiveProcess");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x04B0, ImportType::Function, "XMPRegisterCodec");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0514, ImportType::Function, "XamIsCurrentTitleIptv");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0515, ImportType::Function, "XamIsIptvEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0516, ImportType::Function, "XamIsDvrRecording");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0517, ImportType::Function, "XamIptvUninstall");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0518, ImportType::Function, "XamGetDvrStorage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0519, ImportType::Function, "XamSetDvrStorage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x051A, ImportType::Function, "XamIptvGetServiceName");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x051B, ImportType::Function, "XamNuiHudGetEngagedEnrollmentIndex");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0578, ImportType::Function, "XamReminderGetItems");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0579, ImportType::Function, "XamReminderClearItems");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x057A, ImportType::Function, "XamReminderItemAdd");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x057B, ImportType::Function, "XamReminderItemRemove");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x057C, ImportType::Function, "XamReminderGetNextItem");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x057D, ImportType::Function, "XamReminderGetModifiedTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x057E, ImportType::Function, "XamReminderClearCache");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05DC, ImportType::Function, "XamAvatarInitialize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05DD, ImportType::Function, "XamAvatarShutdown");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05DE, ImportType::Function, "XamAvatarGetManifestLocalUser");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05DF, ImportType::Function, "XamAvatarGetManifestsByXuid");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05E0, ImportType::Function, "XamAvatarGetAssetsResultSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05E1, ImportType::Function, "XamAvatarGetAssets");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05E2, ImportType::Function, "XamAvatarGenerateMipMaps");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05E3, ImportType::Function, "XamAvatarSetCustomAsset");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05E4, ImportType::Function, "XamAvatarSetManifest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05E5, ImportType::Function, "EnumerateMediaObjects");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05E6, ImportType::Function, "EnumerateMediaObjects");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05E7, ImportType::Function, "XamAvatarLoadAnimation");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05E8, ImportType::Function, "XamAvatarBeginEnumAssets");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05E9, ImportType::Function, "XamAvatarEndEnumAssets");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05EA, ImportType::Function, "XamAvatarEnumAssets");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05EB, ImportType::Function, "XamAvatarGetMetadataRandom");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05EC, ImportType::Function, "EnumerateMediaObjects");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05ED, ImportType::Function, "EnumerateMediaObjects");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05EE, ImportType::Function, "XamAvatarGetMetadataSignedOutProfileCount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05EF, ImportType::Function, "XamAvatarGetMetadataSignedOutProfile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05F0, ImportType::Function, "EnumerateMediaObjects");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05F1, ImportType::Function, "XamAvatarManifestGetBodyType");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05F2, ImportType::Function, "XamAvatarGetInstrumentation");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05F3, ImportType::Function, "XamAvatarGetAssetIcon");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05F4, ImportType::Function, "XamAvatarWearNow");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05F5, ImportType::Function, "XamAvatarGetAssetBinary");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05F6, ImportType::Function, "XamAvatarReinstallAwardedAsset");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05F7, ImportType::Function, "XamAvatarGetInstalledAssetPackageDescription");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x05F8, ImportType::Function, "XamAvatarSetMocks");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x060E, ImportType::Function, "XamContentMountInstalledGame");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x060F, ImportType::Function, "XamContentIsGameInstalledToHDD");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0610, ImportType::Function, "XamContentQueryLicenseInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0611, ImportType::Function, "XamContentGetDeviceVolumePath");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0612, ImportType::Function, "XamContentDeviceCheckUpdates");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0613, ImportType::Function, "XamContentGetHeaderInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0640, ImportType::Function, "XamPackageManagerFindPackageContainingIndexedXEX");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0641, ImportType::Function, "XamPackageManagerReinitialize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0642, ImportType::Function, "XamPackageManagerGetAuthoritativeManifestVersion");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0643, ImportType::Function, "XamGetCurrentSystemOnlineManifestRevision");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0644, ImportType::Function, "XamPackageManagerDeleteExtendedPartition");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0645, ImportType::Function, "XamPackageManagerHasExtendedPartition");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0646, ImportType::Function, "XamPackageManagerGetExperienceMode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0647, ImportType::Function, "XamPackageManagerGetFeatureRequiresUpdateStrings");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0648, ImportType::Function, "XamPackageManagerGetFileSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0649, ImportType::Function, "XampDemandUpdateGetAttributes");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x064A, ImportType::Function, "XampDemandUpdateGetExtendedAttributes");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x064B, ImportType::Function, "XampDemandUpdateGetInstance");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x064C, ImportType::Function, "XampDemandUpdateSetRefreshTestFlags");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x064D, ImportType::Function, "XampDemandUpdateIsRefreshTestFlagSet");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x064E, ImportType::Function, "XampDemandUpdateGetManifestLocalPath");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x064F, ImportType::Function, "XampDemandUpdateRefreshManifest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0650, ImportType::Function, "XdfInitialize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0651, ImportType::Function, "XdfShutdown");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0652, ImportType::Function, "XdfGetExpectedDownloadSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0653, ImportType::Function, "XdfGetItem");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0654, ImportType::Function, "XdfCacheItem");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0655, ImportType::Function, "XdfLoadXexFromCache");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0656, ImportType::Function, "XdfLoadXex");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0657, ImportType::Function, "XdfCancelRequest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0658, ImportType::Function, "XdfResumeDelayedItem");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0659, ImportType::Function, "XdfLaunchNewImageFromCache");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x065A, ImportType::Function, "XampDemandUpdateRefreshManifestDuringLogon");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x065B, ImportType::Function, "XampDemandUpdateCheckOnlineManifestChanged");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x065C, ImportType::Function, "XampDemandUpdateRunCacheCleaner");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0686, ImportType::Function, "XamXStudioRequest");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x06A4, ImportType::Function, "XamShowAvatarMiniCreatorUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x06A5, ImportType::Function, "XamShowGoldUpgradeUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x06A6, ImportType::Function, "XamResumeUpdaterUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x06A7, ImportType::Function, "XamShowDirectAcquireUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x06A8, ImportType::Function, "XamShowPaymentOptionsUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0708, ImportType::Function, "XamGetLiveHiveValueA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0709, ImportType::Function, "XamGetLiveHiveValueW");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x070A, ImportType::Function, "XamGetLiveHiveValueDuringLogonAttemptA");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x076C, ImportType::Function, "XamDownloadMarketplaceStoresList");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x076D, ImportType::Function, "XamGetStoreFront");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x076E, ImportType::Function, "XamSetStagingMode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x076F, ImportType::Function, "XamGetStagingMode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0770, ImportType::Function, "XamAppGetSessionId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07D0, ImportType::Function, "XamDoesOmniNeedConfiguration");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07D1, ImportType::Function, "XamFirstRunExperienceShouldRun");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07D2, ImportType::Function, "GetProcessHeap");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07D3, ImportType::Function, "UnhandledExceptionFilter");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07D4, ImportType::Function, "SetUnhandledExceptionFilter");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07D5, ImportType::Function, "XamIsOptionalMediaUpdateInstalled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07D6, ImportType::Function, "XamShowOptionalMediaUpdateRequiredUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07D7, ImportType::Function, "XamShowOptionalMediaUpdateRequiredUIEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07D8, ImportType::Function, "XamShowFirstRunWelcomeUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07D9, ImportType::Function, "XamTaskCreateQueueEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07DA, ImportType::Function, "XamSetDashBackstackData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07DB, ImportType::Function, "XamLaunchAvatarEditor");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07DC, ImportType::Function, "XamGetDashBackstackData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07DD, ImportType::Function, "XamGetDashBackstackNodesCount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07DE, ImportType::Function, "XamSetLastActiveUserData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07DF, ImportType::Function, "XamGetLastActiveUserData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07E0, ImportType::Function, "XamSetActiveDashAppInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x07E1, ImportType::Function, "XamGetActiveDashAppInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0802, ImportType::Function, "XamUserCreateAvatarAssetEnumerator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0803, ImportType::Function, "XamInitializeGameTileCache");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0804, ImportType::Function, "XamDestroyGameTileCache");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0805, ImportType::Function, "XamReadGameTileImage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0806, ImportType::Function, "XamShouldThrottleAccountInfoCall");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0807, ImportType::Function, "XuiClassDerivesFrom");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0808, ImportType::Function, "XuiFreeVisuals");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0809, ImportType::Function, "XuiGetBaseClass");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x080A, ImportType::Function, "XuiLoadVisualFromBinary");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x080B, ImportType::Function, "XuiResourceGetBuffer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x080C, ImportType::Function, "XuiResourceGetTotalSize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x080D, ImportType::Function, "XuiElementGetUserData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x080E, ImportType::Function, "XuiElementSetUserData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x080F, ImportType::Function, "XuiTabSceneGetCount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0810, ImportType::Function, "XuiSliderGetStep");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0811, ImportType::Function, "XuiSliderSetStep");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0812, ImportType::Function, "XuiProgressBarGetRange");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0813, ImportType::Function, "XuiElementSetHittable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0814, ImportType::Function, "XuiElementPlayNamedFrames");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0815, ImportType::Function, "XuiElementGetPivot");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0816, ImportType::Function, "XuiElementGetPrev");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0817, ImportType::Function, "XuiElementGetScale");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0818, ImportType::Function, "XuiElementSetPivot");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0819, ImportType::Function, "XuiElementSetRotation");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x081A, ImportType::Function, "XuiElementSetScale");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x081B, ImportType::Function, "XuiControlWantsUnfocusedInput");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x081C, ImportType::Function, "XuiResourceOpenNoLoc");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x081D, ImportType::Function, "XuiResourceReleasePackage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x081E, ImportType::Function, "XuiResourceGetPackageEntryInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x081F, ImportType::Function, "XuiResourceGetPackageEntryCount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0820, ImportType::Function, "XuiResourceOpenPackage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0821, ImportType::Function, "XamCodeCoverageFileOpen");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0822, ImportType::Function, "XamCodeCoverageFileClose");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0823, ImportType::Function, "XamCodeCoverageFileLseek");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0824, ImportType::Function, "XamCodeCoverageFileRead");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0825, ImportType::Function, "XamCodeCoverageFileWrite");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0826, ImportType::Function, "Refresh");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0827, ImportType::Function, "XampHeapGetInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0828, ImportType::Function, "XampHeapGetCount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0829, ImportType::Function, "XamShowPamUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x082A, ImportType::Function, "XuiElementLayoutTree");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x082B, ImportType::Function, "XamRegisterScreenSaverCallback");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x082C, ImportType::Function, "XUIElementPropVal_SetInt");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x082D, ImportType::Function, "XUIElementPropVal_SetFloat");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x082E, ImportType::Function, "XuiObjectGetPropertyDef");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x082F, ImportType::Function, "XuiRenderGetDevice");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0830, ImportType::Function, "XuiRenderRestoreState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0831, ImportType::Function, "XuiElementGetFullXForm");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0832, ImportType::Function, "XuiRenderGetViewTransform");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0833, ImportType::Function, "XuiRenderGetColorSpace");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0834, ImportType::Function, "XamPngEncode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0835, ImportType::Function, "XamPngDecode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0836, ImportType::Function, "XamPngEncodeEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0837, ImportType::Function, "XuiTextElementMeasureText");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0838, ImportType::Function, "XamLoaderShouldConfirmReboot");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0839, ImportType::Function, "XamLoaderRebootToDash");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x083A, ImportType::Function, "XamNuiHudGetEngagedTrackingID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x083B, ImportType::Function, "XamLoaderLaunchTitleForReason");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x083C, ImportType::Function, "XamNuiHudSetEngagedTrackingID");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x083E, ImportType::Function, "XamSetupTexture");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0841, ImportType::Function, "XamSetupCameraPreviewStuff");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0842, ImportType::Function, "XamReleaseCameraPreviewStuff");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0843, ImportType::Function, "XamRenderCameraPreviewStuff");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0848, ImportType::Function, "XamAccountRecoveryGetSetTitleSyncTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0849, ImportType::Function, "XamReadBiometricData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x084A, ImportType::Function, "XamWriteBiometricData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x084B, ImportType::Function, "XamD3DResourceDescriptorCreate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x084C, ImportType::Function, "XamD3DResourceDescriptorAddRef");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x084D, ImportType::Function, "XamD3DResourceDescriptorRelease");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x084E, ImportType::Function, "XamD3DResourceAddRef");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x084F, ImportType::Function, "XamD3DResourceSet");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0850, ImportType::Function, "XamD3DResourceIsBusy");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0851, ImportType::Function, "XamD3DResourceRelease");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x085E, ImportType::Function, "XamNuiEnableChatMic");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x085F, ImportType::Function, "XamNuiIsChatMicEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0860, ImportType::Function, "XamNuiGetDepthCalibration");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0861, ImportType::Function, "XamNuiStoreDepthCalibration");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0862, ImportType::Function, "XamUserNuiIsBiometricEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0863, ImportType::Function, "XamUserNuiEnableBiometric");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0864, ImportType::Function, "XamNuiCameraSetFlags");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0865, ImportType::Function, "XamNuiCameraRememberFloor");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0866, ImportType::Function, "XamUserNuiGetUserIndexForBind");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0867, ImportType::Function, "XamUserNuiGetUserIndexForSignin");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0868, ImportType::Function, "XamUserNuiBind");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0869, ImportType::Function, "XamUserNuiGetUserIndex");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x086A, ImportType::Function, "XamUserNuiGetEnrollmentIndex");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x086B, ImportType::Function, "XamUserNuiUnbind");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x086C, ImportType::Function, "XamNuiIdentityGetQualityFlagsMessage");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x086D, ImportType::Function, "XamNuiCameraTiltSetCallback");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x086E, ImportType::Function, "XamNuiHudIsEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x086F, ImportType::Function, "XamNuiCameraGetTiltControllerType");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0870, ImportType::Function, "XamNuiCameraTiltGetStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0871, ImportType::Function, "XamNuiIdentityGetQualityFlags");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0872, ImportType::Function, "XamNuiIdentityEnrollForSignIn");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0873, ImportType::Function, "XamNuiIdentityGetSessionId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0874, ImportType::Function, "XamNuiIdentityIdentifyWithBiometric");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0875, ImportType::Function, "ControlPackGetHandleManager");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0876, ImportType::Function, "XamEnableNuiAutomation");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0877, ImportType::Function, "XamNuiGetSystemGestureControl");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0878, ImportType::Function, "XamGetPasscodeKeyFromVirtualKey");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0879, ImportType::Function, "XamEnableNatalPlayback");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x087A, ImportType::Function, "XamIsNuiAutomationEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x087B, ImportType::Function, "XamIsNatalPlaybackEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x087C, ImportType::Function, "XamNuiHudInterpretFrame");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x087D, ImportType::Function, "XamNuiHudEnableInputFilter");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x087E, ImportType::Function, "ControlpackNuiCursorSetTrackingId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x087F, ImportType::Function, "XamNuiHudGetInitializeFlags");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0880, ImportType::Function, "XamNuiCameraElevationSetAngle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0881, ImportType::Function, "XamNuiCameraElevationGetAngle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0882, ImportType::Function, "XamNuiCameraElevationAutoTilt");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0883, ImportType::Function, "XamNuiCameraElevationStopMovement");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0884, ImportType::Function, "XamNuiCameraElevationSetCallback");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0885, ImportType::Function, "XamNuiGetDeviceStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0886, ImportType::Function, "XamNuiNatalCameraUpdateStarting");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0887, ImportType::Function, "XamNuiNatalCameraUpdateComplete");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0888, ImportType::Function, "XamNuiHudGetVersions");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0889, ImportType::Function, "XamGetHUDElementByPath");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x088A, ImportType::Function, "XamGetHUDElementByAutoId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x088B, ImportType::Function, "XuiElementGetScreenPositionCenter");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x088C, ImportType::Function, "XamNuiCameraElevationReverseAutoTilt");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x088D, ImportType::Function, "ControlPackSimpleCursorGetRayFromScreenPosition");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x088E, ImportType::Function, "ControlPackSideNavControlGetNuiHandle");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x088F, ImportType::Function, "XamFindHUDElementByXuiId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0890, ImportType::Function, "XamNuiIsDeviceReady");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0891, ImportType::Function, "XamNuiSetForceDeviceOff");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0892, ImportType::Function, "XamNuiPlayerEngagementUpdate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0893, ImportType::Function, "XamNuiSkeletonGetBestSkeletonIndex");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0894, ImportType::Function, "XamNuiSkeletonScoreUpdate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0895, ImportType::Function, "XamNuiCameraTiltReportStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0896, ImportType::Function, "XamNuiCameraAdjustTilt");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0898, ImportType::Function, "D3DDevice_CreateVertexShader");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0899, ImportType::Function, "D3DDevice_CreatePixelShader");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x089A, ImportType::Function, "D3DDevice_CreateTexture");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x089B, ImportType::Function, "D3DDevice_CreateVertexBuffer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x089C, ImportType::Function, "D3DDevice_CreateIndexBuffer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x089D, ImportType::Function, "D3DDevice_CreateVertexDeclaration");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x089E, ImportType::Function, "D3DVertexBuffer_Unlock");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x089F, ImportType::Function, "D3DVertexBuffer_Lock");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08A0, ImportType::Function, "D3DIndexBuffer_Unlock");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08A1, ImportType::Function, "D3DIndexBuffer_Lock");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08A2, ImportType::Function, "D3DTexture_UnlockRect");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08A3, ImportType::Function, "D3DTexture_LockRect");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08A4, ImportType::Function, "D3DDevice_Clear");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08A5, ImportType::Function, "D3DDevice_SetViewport");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08A6, ImportType::Function, "D3DDevice_GetViewport");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08A7, ImportType::Function, "D3DVertexShader_Release");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08A8, ImportType::Function, "D3DPixelShader_Release");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08A9, ImportType::Function, "D3DVertexDeclaration_Release");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08AA, ImportType::Function, "D3DResource_Release");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08AB, ImportType::Function, "D3DDevice_Release");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08AC, ImportType::Function, "D3DDevice_SetVertexShader");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08AD, ImportType::Function, "D3DDevice_SetPixelShader");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08AE, ImportType::Function, "D3DDevice_SetTexture");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08AF, ImportType::Function, "D3DDevice_SetVertexDeclaration");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08B0, ImportType::Function, "D3DDevice_SetIndices");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08B1, ImportType::Function, "D3DDevice_SetStreamSource");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08B2, ImportType::Function, "D3DDevice_DrawVertices");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08B3, ImportType::Function, "D3DDevice_DrawVerticesUP");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08B4, ImportType::Function, "D3DDevice_DrawIndexedVertices");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08B5, ImportType::Function, "D3DDevice_DrawIndexedVerticesUP");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08B6, ImportType::Function, "D3DDevice_SetVertexShaderConstantF_ParameterCheck");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08B7, ImportType::Function, "D3DDevice_SetPixelShaderConstantF_ParameterCheck");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08B8, ImportType::Function, "D3DDevice_SetSamplerState_ParameterCheck");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08B9, ImportType::Function, "D3DDevice_SetRenderState_ParameterCheck");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08BA, ImportType::Function, "D3DDevice_GetRenderState_ParameterCheck");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08BB, ImportType::Function, "D3DDevice_SetVertexShaderConstantFN");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08BC, ImportType::Function, "D3DDevice_SetPixelShaderConstantFN");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08BD, ImportType::Function, "D3DDevice_GetRenderState_ZEnable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08BE, ImportType::Function, "D3DDevice_GetRenderState_CullMode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08BF, ImportType::Function, "D3DDevice_GetRenderState_AlphaBlendEnable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08C0, ImportType::Function, "D3DDevice_GetRenderState_SrcBlendAlpha");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08C1, ImportType::Function, "D3DDevice_GetRenderState_DestBlendAlpha");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08C2, ImportType::Function, "D3DDevice_GetRenderState_BlendOp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08C3, ImportType::Function, "D3DDevice_GetRenderState_ViewportEnable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08C4, ImportType::Function, "D3DDevice_SetRenderState_ZEnable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08C5, ImportType::Function, "D3DDevice_SetRenderState_CullMode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08C6, ImportType::Function, "D3DDevice_SetRenderState_AlphaBlendEnable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08C7, ImportType::Function, "D3DDevice_SetRenderState_SrcBlendAlpha");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08C8, ImportType::Function, "D3DDevice_SetRenderState_DestBlendAlpha");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08C9, ImportType::Function, "D3DDevice_SetRenderState_BlendOp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08CA, ImportType::Function, "D3DDevice_SetRenderState_ViewportEnable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08CB, ImportType::Function, "D3DDevice_SetSamplerState_MagFilter");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08CC, ImportType::Function, "D3DDevice_SetSamplerState_MinFilter");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08CD, ImportType::Function, "D3DDevice_SetSamplerState_AddressU");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08CE, ImportType::Function, "D3DDevice_SetSamplerState_AddressV");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08CF, ImportType::Function, "XGSetTextureHeader");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08D0, ImportType::Function, "XGGetTextureDesc");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08D1, ImportType::Function, "XGOffsetResourceAddress");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08D2, ImportType::Function, "D3DResource_AddRef");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08D3, ImportType::Function, "D3DVertexShader_AddRef");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08D4, ImportType::Function, "D3DPixelShader_AddRef");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08D5, ImportType::Function, "D3DVertexDeclaration_AddRef");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08D6, ImportType::Function, "XGSetTextureHeaderEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08D7, ImportType::Function, "D3DDevice_GetRenderTarget");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08D8, ImportType::Function, "D3DDevice_SetRenderTarget");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08D9, ImportType::Function, "D3DDevice_GetDepthStencilSurface");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08DA, ImportType::Function, "D3DDevice_SetDepthStencilSurface");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08DB, ImportType::Function, "D3DDevice_Resolve");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08DC, ImportType::Function, "D3DDevice_SetPixelShaderConstantB");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08DD, ImportType::Function, "XamNuiGetDeviceSerialNumber");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08FC, ImportType::Function, "XamXtwManagerGetImportType::VariableCount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08FD, ImportType::Function, "XamXtwManagerGetId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08FE, ImportType::Function, "XamXtwManagerGetValue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x08FF, ImportType::Function, "XamXtwManagerSetValue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0900, ImportType::Function, "XamXtwManagerIncrement");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0901, ImportType::Function, "XamXtwManagerDecrement");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0902, ImportType::Function, "XamXtwManagerResetValue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0903, ImportType::Function, "XamXtwManagerResetAll");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0904, ImportType::Function, "XamXtwManagerGetDataFilePath");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0905, ImportType::Function, "XamXtwManagerDeleteDataFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0906, ImportType::Function, "XamXtwManagerSave");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0907, ImportType::Function, "XamXtwManagerLoad");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0908, ImportType::Function, "XamGetXTweakManager");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09C4, ImportType::Function, "XamBackgroundDownloadSetMode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09C5, ImportType::Function, "XamBackgroundDownloadIsEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09C6, ImportType::Function, "XamBackgroundDownloadGetActiveItem");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09C7, ImportType::Function, "XamBackgroundDownloadGetItems");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09C8, ImportType::Function, "XamBackgroundDownloadClearItems");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09C9, ImportType::Function, "XamBackgroundDownloadItemAdd");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09CA, ImportType::Function, "XamBackgroundDownloadItemRemove");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09CB, ImportType::Function, "XamBackgroundDownloadItemMakeFirst");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09CC, ImportType::Function, "XamBackgroundDownloadSetForegroundPriority");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09CD, ImportType::Function, "XamBackgroundDownloadGetForegroundPriority");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09CE, ImportType::Function, "XamBackgroundDownloadItemToContentData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09CF, ImportType::Function, "XamBackgroundDownloadItemGetStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09D0, ImportType::Function, "XamBackgroundDownloadHistoryGetItem");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09D1, ImportType::Function, "XamBackgroundDownloadItemGetHistoryStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09D2, ImportType::Function, "XamBackgroundDownloadItemSetHistoryStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09D3, ImportType::Function, "XamBackgroundDownloadItemGetStatusAsync");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09D4, ImportType::Function, "XamBackgroundDownloadItemGetStatusEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09D5, ImportType::Function, "XamBackgroundDownloadItemGetHistoryStatusEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09D6, ImportType::Function, "XamBackgroundDownloadBindItems");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09D7, ImportType::Function, "XamBackgroundDownloadSetPollingActive");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09D8, ImportType::Function, "XamBackgroundDownloadGetPollingActive");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09D9, ImportType::Function, "XamBackgroundDownloadGetMode");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09DA, ImportType::Function, "XamBackgroundDownloadGetUnexpectedChangeCount");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09DB, ImportType::Function, "XamBackgroundDownloadIsItemForThisConsole");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09DC, ImportType::Function, "XamBackgroundDownloadSelectDevice");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09DD, ImportType::Function, "XamBackgroundDownloadItemModify");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09DE, ImportType::Function, "XamBackgroundDownloadCacheLegacyMappingInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09DF, ImportType::Function, "XamBackgroundDownloadGetLegacyMappingInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09E0, ImportType::Function, "XamBackgroundDownloadGetLegacyId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x09E1, ImportType::Function, "XamBackgroundDownloadDoFail");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A28, ImportType::Function, "XamSwapDisc");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A29, ImportType::Variable, "XamSwapDiscPatchAddress");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A2A, ImportType::Function, "XamSwapCancel");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A32, ImportType::Function, "XamRamDriveCreate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A33, ImportType::Function, "XamRamDriveDestroy");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5A, ImportType::Function, "XamPlayTimerGetData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5B, ImportType::Function, "XamPlayTimerSetData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5C, ImportType::Function, "XamPlayTimerResume");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5D, ImportType::Function, "XamPlayTimerSuspend");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5E, ImportType::Function, "XamPlayTimerIsRunning");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A5F, ImportType::Function, "XamPlayTimerIsEnabled");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A60, ImportType::Function, "XamPlayTimerGetNextResetDate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A61, ImportType::Function, "XamPlayTimerFormatDurationString");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A62, ImportType::Function, "XamPlayTimerGetTimeRemaining");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A63, ImportType::Function, "XamPlayTimerUpdateTimeRemaining");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A64, ImportType::Function, "XamPlayTimerForceNotification");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A65, ImportType::Function, "XamPlayTimerRefreshResetDate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A6E, ImportType::Function, "UpnpAVServerSearchInitialize");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A6F, ImportType::Function, "UpnpAVServerSearchDestroy");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A70, ImportType::Function, "UpnpAVServerSearchStart");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A71, ImportType::Function, "Destroy");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A72, ImportType::Function, "UpnpAVServerSearchDoWork");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A73, ImportType::Function, "UpnpAVServerSearchGetNextServer");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A8C, ImportType::Function, "XCustomBroadcastGamercardEvent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0A8D, ImportType::Function, "XamCustomGetCurrentActions");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AA0, ImportType::Function, "XamInstrumentationLogEvent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AA1, ImportType::Function, "XamRegisterSMCNotification");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AAA, ImportType::Function, "XamInstrumentationLogEventEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AAB, ImportType::Function, "XamInstrumentationGetSourceConfig");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AAC, ImportType::Function, "XamInstrumentationDebugConfig");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0ADC, ImportType::Function, "CurlCreateCacheEntry");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0ADD, ImportType::Function, "CurlOpenCacheEntry");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0ADE, ImportType::Function, "CurlSetCacheEntryExpireTime");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0ADF, ImportType::Function, "CurlReadCacheEntryHeaders");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE0, ImportType::Function, "CurlReadCacheEntryContent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE1, ImportType::Function, "CurlWriteCacheEntryContent");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE2, ImportType::Function, "CurlCloseCacheEntry");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE3, ImportType::Function, "CurlEnumerateCacheEntry");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE5, ImportType::Function, "CurlWipeBackingFiles");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AE7, ImportType::Function, "CurlOpenTitleBackingFile");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF0, ImportType::Function, "XamSetSecurityViolationDetected");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF1, ImportType::Function, "XamIsSecurityViolationDetected");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF2, ImportType::Function, "XamIsAnySecurityViolationDetected");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF3, ImportType::Function, "XamGetSecurityViolationsDetected");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF4, ImportType::Function, "XamActivateCounterMeasure");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF5, ImportType::Function, "XamDeactivateCounterMeasure");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF6, ImportType::Function, "XamIsCounterMeasureActivated");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AF7, ImportType::Function, "XamGetActiveCounterMeasures");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AFC, ImportType::Function, "XamPartyCreate");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AFD, ImportType::Function, "XamPartyLeave");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AFE, ImportType::Function, "XamPartySendInviteDeprecated");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0AFF, ImportType::Function, "XamPartyGetUserList");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B00, ImportType::Function, "XamPartySendGameInvites");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B01, ImportType::Function, "XamPartyJoin");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B02, ImportType::Function, "XamPartyKickUser");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B03, ImportType::Function, "XamPartyAddLocalUsers");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B04, ImportType::Function, "XamConvertEmoticons");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B05, ImportType::Function, "XamGetLocaleTimeFormat");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B06, ImportType::Function, "XamPartyRemoveLocalUsers");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B07, ImportType::Function, "XamPartyGetUserListInternal");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B08, ImportType::Function, "XamPartySetJoinable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B09, ImportType::Function, "XamPartyGetJoinable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0A, ImportType::Function, "XamPartyGetInfo");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0B, ImportType::Function, "XamPartySetCustomData");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0C, ImportType::Function, "XamPartySetConnectivityGraph");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0D, ImportType::Function, "XamPartyGetRoutingTable");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0E, ImportType::Function, "XamPartyAutomationInprocCall");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B0F, ImportType::Function, "XamPartyGetState");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B10, ImportType::Function, "XamPartyGetBandwidth");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B11, ImportType::Function, "XamPartyGetNetworkCounters");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B12, ImportType::Function, "XamShowQuickLaunchUI");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B13, ImportType::Function, "XamPartyIsCoordinator");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B14, ImportType::Function, "XamPartyGetFormation");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B15, ImportType::Function, "XamPartySendInvite");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B16, ImportType::Function, "XamPartySetTestDelay");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B17, ImportType::Function, "XamPartyOverrideNatType");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B18, ImportType::Function, "XamPartyGetAccessLevel");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B19, ImportType::Function, "XamPartySetTestFlags");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B1A, ImportType::Function, "XamIsSystemExperienceTitleId");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B22, ImportType::Function, "XamTaskSetCancelSubTasks");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B23, ImportType::Function, "XamTaskGetCompletionStatus");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B24, ImportType::Function, "XamTaskCancelWaitAndCloseWaitTask");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B2C, ImportType::Function, "XamWebInstrumentationCreateReport");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B2D, ImportType::Function, "XamWebInstrumentationSetUserVar");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B2E, ImportType::Function, "XamWebInstrumentationSetUserVarNoEscape");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B2F, ImportType::Function, "XamWebInstrumentationGetURL");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B30, ImportType::Function, "XamWebInstrumentationSendReport");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B31, ImportType::Function, "XamWebInstrumentationDestroyReport");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B32, ImportType::Function, "XamWebInstrumentationCreateSampledReport");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B33, ImportType::Function, "XampSetSamplingRandomValue");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B34, ImportType::Function, "XampWebInstrumentationSetProfileCounts");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B35, ImportType::Function, "XamWebInstrumentationGetURLEx");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B36, ImportType::Function, "XampSetOmnitureCallbackImportType::Function");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B37, ImportType::Function, "XamShowQuickChatUIp");
-    LOAD_IMPORT(XboxLibrary::Xam, 0x0B4A, ImportType::Function, "XamVerifyXSignerSignature");
-
-
-    //
-    // XboxKrnl
-    //
-
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0001, ImportType::Function, "DbgBreakPoint");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0002, ImportType::Function, "DbgBreakPointWithStatus");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0003, ImportType::Function, "DbgPrint");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0004, ImportType::Function, "DbgPrompt");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0005, ImportType::Function, "DumpGetRawDumpInfo");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0006, ImportType::Function, "DumpWriteDump");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0007, ImportType::Function, "ExAcquireReadWriteLockExclusive");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0008, ImportType::Function, "ExAcquireReadWriteLockShared");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0009, ImportType::Function, "ExAllocatePool");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000A, ImportType::Function, "ExAllocatePoolWithTag");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000B, ImportType::Function, "ExAllocatePoolTypeWithTag");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000C, ImportType::Variable, "ExConsoleGameRegion");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000D, ImportType::Function, "ExCreateThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000E, ImportType::Function, "ExEventObjectType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x000F, ImportType::Function, "ExFreePool");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0010, ImportType::Function, "ExGetXConfigSetting");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0011, ImportType::Function, "ExInitializeReadWriteLock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0012, ImportType::Function, "ExMutantObjectType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0013, ImportType::Function, "ExQueryPoolBlockSize");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0014, ImportType::Function, "ExRegisterThreadNotification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0015, ImportType::Function, "ExRegisterTitleTerminateNotification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0016, ImportType::Function, "ExReleaseReadWriteLock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0017, ImportType::Function, "ExSemaphoreObjectType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0018, ImportType::Function, "ExSetXConfigSetting");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0019, ImportType::Function, "ExTerminateThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001A, ImportType::Function, "ExTerminateTitleProcess");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001B, ImportType::Function, "ExThreadObjectType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001C, ImportType::Function, "ExTimerObjectType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001D, ImportType::Function, "MmDoubleMapMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001E, ImportType::Function, "MmUnmapMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x001F, ImportType::Function, "XeKeysGetConsoleCertificate");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0020, ImportType::Function, "FscGetCacheElementCount");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0021, ImportType::Function, "FscSetCacheElementCount");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0022, ImportType::Function, "HalGetCurrentAVPack");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0023, ImportType::Function, "HalGpioControl");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0024, ImportType::Function, "HalOpenCloseODDTray");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0025, ImportType::Function, "HalReadWritePCISpace");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0026, ImportType::Function, "HalRegisterPowerDownNotification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0027, ImportType::Function, "HalRegisterSMCNotification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0028, ImportType::Function, "HalReturnToFirmware");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0029, ImportType::Function, "HalSendSMCMessage");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002A, ImportType::Function, "HalSetAudioEnable");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002B, ImportType::Function, "InterlockedFlushSList");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002C, ImportType::Function, "InterlockedPopEntrySList");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002D, ImportType::Function, "InterlockedPushEntrySList");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002E, ImportType::Function, "IoAcquireDeviceObjectLock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x002F, ImportType::Function, "IoAllocateIrp");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0030, ImportType::Function, "IoBuildAsynchronousFsdRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0031, ImportType::Function, "IoBuildDeviceIoControlRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0032, ImportType::Function, "IoBuildSynchronousFsdRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0033, ImportType::Function, "IoCallDriver");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0034, ImportType::Function, "IoCheckShareAccess");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0035, ImportType::Function, "IoCompleteRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0036, ImportType::Function, "IoCompletionObjectType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0037, ImportType::Function, "IoCreateDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0038, ImportType::Function, "IoCreateFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0039, ImportType::Function, "IoDeleteDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003A, ImportType::Function, "IoDeviceObjectType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003B, ImportType::Function, "IoDismountVolume");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003C, ImportType::Function, "IoDismountVolumeByFileHandle");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003D, ImportType::Function, "IoDismountVolumeByName");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003E, ImportType::Function, "IoFileObjectType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x003F, ImportType::Function, "IoFreeIrp");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0040, ImportType::Function, "IoInitializeIrp");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0041, ImportType::Function, "IoInvalidDeviceRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0042, ImportType::Function, "ExSetBetaFeaturesEnabled");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0043, ImportType::Function, "IoQueueThreadIrp");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0044, ImportType::Function, "IoReleaseDeviceObjectLock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0045, ImportType::Function, "IoRemoveShareAccess");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0046, ImportType::Function, "IoSetIoCompletion");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0047, ImportType::Function, "IoSetShareAccess");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0048, ImportType::Function, "IoStartNextPacket");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0049, ImportType::Function, "IoStartNextPacketByKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004A, ImportType::Function, "IoStartPacket");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004B, ImportType::Function, "IoSynchronousDeviceIoControlRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004C, ImportType::Function, "IoSynchronousFsdRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004D, ImportType::Function, "KeAcquireSpinLockAtRaisedIrql");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004E, ImportType::Function, "KeAlertResumeThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x004F, ImportType::Function, "KeAlertThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0050, ImportType::Function, "KeBlowFuses");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0051, ImportType::Function, "KeBoostPriorityThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0052, ImportType::Function, "KeBugCheck");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0053, ImportType::Function, "KeBugCheckEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0054, ImportType::Function, "KeCancelTimer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0055, ImportType::Function, "KeConnectInterrupt");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0056, ImportType::Function, "KeContextFromKframes");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0057, ImportType::Function, "KeContextToKframes");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0058, ImportType::Function, "KeCreateUserMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0059, ImportType::Variable, "KeDebugMonitorData");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005A, ImportType::Function, "KeDelayExecutionThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005B, ImportType::Function, "KeDeleteUserMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005C, ImportType::Function, "KeDisconnectInterrupt");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005D, ImportType::Function, "KeEnableFpuExceptions");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005E, ImportType::Function, "KeEnablePPUPerformanceMonitor");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x005F, ImportType::Function, "KeEnterCriticalRegion");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0060, ImportType::Function, "KeEnterUserMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0061, ImportType::Function, "KeFlushCacheRange");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0062, ImportType::Function, "KeFlushCurrentEntireTb");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0063, ImportType::Function, "KeFlushEntireTb");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0064, ImportType::Function, "KeFlushUserModeCurrentTb");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0065, ImportType::Function, "KeFlushUserModeTb");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0066, ImportType::Function, "KeGetCurrentProcessType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0067, ImportType::Function, "KeGetPMWRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0068, ImportType::Function, "KeGetPRVRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0069, ImportType::Function, "KeGetSocRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006A, ImportType::Function, "KeGetSpecialPurposeRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006B, ImportType::Function, "KeLockL2");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006C, ImportType::Function, "KeUnlockL2");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006D, ImportType::Function, "KeInitializeApc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006E, ImportType::Function, "KeInitializeDeviceQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x006F, ImportType::Function, "KeInitializeDpc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0070, ImportType::Function, "KeInitializeEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0071, ImportType::Function, "KeInitializeInterrupt");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0072, ImportType::Function, "KeInitializeMutant");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0073, ImportType::Function, "KeInitializeQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0074, ImportType::Function, "KeInitializeSemaphore");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0075, ImportType::Function, "KeInitializeTimerEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0076, ImportType::Function, "KeInsertByKeyDeviceQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0077, ImportType::Function, "KeInsertDeviceQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0078, ImportType::Function, "KeInsertHeadQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0079, ImportType::Function, "KeInsertQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007A, ImportType::Function, "KeInsertQueueApc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007B, ImportType::Function, "KeInsertQueueDpc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007C, ImportType::Function, "KeIpiGenericCall");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007D, ImportType::Function, "KeLeaveCriticalRegion");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007E, ImportType::Function, "KeLeaveUserMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x007F, ImportType::Function, "KePulseEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0080, ImportType::Function, "KeQueryBackgroundProcessors");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0081, ImportType::Function, "KeQueryBasePriorityThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0082, ImportType::Function, "KeQueryInterruptTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0083, ImportType::Function, "KeQueryPerformanceFrequency");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0084, ImportType::Function, "KeQuerySystemTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0085, ImportType::Function, "KeRaiseIrqlToDpcLevel");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0086, ImportType::Function, "KeRegisterDriverNotification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0087, ImportType::Function, "KeReleaseMutant");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0088, ImportType::Function, "KeReleaseSemaphore");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0089, ImportType::Function, "KeReleaseSpinLockFromRaisedIrql");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008A, ImportType::Function, "KeRemoveByKeyDeviceQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008B, ImportType::Function, "KeRemoveDeviceQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008C, ImportType::Function, "KeRemoveEntryDeviceQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008D, ImportType::Function, "KeRemoveQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008E, ImportType::Function, "KeRemoveQueueDpc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x008F, ImportType::Function, "KeResetEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0090, ImportType::Function, "KeRestoreFloatingPointState");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0091, ImportType::Function, "KeRestoreVectorUnitState");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0092, ImportType::Function, "KeResumeThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0093, ImportType::Function, "KeRetireDpcList");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0094, ImportType::Function, "KeRundownQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0095, ImportType::Function, "KeSaveFloatingPointState");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0096, ImportType::Function, "KeSaveVectorUnitState");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0097, ImportType::Function, "KeSetAffinityThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0098, ImportType::Function, "KeSetBackgroundProcessors");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0099, ImportType::Function, "KeSetBasePriorityThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009A, ImportType::Function, "KeSetCurrentProcessType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009B, ImportType::Function, "KeSetCurrentStackPointers");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009C, ImportType::Function, "KeSetDisableBoostThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009D, ImportType::Function, "KeSetEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009E, ImportType::Function, "KeSetEventBoostPriority");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x009F, ImportType::Function, "KeSetPMWRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A0, ImportType::Function, "KeSetPowerMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A1, ImportType::Function, "KeSetPRVRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A2, ImportType::Function, "KeSetPriorityClassThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A3, ImportType::Function, "KeSetPriorityThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A4, ImportType::Function, "KeSetSocRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A5, ImportType::Function, "KeSetSpecialPurposeRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A6, ImportType::Function, "KeSetTimer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A7, ImportType::Function, "KeSetTimerEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A8, ImportType::Function, "KeStallExecutionProcessor");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00A9, ImportType::Function, "KeSuspendThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AA, ImportType::Function, "KeSweepDcacheRange");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AB, ImportType::Function, "KeSweepIcacheRange");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AC, ImportType::Function, "KeTestAlertThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AD, ImportType::Variable, "KeTimeStampBundle");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AE, ImportType::Function, "KeTryToAcquireSpinLockAtRaisedIrql");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00AF, ImportType::Function, "KeWaitForMultipleObjects");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B0, ImportType::Function, "KeWaitForSingleObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B1, ImportType::Function, "KfAcquireSpinLock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B2, ImportType::Function, "KfRaiseIrql");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B3, ImportType::Function, "KfLowerIrql");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B4, ImportType::Function, "KfReleaseSpinLock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B5, ImportType::Variable, "KiBugCheckData");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B6, ImportType::Function, "LDICreateDecompression");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B7, ImportType::Function, "LDIDecompress");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B8, ImportType::Function, "LDIDestroyDecompression");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00B9, ImportType::Function, "MmAllocatePhysicalMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BA, ImportType::Function, "MmAllocatePhysicalMemoryEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BB, ImportType::Function, "MmCreateKernelStack");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BC, ImportType::Function, "MmDeleteKernelStack");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BD, ImportType::Function, "MmFreePhysicalMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BE, ImportType::Function, "MmGetPhysicalAddress");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00BF, ImportType::Function, "MmIsAddressValid");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C0, ImportType::Function, "MmLockAndMapSegmentArray");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C1, ImportType::Function, "MmLockUnlockBufferPages");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C2, ImportType::Function, "MmMapIoSpace");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C3, ImportType::Function, "MmPersistPhysicalMemoryAllocation");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C4, ImportType::Function, "MmQueryAddressProtect");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C5, ImportType::Function, "MmQueryAllocationSize");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C6, ImportType::Function, "MmQueryStatistics");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C7, ImportType::Function, "MmSetAddressProtect");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C8, ImportType::Function, "MmSplitPhysicalMemoryAllocation");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00C9, ImportType::Function, "MmUnlockAndUnmapSegmentArray");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CA, ImportType::Function, "MmUnmapIoSpace");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CB, ImportType::Variable, "Nls844UnicodeCaseTable");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CC, ImportType::Function, "NtAllocateVirtualMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CD, ImportType::Function, "NtCancelTimer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CE, ImportType::Function, "NtClearEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00CF, ImportType::Function, "NtClose");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D0, ImportType::Function, "NtCreateDirectoryObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D1, ImportType::Function, "NtCreateEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D2, ImportType::Function, "NtCreateFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D3, ImportType::Function, "NtCreateIoCompletion");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D4, ImportType::Function, "NtCreateMutant");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D5, ImportType::Function, "NtCreateSemaphore");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D6, ImportType::Function, "NtCreateSymbolicLinkObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D7, ImportType::Function, "NtCreateTimer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D8, ImportType::Function, "NtDeleteFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00D9, ImportType::Function, "NtDeviceIoControlFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DA, ImportType::Function, "NtDuplicateObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DB, ImportType::Function, "NtFlushBuffersFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DC, ImportType::Function, "NtFreeVirtualMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DD, ImportType::Function, "NtMakeTemporaryObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DE, ImportType::Function, "NtOpenDirectoryObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00DF, ImportType::Function, "NtOpenFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E0, ImportType::Function, "NtOpenSymbolicLinkObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E1, ImportType::Function, "NtProtectVirtualMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E2, ImportType::Function, "NtPulseEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E3, ImportType::Function, "NtQueueApcThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E4, ImportType::Function, "NtQueryDirectoryFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E5, ImportType::Function, "NtQueryDirectoryObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E6, ImportType::Function, "NtQueryEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E7, ImportType::Function, "NtQueryFullAttributesFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E8, ImportType::Function, "NtQueryInformationFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00E9, ImportType::Function, "NtQueryIoCompletion");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00EA, ImportType::Function, "NtQueryMutant");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00EB, ImportType::Function, "NtQuerySemaphore");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00EC, ImportType::Function, "NtQuerySymbolicLinkObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00ED, ImportType::Function, "NtQueryTimer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00EE, ImportType::Function, "NtQueryVirtualMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00EF, ImportType::Function, "NtQueryVolumeInformationFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F0, ImportType::Function, "NtReadFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F1, ImportType::Function, "NtReadFileScatter");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F2, ImportType::Function, "NtReleaseMutant");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F3, ImportType::Function, "NtReleaseSemaphore");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F4, ImportType::Function, "NtRemoveIoCompletion");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F5, ImportType::Function, "NtResumeThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F6, ImportType::Function, "NtSetEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F7, ImportType::Function, "NtSetInformationFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F8, ImportType::Function, "NtSetIoCompletion");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00F9, ImportType::Function, "NtSetSystemTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FA, ImportType::Function, "NtSetTimerEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FB, ImportType::Function, "NtSignalAndWaitForSingleObjectEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FC, ImportType::Function, "NtSuspendThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FD, ImportType::Function, "NtWaitForSingleObjectEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FE, ImportType::Function, "NtWaitForMultipleObjectsEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x00FF, ImportType::Function, "NtWriteFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0100, ImportType::Function, "NtWriteFileGather");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0101, ImportType::Function, "NtYieldExecution");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0102, ImportType::Function, "ObCreateObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0103, ImportType::Function, "ObCreateSymbolicLink");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0104, ImportType::Function, "ObDeleteSymbolicLink");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0105, ImportType::Function, "ObDereferenceObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0106, ImportType::Function, "ObDirectoryObjectType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0107, ImportType::Function, "ObGetWaitableObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0108, ImportType::Function, "ObInsertObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0109, ImportType::Function, "ObIsTitleObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010A, ImportType::Function, "ObLookupAnyThreadByThreadId");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010B, ImportType::Function, "ObLookupThreadByThreadId");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010C, ImportType::Function, "ObMakeTemporaryObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010D, ImportType::Function, "ObOpenObjectByName");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010E, ImportType::Function, "ObOpenObjectByPointer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x010F, ImportType::Function, "ObReferenceObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0110, ImportType::Function, "ObReferenceObjectByHandle");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0111, ImportType::Function, "ObReferenceObjectByName");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0112, ImportType::Function, "ObSymbolicLinkObjectType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0113, ImportType::Function, "ObTranslateSymbolicLink");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0114, ImportType::Function, "RtlAnsiStringToUnicodeString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0115, ImportType::Function, "RtlAppendStringToString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0116, ImportType::Function, "RtlAppendUnicodeStringToString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0117, ImportType::Function, "RtlAppendUnicodeToString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0118, ImportType::Function, "RtlAssert");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0119, ImportType::Function, "RtlCaptureContext");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011A, ImportType::Function, "RtlCompareMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011B, ImportType::Function, "RtlCompareMemoryUlong");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011C, ImportType::Function, "RtlCompareString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011D, ImportType::Function, "RtlCompareStringN");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011E, ImportType::Function, "RtlCompareUnicodeString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x011F, ImportType::Function, "RtlCompareUnicodeStringN");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0120, ImportType::Function, "RtlCompareUtf8ToUnicode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0121, ImportType::Function, "RtlCopyString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0122, ImportType::Function, "RtlCopyUnicodeString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0123, ImportType::Function, "RtlCreateUnicodeString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0124, ImportType::Function, "RtlDowncaseUnicodeChar");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0125, ImportType::Function, "RtlEnterCriticalSection");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0126, ImportType::Function, "RtlFillMemoryUlong");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0127, ImportType::Function, "RtlFreeAnsiString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0128, ImportType::Function, "RtlFreeAnsiString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0129, ImportType::Function, "RtlGetCallersAddress");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012A, ImportType::Function, "RtlGetStackLimits");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012B, ImportType::Function, "RtlImageXexHeaderField");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012C, ImportType::Function, "RtlInitAnsiString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012D, ImportType::Function, "RtlInitUnicodeString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012E, ImportType::Function, "RtlInitializeCriticalSection");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x012F, ImportType::Function, "RtlInitializeCriticalSectionAndSpinCount");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0130, ImportType::Function, "RtlLeaveCriticalSection");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0131, ImportType::Function, "RtlLookupImportType::FunctionEntry");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0132, ImportType::Function, "RtlLowerChar");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0133, ImportType::Function, "RtlMultiByteToUnicodeN");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0134, ImportType::Function, "RtlMultiByteToUnicodeSize");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0135, ImportType::Function, "RtlNtStatusToDosError");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0136, ImportType::Function, "RtlRaiseException");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0137, ImportType::Function, "RtlRaiseStatus");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0138, ImportType::Function, "RtlRip");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0139, ImportType::Function, "_scprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013A, ImportType::Function, "_snprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013B, ImportType::Function, "sprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013C, ImportType::Function, "_scwprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013D, ImportType::Function, "_snwprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013E, ImportType::Function, "_swprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x013F, ImportType::Function, "RtlTimeFieldsToTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0140, ImportType::Function, "RtlTimeToTimeFields");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0141, ImportType::Function, "RtlTryEnterCriticalSection");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0142, ImportType::Function, "RtlUnicodeStringToAnsiString");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0143, ImportType::Function, "RtlUnicodeToMultiByteN");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0144, ImportType::Function, "RtlUnicodeToMultiByteSize");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0145, ImportType::Function, "RtlUnicodeToUtf8");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0146, ImportType::Function, "RtlUnicodeToUtf8Size");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0147, ImportType::Function, "RtlUnwind");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0148, ImportType::Function, "RtlUnwind2");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0149, ImportType::Function, "RtlUpcaseUnicodeChar");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014A, ImportType::Function, "RtlUpperChar");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014B, ImportType::Function, "RtlVirtualUnwind");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014C, ImportType::Function, "_vscprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014D, ImportType::Function, "_vsnprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014E, ImportType::Function, "vsprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x014F, ImportType::Function, "_vscwprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0150, ImportType::Function, "_vsnwprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0151, ImportType::Function, "_vswprintf");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0152, ImportType::Function, "KeTlsAlloc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0153, ImportType::Function, "KeTlsFree");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0154, ImportType::Function, "KeTlsGetValue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0155, ImportType::Function, "KeTlsSetValue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0156, ImportType::Variable, "XboxHardwareInfo");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0157, ImportType::Variable, "XboxKrnlBaseVersion");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0158, ImportType::Variable, "XboxKrnlVersion");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0159, ImportType::Function, "XeCryptAesKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015A, ImportType::Function, "XeCryptAesEcb");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015B, ImportType::Function, "XeCryptAesCbc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015C, ImportType::Function, "XeCryptBnDwLeDhEqualBase");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015D, ImportType::Function, "XeCryptBnDwLeDhInvalBase");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015E, ImportType::Function, "XeCryptBnDwLeDhModExp");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x015F, ImportType::Function, "XeCryptBnDw_Copy");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0160, ImportType::Function, "XeCryptBnDw_SwapLeBe");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0161, ImportType::Function, "XeCryptBnDw_Zero");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0162, ImportType::Function, "XeCryptBnDwLePkcs1Format");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0163, ImportType::Function, "XeCryptBnDwLePkcs1Verify");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0164, ImportType::Function, "XeCryptBnQwBeSigCreate");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0165, ImportType::Function, "XeCryptBnQwBeSigFormat");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0166, ImportType::Function, "XeCryptBnQwBeSigVerify");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0167, ImportType::Function, "XeCryptBnQwNeModExp");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0168, ImportType::Function, "XeCryptBnQwNeModExpRoot");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0169, ImportType::Function, "XeCryptBnQwNeModInv");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016A, ImportType::Function, "XeCryptBnQwNeModMul");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016B, ImportType::Function, "XeCryptBnQwNeRsaKeyGen");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016C, ImportType::Function, "XeCryptBnQwNeRsaPrvCrypt");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016D, ImportType::Function, "XeCryptBnQwNeRsaPubCrypt");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016E, ImportType::Function, "XeCryptBnQw_Copy");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x016F, ImportType::Function, "XeCryptBnQw_SwapDwQw");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0170, ImportType::Function, "XeCryptBnQw_SwapDwQwLeBe");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0171, ImportType::Function, "XeCryptBnQw_SwapLeBe");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0172, ImportType::Function, "XeCryptBnQw_Zero");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0173, ImportType::Function, "XeCryptChainAndSumMac");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0174, ImportType::Function, "XeCryptDesParity");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0175, ImportType::Function, "XeCryptDesKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0176, ImportType::Function, "XeCryptDesEcb");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0177, ImportType::Function, "XeCryptDesCbc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0178, ImportType::Function, "XeCryptDes3Key");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0179, ImportType::Function, "XeCryptDes3Ecb");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017A, ImportType::Function, "XeCryptDes3Cbc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017B, ImportType::Function, "XeCryptHmacMd5Init");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017C, ImportType::Function, "XeCryptHmacMd5Update");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017D, ImportType::Function, "XeCryptHmacMd5Final");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017E, ImportType::Function, "XeCryptHmacMd5");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x017F, ImportType::Function, "XeCryptHmacShaInit");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0180, ImportType::Function, "XeCryptHmacShaUpdate");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0181, ImportType::Function, "XeCryptHmacShaFinal");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0182, ImportType::Function, "XeCryptHmacSha");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0183, ImportType::Function, "XeCryptHmacShaVerify");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0184, ImportType::Function, "XeCryptMd5Init");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0185, ImportType::Function, "XeCryptMd5Update");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0186, ImportType::Function, "XeCryptMd5Final");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0187, ImportType::Function, "XeCryptMd5");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0188, ImportType::Function, "XeCryptParveEcb");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0189, ImportType::Function, "XeCryptParveCbcMac");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018A, ImportType::Function, "XeCryptRandom");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018B, ImportType::Function, "XeCryptRc4Key");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018C, ImportType::Function, "XeCryptRc4Ecb");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018D, ImportType::Function, "XeCryptRc4");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018E, ImportType::Function, "XeCryptRotSumSha");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x018F, ImportType::Function, "XeCryptShaInit");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0190, ImportType::Function, "XeCryptShaUpdate");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0191, ImportType::Function, "XeCryptShaFinal");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0192, ImportType::Function, "XeCryptSha");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0193, ImportType::Variable, "XexExecutableModuleHandle");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0194, ImportType::Function, "XexCheckExecutablePrivilege");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0195, ImportType::Function, "XexGetModuleHandle");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0196, ImportType::Function, "XexGetModuleSection");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0197, ImportType::Function, "XexGetProcedureAddress");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0198, ImportType::Function, "XexLoadExecutable");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0199, ImportType::Function, "XexLoadImage");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019A, ImportType::Function, "XexLoadImageFromMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019B, ImportType::Function, "XexLoadImageHeaders");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019C, ImportType::Function, "XexPcToFileHeader");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019D, ImportType::Function, "KiApcNormalRoutineNop");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019E, ImportType::Function, "XexRegisterPatchDescriptor");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x019F, ImportType::Function, "XexSendDeferredNotifications");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A0, ImportType::Function, "XexStartExecutable");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A1, ImportType::Function, "XexUnloadImage");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A2, ImportType::Function, "XexUnloadImageAndExitThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A3, ImportType::Function, "XexUnloadTitleModules");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A4, ImportType::Function, "XexVerifyImageHeaders");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A5, ImportType::Function, "__C_specific_handler");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A6, ImportType::Function, "DbgLoadImageSymbols");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A7, ImportType::Function, "DbgUnLoadImageSymbols");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A8, ImportType::Function, "RtlImageDirectoryEntryToData");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01A9, ImportType::Function, "RtlImageNtHeader");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AA, ImportType::Function, "ExDebugMonitorService");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AB, ImportType::Function, "MmDbgReadCheck");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AC, ImportType::Function, "MmDbgReleaseAddress");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AD, ImportType::Function, "MmDbgWriteCheck");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AE, ImportType::Variable, "ExLoadedCommandLine");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01AF, ImportType::Variable, "ExLoadedImageName");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B0, ImportType::Function, "VdBlockUntilGUIIdle");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B1, ImportType::Function, "VdCallGraphicsNotificationRoutines");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B2, ImportType::Function, "VdDisplayFatalError");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B3, ImportType::Function, "VdEnableClosedCaption");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B4, ImportType::Function, "VdEnableDisableClockGating");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B5, ImportType::Function, "VdEnableDisablePowerSavingMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B6, ImportType::Function, "VdEnableRingBufferRPtrWriteBack");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B7, ImportType::Function, "VdGenerateGPUCSCCoefficients");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B8, ImportType::Function, "VdGetClosedCaptionReadyStatus");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01B9, ImportType::Function, "VdGetCurrentDisplayGamma");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BA, ImportType::Function, "VdGetCurrentDisplayInformation");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BB, ImportType::Function, "VdGetDisplayModeOverride");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BC, ImportType::Function, "VdGetGraphicsAsicID");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BD, ImportType::Function, "VdGetSystemCommandBuffer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BE, ImportType::Variable, "VdGlobalDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01BF, ImportType::Variable, "VdGlobalXamDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C0, ImportType::Variable, "VdGpuClockInMHz");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C1, ImportType::Variable, "VdHSIOCalibrationLock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C2, ImportType::Function, "VdInitializeEngines");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C3, ImportType::Function, "VdInitializeRingBuffer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C4, ImportType::Function, "VdInitializeScaler");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C5, ImportType::Function, "VdInitializeScalerCommandBuffer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C6, ImportType::Function, "VdIsHSIOTrainingSucceeded");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C7, ImportType::Function, "VdPersistDisplay");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C8, ImportType::Function, "VdQuerySystemCommandBuffer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01C9, ImportType::Function, "VdQueryVideoFlags");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CA, ImportType::Function, "VdQueryVideoMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CB, ImportType::Function, "VdReadDVERegisterUlong");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CC, ImportType::Function, "VdReadWriteHSIOCalibrationFlag");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CD, ImportType::Function, "VdRegisterGraphicsNotification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CE, ImportType::Function, "VdRegisterXamGraphicsNotification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01CF, ImportType::Function, "VdSendClosedCaptionData");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D0, ImportType::Function, "VdSetCGMSOption");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D1, ImportType::Function, "VdSetColorProfileAdjustment");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D2, ImportType::Function, "VdSetCscMatricesOverride");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D3, ImportType::Function, "VdSetDisplayMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D4, ImportType::Function, "VdSetDisplayModeOverride");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D5, ImportType::Function, "VdSetGraphicsInterruptCallback");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D6, ImportType::Function, "VdSetHDCPOption");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D7, ImportType::Function, "VdSetMacrovisionOption");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D8, ImportType::Function, "VdSetSystemCommandBuffer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01D9, ImportType::Function, "VdSetSystemCommandBufferGpuIdentifierAddress");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DA, ImportType::Function, "VdSetWSSData");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DB, ImportType::Function, "VdSetWSSOption");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DC, ImportType::Function, "VdShutdownEngines");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DD, ImportType::Function, "VdTurnDisplayOff");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DE, ImportType::Function, "VdTurnDisplayOn");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01DF, ImportType::Function, "KiApcNormalRoutineNop");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E0, ImportType::Function, "VdWriteDVERegisterUlong");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E1, ImportType::Function, "XVoicedHeadsetPresent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E2, ImportType::Function, "XVoicedSubmitPacket");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E3, ImportType::Function, "XVoicedClose");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E4, ImportType::Function, "XVoicedActivate");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E5, ImportType::Function, "XInputdGetCapabilities");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E6, ImportType::Function, "XInputdReadState");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E7, ImportType::Function, "XInputdWriteState");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E8, ImportType::Function, "XInputdNotify");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01E9, ImportType::Function, "XInputdRawState");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01EA, ImportType::Function, "HidGetCapabilities");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01EB, ImportType::Function, "HidReadKeys");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01EC, ImportType::Function, "XInputdGetDeviceStats");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01ED, ImportType::Function, "XInputdResetDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01EE, ImportType::Function, "XInputdSetRingOfLight");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01EF, ImportType::Function, "XInputdSetRFPowerMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F0, ImportType::Function, "XInputdSetRadioFrequency");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F1, ImportType::Function, "HidGetLastInputTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F2, ImportType::Function, "XAudioRenderDriverInitialize");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F3, ImportType::Function, "XAudioRegisterRenderDriverClient");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F4, ImportType::Function, "XAudioUnregisterRenderDriverClient");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F5, ImportType::Function, "XAudioSubmitRenderDriverFrame");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F6, ImportType::Function, "XAudioRenderDriverLock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F7, ImportType::Function, "XAudioGetVoiceCategoryVolumeChangeMask");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F8, ImportType::Function, "XAudioGetVoiceCategoryVolume");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01F9, ImportType::Function, "XAudioSetVoiceCategoryVolume");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FA, ImportType::Function, "XAudioBeginDigitalBypassMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FB, ImportType::Function, "XAudioEndDigitalBypassMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FC, ImportType::Function, "XAudioSubmitDigitalPacket");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FD, ImportType::Function, "XAudioQueryDriverPerformance");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FE, ImportType::Function, "XAudioGetRenderDriverThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x01FF, ImportType::Function, "XAudioGetSpeakerConfig");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0200, ImportType::Function, "XAudioSetSpeakerConfig");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0201, ImportType::Function, "NicSetUnicastAddress");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0202, ImportType::Function, "NicAttach");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0203, ImportType::Function, "NicDetach");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0204, ImportType::Function, "NicXmit");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0205, ImportType::Function, "NicUpdateMcastMembership");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0206, ImportType::Function, "NicFlushXmitQueue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0207, ImportType::Function, "NicShutdown");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0208, ImportType::Function, "NicGetLinkState");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0209, ImportType::Function, "NicGetStats");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020A, ImportType::Function, "NicGetOpt");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020B, ImportType::Function, "NicSetOpt");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020C, ImportType::Function, "DrvSetSysReqCallback");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020D, ImportType::Function, "DrvSetUserBindingCallback");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020E, ImportType::Function, "DrvSetContentStorageCallback");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x020F, ImportType::Function, "DrvSetAutobind");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0210, ImportType::Function, "DrvGetContentStorageNotification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0211, ImportType::Function, "MtpdBeginTransaction");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0212, ImportType::Function, "MtpdCancelTransaction");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0213, ImportType::Function, "MtpdEndTransaction");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0214, ImportType::Function, "MtpdGetCurrentDevices");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0215, ImportType::Function, "MtpdReadData");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0216, ImportType::Function, "MtpdReadEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0217, ImportType::Function, "MtpdResetDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0218, ImportType::Function, "MtpdSendData");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0219, ImportType::Function, "MtpdVerifyProximity");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021A, ImportType::Function, "XUsbcamSetCaptureMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021B, ImportType::Function, "XUsbcamGetConfig");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021C, ImportType::Function, "XUsbcamSetConfig");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021D, ImportType::Function, "XUsbcamGetState");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021E, ImportType::Function, "XUsbcamReadFrame");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x021F, ImportType::Function, "XUsbcamSnapshot");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0220, ImportType::Function, "XUsbcamSetView");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0221, ImportType::Function, "XUsbcamGetView");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0222, ImportType::Function, "XUsbcamCreate");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0223, ImportType::Function, "XUsbcamDestroy");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0224, ImportType::Function, "XMACreateContext");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0225, ImportType::Function, "XMAInitializeContext");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0226, ImportType::Function, "XMAReleaseContext");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0227, ImportType::Function, "XMAEnableContext");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0228, ImportType::Function, "XMADisableContext");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0229, ImportType::Function, "XMAGetOutputBufferWriteOffset");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022A, ImportType::Function, "XMASetOutputBufferReadOffset");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022B, ImportType::Function, "XMAGetOutputBufferReadOffset");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022C, ImportType::Function, "XMASetOutputBufferValid");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022D, ImportType::Function, "XMAIsOutputBufferValid");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022E, ImportType::Function, "XMASetInputBuffer0Valid");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x022F, ImportType::Function, "XMAIsInputBuffer0Valid");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0230, ImportType::Function, "XMASetInputBuffer1Valid");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0231, ImportType::Function, "XMAIsInputBuffer1Valid");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0232, ImportType::Function, "XMASetInputBuffer0");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0233, ImportType::Function, "XMASetInputBuffer1");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0234, ImportType::Function, "XMAGetPacketMetadata");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0235, ImportType::Function, "XMABlockWhileInUse");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0236, ImportType::Function, "XMASetLoopData");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0237, ImportType::Function, "XMASetInputBufferReadOffset");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0238, ImportType::Function, "XMAGetInputBufferReadOffset");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0239, ImportType::Function, "ExIsBetaFeatureEnabled");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023A, ImportType::Function, "XeKeysGetFactoryChallenge");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023B, ImportType::Function, "XeKeysSetFactoryResponse");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023C, ImportType::Function, "XeKeysInitializeFuses");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023D, ImportType::Function, "XeKeysSaveBootLoader");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023E, ImportType::Function, "XeKeysSaveKeyVault");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x023F, ImportType::Function, "XeKeysGetStatus");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0240, ImportType::Function, "XeKeysGeneratePrivateKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0241, ImportType::Function, "XeKeysGetKeyProperties");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0242, ImportType::Function, "XeKeysSetKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0243, ImportType::Function, "XeKeysGenerateRandomKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0244, ImportType::Function, "XeKeysGetKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0245, ImportType::Function, "XeKeysGetDigest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0246, ImportType::Function, "XeKeysGetConsoleID");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0247, ImportType::Function, "XeKeysGetConsoleType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0248, ImportType::Function, "XeKeysQwNeRsaPrvCrypt");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0249, ImportType::Function, "XeKeysHmacSha");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024A, ImportType::Function, "XInputdPassThroughRFCommand");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024B, ImportType::Function, "XeKeysAesCbc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024C, ImportType::Function, "XeKeysDes2Cbc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024D, ImportType::Function, "XeKeysDesCbc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024E, ImportType::Function, "XeKeysObscureKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x024F, ImportType::Function, "XeKeysHmacShaUsingKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0250, ImportType::Function, "XeKeysSaveBootLoaderEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0251, ImportType::Function, "XeKeysAesCbcUsingKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0252, ImportType::Function, "XeKeysDes2CbcUsingKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0253, ImportType::Function, "XeKeysDesCbcUsingKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0254, ImportType::Function, "XeKeysObfuscate");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0255, ImportType::Function, "XeKeysUnObfuscate");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0256, ImportType::Function, "XeKeysConsolePrivateKeySign");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0257, ImportType::Function, "XeKeysConsoleSignatureVerification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0258, ImportType::Function, "XeKeysVerifyRSASignature");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0259, ImportType::Function, "StfsCreateDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025A, ImportType::Function, "StfsControlDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025B, ImportType::Function, "VdSwap");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025C, ImportType::Variable, "HalFsbInterruptCount");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025D, ImportType::Function, "XeKeysSaveSystemUpdate");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025E, ImportType::Function, "XeKeysLockSystemUpdate");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x025F, ImportType::Function, "XeKeysExecute");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0260, ImportType::Function, "XeKeysGetVersions");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0261, ImportType::Function, "XInputdPowerDownDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0262, ImportType::Function, "AniBlockOnAnimation");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0263, ImportType::Function, "AniTerminateAnimation");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0264, ImportType::Function, "XUsbcamReset");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0265, ImportType::Function, "AniSetLogo");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0266, ImportType::Variable, "KeCertMonitorData");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0267, ImportType::Function, "HalIsExecutingPowerDownDpc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0268, ImportType::Function, "VdInitializeEDRAM");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0269, ImportType::Function, "VdRetrainEDRAM");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026A, ImportType::Function, "VdRetrainEDRAMWorker");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026B, ImportType::Variable, "VdHSIOTrainCount");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026C, ImportType::Function, "HalGetPowerUpCause");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026D, ImportType::Variable, "VdHSIOTrainingStatus");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026E, ImportType::Variable, "RgcBindInfo");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x026F, ImportType::Function, "VdReadEEDIDBlock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0270, ImportType::Function, "VdEnumerateVideoModes");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0271, ImportType::Function, "VdEnableHDCP");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0272, ImportType::Function, "VdRegisterHDCPNotification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0273, ImportType::Function, "HidReadMouseChanges");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0274, ImportType::Function, "DumpSetCollectionFacility");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0275, ImportType::Function, "XexTransformImageKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0276, ImportType::Function, "XAudioOverrideSpeakerConfig");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0277, ImportType::Function, "XInputdReadTextKeystroke");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0278, ImportType::Function, "DrvXenonButtonPressed");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0279, ImportType::Function, "DrvBindToUser");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027A, ImportType::Function, "XexGetModuleImportVersions");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027B, ImportType::Function, "RtlComputeCrc32");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027C, ImportType::Function, "XeKeysSetRevocationList");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027D, ImportType::Function, "HalRegisterPowerDownCallback");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027E, ImportType::Function, "VdGetDisplayDiscoveryData");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x027F, ImportType::Function, "XInputdSendStayAliveRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0280, ImportType::Function, "XVoicedSendVPort");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0281, ImportType::Function, "XVoicedGetBatteryStatus");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0282, ImportType::Function, "XInputdFFGetDeviceInfo");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0283, ImportType::Function, "XInputdFFSetEffect");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0284, ImportType::Function, "XInputdFFUpdateEffect");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0285, ImportType::Function, "XInputdFFEffectOperation");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0286, ImportType::Function, "XInputdFFDeviceControl");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0287, ImportType::Function, "XInputdFFSetDeviceGain");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0288, ImportType::Function, "XInputdFFCancelIo");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0289, ImportType::Function, "XInputdFFSetRumble");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028A, ImportType::Function, "NtAllocateEncryptedMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028B, ImportType::Function, "NtFreeEncryptedMemory");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028C, ImportType::Function, "XeKeysExSaveKeyVault");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028D, ImportType::Function, "XeKeysExSetKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028E, ImportType::Function, "XeKeysExGetKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x028F, ImportType::Function, "DrvSetDeviceConfigChangeCallback");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0290, ImportType::Function, "DrvDeviceConfigChange");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0291, ImportType::Function, "HalRegisterHdDvdRomNotification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0292, ImportType::Function, "XeKeysSecurityInitialize");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0293, ImportType::Function, "XeKeysSecurityLoadSettings");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0294, ImportType::Function, "XeKeysSecuritySaveSettings");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0295, ImportType::Function, "XeKeysSecuritySetDetected");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0296, ImportType::Function, "XeKeysSecurityGetDetected");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0297, ImportType::Function, "XeKeysSecuritySetActivated");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0298, ImportType::Function, "XeKeysSecurityGetActivated");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0299, ImportType::Function, "XeKeysDvdAuthAP25InstallTable");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029A, ImportType::Function, "XeKeysDvdAuthAP25GetTableVersion");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029B, ImportType::Function, "XeKeysGetProtectedFlag");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029C, ImportType::Function, "XeKeysSetProtectedFlag");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029D, ImportType::Function, "KeEnablePFMInterrupt");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029E, ImportType::Function, "KeDisablePFMInterrupt");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x029F, ImportType::Function, "KeSetProfilerISR");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A0, ImportType::Function, "VdStartDisplayDiscovery");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A1, ImportType::Function, "VdSetHDCPRevocationList");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A2, ImportType::Function, "XeKeysGetUpdateSequence");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A3, ImportType::Function, "XeKeysDvdAuthExActivate");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A4, ImportType::Function, "KeGetImagePageTableEntry");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A5, ImportType::Function, "HalRegisterBackgroundModeTransitionCallback");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A6, ImportType::Function, "AniStartBootAnimation");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A7, ImportType::Function, "HalClampUnclampOutputDACs");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A8, ImportType::Function, "HalPowerDownToBackgroundMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02A9, ImportType::Function, "HalNotifyAddRemoveBackgroundTask");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AA, ImportType::Function, "HalCallBackgroundModeNotificationRoutines");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AB, ImportType::Variable, "HalFsbResetCount");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AC, ImportType::Function, "HalGetMemoryInformation");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AD, ImportType::Function, "XInputdGetLastTextInputTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AE, ImportType::Function, "VdEnableWMAProOverHDMI");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02AF, ImportType::Function, "XeKeysRevokeSaveSettings");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B0, ImportType::Function, "XInputdSetTextMessengerIndicator");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B1, ImportType::Function, "MicDeviceRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B2, ImportType::Function, "XeKeysGetMediaID");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B3, ImportType::Function, "XeKeysLoadKeyVault");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B4, ImportType::Function, "KeGetVidInfo");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B5, ImportType::Function, "HalNotifyBackgroundModeTransitionComplete");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B6, ImportType::Function, "IoAcquireCancelSpinLock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B7, ImportType::Function, "IoReleaseCancelSpinLock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B8, ImportType::Function, "NtCancelIoFile");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02B9, ImportType::Function, "NtCancelIoFileEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BA, ImportType::Function, "HalFinalizePowerLossRecovery");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BB, ImportType::Function, "HalSetPowerLossRecovery");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BC, ImportType::Function, "ExReadModifyWriteXConfigSettingUlong");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BD, ImportType::Function, "HalRegisterXamPowerDownCallback");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BE, ImportType::Function, "ExCancelAlarm");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02BF, ImportType::Function, "ExInitializeAlarm");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C0, ImportType::Function, "ExSetAlarm");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C1, ImportType::Function, "XexActivationGetNonce");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C2, ImportType::Function, "XexActivationSetLicense");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C3, ImportType::Function, "IptvSetBoundaryKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C4, ImportType::Function, "IptvSetSessionKey");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C5, ImportType::Function, "IptvVerifyOmac1Signature");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C6, ImportType::Function, "IptvGetAesCtrTransform");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C7, ImportType::Function, "SataCdRomRecordReset");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C8, ImportType::Function, "XInputdSetTextDeviceKeyLocks");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02C9, ImportType::Function, "XInputdGetTextDeviceKeyLocks");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CA, ImportType::Function, "XexActivationVerifyOwnership");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CB, ImportType::Function, "XexDisableVerboseDbgPrint");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CC, ImportType::Function, "SvodCreateDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CD, ImportType::Function, "RtlCaptureStackBackTrace");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CE, ImportType::Function, "XeKeysRevokeUpdateDynamic");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02CF, ImportType::Function, "XexImportTraceEnable");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D0, ImportType::Function, "ExRegisterXConfigNotification");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D1, ImportType::Function, "XeKeysSecuritySetStat");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D2, ImportType::Function, "VdQueryRealVideoMode");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D3, ImportType::Function, "XexSetExecutablePrivilege");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D4, ImportType::Function, "XAudioSuspendRenderDriverClients");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D5, ImportType::Function, "IptvGetSessionKeyHash");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D6, ImportType::Function, "VdSetCGMSState");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D7, ImportType::Function, "VdSetSCMSState");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D8, ImportType::Function, "KeFlushMultipleTb");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02D9, ImportType::Function, "VdGetOption");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DA, ImportType::Function, "VdSetOption");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DB, ImportType::Variable, "UsbdBootEnumerationDoneEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DC, ImportType::Variable, "StfsDeviceErrorEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DD, ImportType::Function, "ExTryToAcquireReadWriteLockExclusive");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DE, ImportType::Function, "ExTryToAcquireReadWriteLockShared");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02DF, ImportType::Function, "XexSetLastKdcTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E0, ImportType::Function, "XInputdControl");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E1, ImportType::Function, "RmcDeviceRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E2, ImportType::Function, "LDIResetDecompression");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E3, ImportType::Function, "NicRegisterDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E4, ImportType::Function, "UsbdAddDeviceComplete");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E5, ImportType::Function, "UsbdCancelAsyncTransfer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E6, ImportType::Function, "UsbdGetDeviceSpeed");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E7, ImportType::Function, "UsbdGetDeviceTopology");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E8, ImportType::Function, "UsbdGetEndpointDescriptor");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02E9, ImportType::Function, "UsbdIsDeviceAuthenticated");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02EA, ImportType::Function, "UsbdOpenDefaultEndpoint");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02EB, ImportType::Function, "UsbdOpenEndpoint");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02EC, ImportType::Function, "UsbdQueueAsyncTransfer");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02ED, ImportType::Function, "UsbdQueueCloseDefaultEndpoint");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02EE, ImportType::Function, "UsbdQueueCloseEndpoint");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02EF, ImportType::Function, "UsbdRemoveDeviceComplete");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F0, ImportType::Function, "KeRemoveQueueApc");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F1, ImportType::Variable, "UsbdDriverLoadRequiredEvent");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F2, ImportType::Function, "UsbdGetRequiredDrivers");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F3, ImportType::Function, "UsbdRegisterDriverObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F4, ImportType::Function, "UsbdUnregisterDriverObject");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F5, ImportType::Function, "UsbdCallAndBlockOnDpcRoutine");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F6, ImportType::Function, "UsbdResetDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F7, ImportType::Function, "UsbdGetDeviceDescriptor");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F8, ImportType::Function, "NomnilGetExtension");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02F9, ImportType::Function, "NomnilStartCloseDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FA, ImportType::Function, "WifiBeginAuthentication");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FB, ImportType::Function, "WifiCheckCounterMeasures");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FC, ImportType::Function, "WifiChooseAuthenCipherSetFromBSSID");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FD, ImportType::Function, "WifiCompleteAuthentication");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FE, ImportType::Function, "WifiGetAssociationIE");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x02FF, ImportType::Function, "WifiOnMICError");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0300, ImportType::Function, "WifiPrepareAuthenticationContext");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0301, ImportType::Function, "WifiRecvEAPOLPacket");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0302, ImportType::Function, "WifiDeduceNetworkType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0303, ImportType::Function, "NicUnregisterDevice");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0304, ImportType::Function, "DumpXitThread");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0305, ImportType::Function, "XInputdSetWifiChannel");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0306, ImportType::Function, "NomnilSetLed");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0307, ImportType::Function, "WifiCalculateRegulatoryDomain");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0308, ImportType::Function, "WifiSelectAdHocChannel");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0309, ImportType::Function, "WifiChannelToFrequency");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030A, ImportType::Function, "MmGetPoolPagesType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030B, ImportType::Function, "ExExpansionInstall");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030C, ImportType::Function, "ExExpansionCall");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030D, ImportType::Function, "PsCamDeviceRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030E, ImportType::Function, "McaDeviceRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x030F, ImportType::Function, "DetroitDeviceRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0310, ImportType::Function, "XeCryptSha256Init");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0311, ImportType::Function, "XeCryptSha256Update");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0312, ImportType::Function, "XeCryptSha256Final");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0313, ImportType::Function, "XeCryptSha256");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0314, ImportType::Function, "XeCryptSha384Init");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0315, ImportType::Function, "XeCryptSha384Update");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0316, ImportType::Function, "XInputdGetDevicePid");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0317, ImportType::Function, "HalGetNotedArgonErrors");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0318, ImportType::Function, "XeCryptSha384Final");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0319, ImportType::Function, "HalReadArgonEeprom");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031A, ImportType::Function, "HalWriteArgonEeprom");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031B, ImportType::Function, "XeKeysFcrtLoad");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031C, ImportType::Function, "XeKeysFcrtSave");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031D, ImportType::Function, "XeKeysFcrtSet");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031E, ImportType::Function, "XeCryptSha384");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x031F, ImportType::Function, "XeCryptSha512Init");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0320, ImportType::Function, "XAudioRegisterRenderDriverMECClient");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0321, ImportType::Function, "XAudioUnregisterRenderDriverMECClient");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0322, ImportType::Function, "XAudioCaptureRenderDriverFrame");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0323, ImportType::Function, "XeCryptSha512Update");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0324, ImportType::Function, "XeCryptSha512Final");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0325, ImportType::Function, "XeCryptSha512");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0326, ImportType::Function, "XeCryptBnQwNeCompare");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0327, ImportType::Function, "XVoicedGetDirectionalData");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0328, ImportType::Function, "DrvSetMicArrayStartCallback");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0329, ImportType::Function, "DevAuthGetStatistics");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032A, ImportType::Function, "NullCableRequest");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032B, ImportType::Function, "XeKeysRevokeIsDeviceRevoked");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032C, ImportType::Function, "DumpUpdateDumpSettings");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032D, ImportType::Function, "EtxConsumerDisableEventType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032E, ImportType::Function, "EtxConsumerEnableEventType");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x032F, ImportType::Function, "EtxConsumerProcessLogs");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0330, ImportType::Function, "EtxConsumerRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0331, ImportType::Function, "EtxConsumerUnregister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0332, ImportType::Function, "EtxProducerLog");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0333, ImportType::Function, "EtxProducerLogV");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0334, ImportType::Function, "EtxProducerRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0335, ImportType::Function, "EtxProducerUnregister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0336, ImportType::Function, "EtxConsumerFlushBuffers");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0337, ImportType::Function, "EtxProducerLogXwpp");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0338, ImportType::Function, "EtxProducerLogXwppV");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0339, ImportType::Function, "UsbdEnableDisableRootHubPort");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033A, ImportType::Function, "EtxBufferRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033B, ImportType::Function, "EtxBufferUnregister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033C, ImportType::Function, "DumpRegisterDedicatedDataBlock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033D, ImportType::Function, "XeKeysDvdAuthExSave");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033E, ImportType::Function, "XeKeysDvdAuthExInstall");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x033F, ImportType::Function, "XexShimDisable");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0340, ImportType::Function, "XexShimEnable");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0341, ImportType::Function, "XexShimEntryDisable");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0342, ImportType::Function, "XexShimEntryEnable");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0343, ImportType::Function, "XexShimEntryRegister");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0344, ImportType::Function, "XexShimLock");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0345, ImportType::Variable, "XboxKrnlVersion4Digit");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0346, ImportType::Function, "XeKeysObfuscateEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0347, ImportType::Function, "XeKeysUnObfuscateEx");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0348, ImportType::Function, "XexTitleHash");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0349, ImportType::Function, "XexTitleHashClose");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034A, ImportType::Function, "XexTitleHashContinue");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034B, ImportType::Function, "XexTitleHashOpen");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034C, ImportType::Function, "XAudioGetRenderDriverTic");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034D, ImportType::Function, "XAudioEnableDucker");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034E, ImportType::Function, "XAudioSetDuckerLevel");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x034F, ImportType::Function, "XAudioIsDuckerEnabled");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0350, ImportType::Function, "XAudioGetDuckerLevel");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0351, ImportType::Function, "XAudioGetDuckerThreshold");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0352, ImportType::Function, "XAudioSetDuckerThreshold");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0353, ImportType::Function, "XAudioGetDuckerAttackTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0354, ImportType::Function, "XAudioSetDuckerAttackTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0355, ImportType::Function, "XAudioGetDuckerReleaseTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0356, ImportType::Function, "XAudioSetDuckerReleaseTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0357, ImportType::Function, "XAudioGetDuckerHoldTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0358, ImportType::Function, "XAudioSetDuckerHoldTime");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x0359, ImportType::Function, "DevAuthShouldAlwaysEnforce");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x035A, ImportType::Function, "XAudioGetUnderrunCount");
-    LOAD_IMPORT(XboxLibrary::XboxKrnl, 0x035C, ImportType::Function, "XVoicedIsActiveProcess");
-
-
+    if (libName.find("xboxkrnl") != std::string::npos)
+    {
+        lib = XboxLibrary::XboxKrnl;
+    }
+    else if (libName.find("xam") != std::string::npos)
+    {
+        lib = XboxLibrary::Xam;
+    }
+    else if (libName.find("xbdm") != std::string::npos)
+    {
+        lib = XboxLibrary::Xbdm;
+    }
+    else if (libName.find("xapi") != std::string::npos)
+    {
+        lib = XboxLibrary::Xapi;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
 
-    // xbmd
+inline const ImportEntry* findImport_FromLib(const std::string& libName, uint32_t ordinal)
+{
+    XboxLibrary lib;
+    if (!findImportLibrary(libName, lib))
+    {
+        printf("No Lib with name: %s found\n", libName.c_str());
+        return nullptr;
+    }
 
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0001, ImportType::Function, "DmAllocatePool");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0002, ImportType::Function, "DmAllocatePoolWithTag");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0003, ImportType::Function, "DmCloseCounters");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0004, ImportType::Function, "DmCloseModuleSections");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0005, ImportType::Function, "DmCloseModuleSections");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0006, ImportType::Function, "DmCloseNotificationSession");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0007, ImportType::Function, "DmClosePerformanceCounter");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0008, ImportType::Function, "DmContinueThread");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0009, ImportType::Function, "DmFreePool");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x000A, ImportType::Function, "DmGetMemory");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x000B, ImportType::Function, "DmGetModuleLongName");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x000C, ImportType::Function, "DmGetProcAddress");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x000D, ImportType::Function, "DmGetThreadContext");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x000F, ImportType::Function, "DmGetThreadList");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0010, ImportType::Function, "DmGetXbeInfo");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0011, ImportType::Function, "DmGetXboxName");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0013, ImportType::Function, "DmGo");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0014, ImportType::Function, "DmHaltThread");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0015, ImportType::Function, "DmIsDebuggerPresent");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0016, ImportType::Function, "DmIsThreadStopped");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0017, ImportType::Function, "DmLoadExtension");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0018, ImportType::Function, "DmNotify");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0019, ImportType::Function, "DmOpenNotificationSession");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x001A, ImportType::Function, "DmOpenPerformanceCounter");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x001B, ImportType::Function, "DmQueryPerformanceCounterHandle");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x001C, ImportType::Function, "DmReboot");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x001E, ImportType::Function, "DmRegisterCommandProcessor");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0020, ImportType::Function, "DmRegisterNotificationProcessor");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0021, ImportType::Function, "DmRegisterPerformanceCounter");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0022, ImportType::Function, "DmRemoveBreakpoint");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0023, ImportType::Function, "DmResumeThread");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0024, ImportType::Function, "DmSendNotificationString");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0025, ImportType::Function, "DmSetBreakpoint");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0026, ImportType::Function, "DmSetDataBreakpoint");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0027, ImportType::Function, "DmSetInitialBreakpoint");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0028, ImportType::Function, "DmSetMemory");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0029, ImportType::Function, "DmSetThreadContext");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x002A, ImportType::Function, "DmSetTitle");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x002B, ImportType::Function, "DmSetXboxName");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x002D, ImportType::Function, "DmStop");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x002E, ImportType::Function, "DmStopOn");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0030, ImportType::Function, "DmSuspendThread");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0031, ImportType::Function, "DmThreadUserData");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0032, ImportType::Function, "DmUnloadExtension");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0033, ImportType::Function, "DmWalkLoadedModules");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0034, ImportType::Function, "DmWalkModuleSections");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0035, ImportType::Function, "DmWalkPerformanceCounters");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0037, ImportType::Function, "DmCloseCounters");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0038, ImportType::Function, "DmIsBreakpoint");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0039, ImportType::Function, "DmCloseCounters");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003A, ImportType::Function, "DmSetUserAccess");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003B, ImportType::Function, "DmGetUserAccess");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003C, ImportType::Function, "DmWalkUserList");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003D, ImportType::Function, "DmAddUser");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003E, ImportType::Function, "DmEnableSecurity");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x003F, ImportType::Function, "DmIsSecurityEnabled");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0040, ImportType::Function, "DmRemoveUser");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0041, ImportType::Function, "__CAP_Start_Profiling");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0042, ImportType::Function, "__CAP_End_Profiling");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0046, ImportType::Function, "__CAP_Enter_ImportType::Function");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0047, ImportType::Function, "__CAP_Exit_ImportType::Function");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0048, ImportType::Function, "DmRegisterCommandProcessorEx");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0049, ImportType::Function, "DmStartProfiling");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004A, ImportType::Function, "DmStopProfiling");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004B, ImportType::Function, "DmQueryMemoryStatistics");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004C, ImportType::Function, "DmEnableStackTrace");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004D, ImportType::Function, "DmQueryAllocationTypeName");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004E, ImportType::Function, "DmRegisterAllocationType");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x004F, ImportType::Function, "DmInsertAllocationEntry");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0050, ImportType::Function, "DmRemoveAllocationEntry");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0051, ImportType::Function, "DmSetTitleEx");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0052, ImportType::Function, "DmCaptureStackBackTrace");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0053, ImportType::Function, "DmCrashDump");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0054, ImportType::Function, "DmIsFastCAPEnabled");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0055, ImportType::Function, "DmGetFileAccessCount");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0058, ImportType::Function, "DmGetUtilityDriveInfo");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0059, ImportType::Function, "DmGetThreadInfoEx");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x005A, ImportType::Function, "DmSetProfilingOptions");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x005B, ImportType::Function, "DmQuerySystemSettings");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x005C, ImportType::Function, "DmSaveSystemSettings");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006A, ImportType::Function, "DmpGetPgoModuleHandleForBaseAddress");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006B, ImportType::Function, "DmpOnPgoModuleLoad");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006C, ImportType::Function, "DmPgoStartDataCollection");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006D, ImportType::Function, "DmPgoStopDataCollection");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006E, ImportType::Function, "DmPgoSaveSnapshot");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x006F, ImportType::Function, "IrtClientAbort");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0070, ImportType::Function, "IrtPogoInit");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0071, ImportType::Function, "IrtSetStaticInfo");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0072, ImportType::Function, "IrtAutoSweepW");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0073, ImportType::Function, "IrtAutoSweepA");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0075, ImportType::Function, "DmGetDumpMode");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0076, ImportType::Function, "DmSetDumpMode");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0077, ImportType::Function, "DmGetDumpSettings");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0078, ImportType::Function, "DmSetDumpSettings");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0079, ImportType::Function, "DmGetEventDeferFlags");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x007A, ImportType::Function, "DmSetEventDeferFlags");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x007B, ImportType::Function, "DmWalkCommittedMemory");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x007C, ImportType::Function, "DmCloseCounters");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x007D, ImportType::Function, "DmRebootEx");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0082, ImportType::Function, "DmMountFdfxVolume");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0083, ImportType::Function, "DmCapGetFileHeader");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0084, ImportType::Function, "DmCapFreeFileHeader");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0085, ImportType::Function, "DmTraceStartRecording");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0086, ImportType::Function, "DmTraceStartRecordingImportType::Function");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0087, ImportType::Function, "DmTraceSetBufferSize");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0088, ImportType::Function, "DmTraceStopRecording");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0089, ImportType::Function, "DmTraceSaveBuffer");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x008C, ImportType::Function, "DmGetConsoleType");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x008D, ImportType::Function, "DmMapDevkitDrive");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x008E, ImportType::Function, "DmWalkLoadedModulesEx");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x008F, ImportType::Function, "DmGetXexHeaderField");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0090, ImportType::Function, "DmGetMouseChanges");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0091, ImportType::Function, "DmFindPdbSignature");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0092, ImportType::Function, "DmGetProfilingStatus");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0093, ImportType::Function, "DmOpticalDiscLogStart");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0094, ImportType::Function, "DmOpticalDiscLogStop");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0095, ImportType::Function, "DmStartSamplingProfiler");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0096, ImportType::Function, "DmStopSamplingProfiler");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0097, ImportType::Function, "DmGetSamplingProfilerInfo");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0098, ImportType::Function, "DmStartFileEventCapture");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0099, ImportType::Function, "DmStopFileEventCapture");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009A, ImportType::Function, "DmSetFileEventMarker");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009B, ImportType::Function, "DmMarkPseudoCreateBegin");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009C, ImportType::Function, "DmMarkPseudoCreateEnd");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009D, ImportType::Function, "DmMarkPseudoEventBegin");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009E, ImportType::Function, "DmMarkPseudoEventEnd");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x009F, ImportType::Function, "DmMarkFileEventWorkerThreadBegin");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A0, ImportType::Function, "DmMarkFileEventWorkerThreadEnd");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A1, ImportType::Function, "DmGetSystemInfo");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A2, ImportType::Function, "DmAbortProfiling");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A3, ImportType::Function, "DmNetCaptureStart");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A4, ImportType::Function, "DmNetCaptureStop");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A5, ImportType::Function, "DmQueryTitleMemoryStatistics");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A6, ImportType::Function, "DmAutomationGetInputProcess");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A7, ImportType::Function, "DmAutomationBindController");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A8, ImportType::Function, "DmAutomationUnbindController");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00A9, ImportType::Function, "DmAutomationConnectController");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AA, ImportType::Function, "DmAutomationDisconnectController");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AB, ImportType::Function, "DmAutomationSetGamepadState");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AC, ImportType::Function, "DmAutomationQueueGamepadState");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AD, ImportType::Function, "DmAutomationClearGamepadQueue");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AE, ImportType::Function, "DmAutomationQueryGamepadQueue");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00AF, ImportType::Function, "DmAutomationGetUserDefaultProfile");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B0, ImportType::Function, "DmAutomationSetUserDefaultProfile");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B1, ImportType::Function, "DmTraceIsRecording");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B2, ImportType::Function, "DmLoadDebuggerExtension");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B3, ImportType::Function, "DmUnloadDebuggerExtension");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B4, ImportType::Function, "DmCreateSystemThread");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B5, ImportType::Function, "PEPLELookup");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B6, ImportType::Function, "PEPLELookupCompact");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B7, ImportType::Function, "PVPLELookup");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B8, ImportType::Function, "PVPLELookupCompact");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00B9, ImportType::Function, "PVPLELookupCompactMDS");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BA, ImportType::Function, "PVPLEFilteredLookup");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BB, ImportType::Function, "PVPLEFilteredLookupCompact");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BC, ImportType::Function, "PVPLEFilteredLookupCompactMDS");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BD, ImportType::Function, "PVPLETemplatedLookup");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BE, ImportType::Function, "PVPLETemplatedLookupCompact");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00BF, ImportType::Function, "PVPLETemplatedLookupCompactMDS");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C0, ImportType::Function, "DmpPgoCounterOverflow");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C1, ImportType::Function, "UpdateMDSProbeState");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C2, ImportType::Function, "DmGetHttpRegistration");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C3, ImportType::Function, "DmTraceSetIOThread");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C4, ImportType::Function, "DmPMCInstallAndStart");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C5, ImportType::Function, "DmPMCStopAndReport");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C6, ImportType::Function, "DmPMCInstallSetup");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C7, ImportType::Function, "DmPMCUnInstallSetup");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C8, ImportType::Function, "DmPMCResetCounters");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00C9, ImportType::Function, "DmPMCSetTriggerProcessor");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CA, ImportType::Function, "DmPMCStart");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CB, ImportType::Function, "DmPMCStop");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CC, ImportType::Function, "DmPMCGetCounter");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CD, ImportType::Function, "DmPMCGetCounters");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CE, ImportType::Function, "DmPMCGetCounterName");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00CF, ImportType::Function, "DmPMCDumpCounters");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D0, ImportType::Function, "DmPMCDumpCountersVerbose");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D1, ImportType::Function, "DmPMCGetCounterCostEstimate");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D2, ImportType::Function, "DmPMCGetCounterSource");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D3, ImportType::Function, "DmPMCComputeFrequency");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D4, ImportType::Function, "DmGetAdditionalTitleMemorySetting");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D5, ImportType::Function, "DmGetDebugMemorySize");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D6, ImportType::Function, "DmGetConsoleDebugMemoryStatus");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D7, ImportType::Function, "DmNetSimSetLinkStatusHidden");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D8, ImportType::Function, "DmNetSimInsertQueue");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00D9, ImportType::Function, "DmNetSimRemoveQueue");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DA, ImportType::Function, "DmNetSimRemoveAllQueues");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DB, ImportType::Function, "DmNetSimModifyQueueSettings");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DC, ImportType::Function, "DmGetConsoleFeatures");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DD, ImportType::Function, "DmNetSimGetQueueStats");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DE, ImportType::Function, "DmNetSimGetQueueSettings");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00DF, ImportType::Function, "DmNetSimGetNumQueues");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00E0, ImportType::Function, "DmNetSimInsertIpv4Redirect");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00E1, ImportType::Function, "DmNetSimRemoveIpv4Redirect");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x00E2, ImportType::Function, "DmNetSimGetNumIpv4Redirects");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x012C, ImportType::Function, "XLFAllocate");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x012D, ImportType::Function, "XLFFree");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x012E, ImportType::Function, "XLFQueueAdd");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x012F, ImportType::Function, "XLFQueueAllocated");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0130, ImportType::Function, "XLFQueueCreate");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0131, ImportType::Function, "XLFQueueDestroy");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0132, ImportType::Function, "XLFQueueGetEntryCount");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0133, ImportType::Function, "XLFQueueIsEmpty");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0134, ImportType::Function, "XLFQueueRemove");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0135, ImportType::Function, "XLFQueueUnsafeDump");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0136, ImportType::Function, "XLFStackAllocated");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0137, ImportType::Function, "XLFStackCreate");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0138, ImportType::Function, "XLFStackDestroy");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0139, ImportType::Function, "XLFStackGetEntryCount");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x013A, ImportType::Function, "XLFStackIsEmpty");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x013B, ImportType::Function, "XLFStackPop");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x013C, ImportType::Function, "XLFStackPush");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x013D, ImportType::Function, "XLFStackUnsafeDump");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0140, ImportType::Function, "XLFPriorityQueueAdd");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0141, ImportType::Function, "XLFPriorityQueueAllocated");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0142, ImportType::Function, "XLFPriorityQueueCreate");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0143, ImportType::Function, "XLFPriorityQueueDestroy");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0144, ImportType::Function, "XLFPriorityQueueGetEntryCount");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0145, ImportType::Function, "XLFPriorityQueueIsEmpty");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0146, ImportType::Function, "XLFPriorityQueueRemoveFirst");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0147, ImportType::Function, "XLFPriorityQueueRemove");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0148, ImportType::Function, "XLFPriorityQueueUnsafeDump");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014A, ImportType::Function, "XLFHashTableAdd");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014B, ImportType::Function, "XLFHashTableAllocated");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014C, ImportType::Function, "XLFHashTableCreate");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014D, ImportType::Function, "XLFHashTableDestroy");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014E, ImportType::Function, "XLFHashTableGetEntryCount");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x014F, ImportType::Function, "XLFHashTableIsEmpty");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0150, ImportType::Function, "XLFHashTableRemoveFirst");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0151, ImportType::Function, "XLFHashTableRemove");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0152, ImportType::Function, "XLFHashTableUnsafeDump");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0154, ImportType::Function, "XLFPoolAcquireLock");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0155, ImportType::Function, "XLFPoolAllocated");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0156, ImportType::Function, "XLFPoolCreate");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0157, ImportType::Function, "XLFPoolCreateLock");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0158, ImportType::Function, "XLFPoolDestroy");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0159, ImportType::Function, "XLFPoolDestroyLock");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015A, ImportType::Function, "XLFPoolIncreaseEvents");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015B, ImportType::Function, "XLFPoolIncreaseLocks");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015C, ImportType::Function, "XLFPoolInitializeLock");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015D, ImportType::Function, "XLFPoolNumberOfEvents");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015E, ImportType::Function, "XLFPoolNumberOfLocks");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x015F, ImportType::Function, "XLFPoolReleaseLock");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0163, ImportType::Function, "XLFStartLog");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0164, ImportType::Function, "XLFStartUserLog");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0165, ImportType::Function, "XLFInitializeLog");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0166, ImportType::Function, "XLFInitializeUserLog");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0168, ImportType::Function, "XLFEndLog");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0169, ImportType::Function, "XLFLogPrint");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x016A, ImportType::Function, "XLFLogPrintV");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x016B, ImportType::Function, "XLFLogBuffer");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x016C, ImportType::Function, "XLFLogMessageStats");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0172, ImportType::Function, "XLockFreeGetErrorHandler");
-    LOAD_IMPORT(XboxLibrary::Xbdm, 0x0173, ImportType::Function, "XLockFreeSetErrorHandler");
-}
\ No newline at end of file
+    const ImportEntry* entry = findImport(lib, ordinal);
+    if (!entry)
+    {
+        printf("No Import in Lib: %s with ordinal %u found\n", libName.c_str(), ordinal);
+    }
+    return entry;
+}
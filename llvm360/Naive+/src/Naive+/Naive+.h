@@ -1,7 +1,12 @@
 #pragma once 
 #include <vector>
 #include <string>
+#include <memory>
+#include <algorithm>
+#include <utility>
+#include <bit>
 #include <stdint.h>
+#include "Decoder/InstructionRegistry.h"
 
 
 //#ifndef NAIVE_EXPORT
@@ -13,7 +18,7 @@
 //#endif
 
 
-struct Instruction;
+namespace XLoader { class IImage; }
 
 enum BinaryType
 {
@@ -30,9 +35,137 @@ struct PBinaryHandle
 	std::wstring m_imagePath;
 	BinaryType m_type;
 	uint32_t m_ID;
-	//std::vector<Instruction> m_binInstr;
+
+	// instructions of one executable section as parallel arrays, index i is the word at m_address + i * 4
+	// Instruction(m_opcodes[i], m_words[i]) rebuilds the record
+	// the arrays are allocated once and filled by several threads, each one owning a range of addresses
+	struct CodeSection
+	{
+		std::string m_name;
+		uint32_t m_address;
+		size_t m_count = 0;
+		std::vector<uint16_t> m_opcodes;	// OpcodeID, OPCODE_INVALID for words that aren't known instructions
+		std::vector<uint32_t> m_words;		// host byte order
+		std::vector<uint64_t> m_valid;		// bit i set when m_opcodes[i] is a known instruction
+		size_t m_unknownCount = 0;			// clear bits of m_valid, words that were skipped
+		std::vector<uint16_t> m_flags;		// INSTR_* classification of every instruction
+		std::vector<uint64_t> m_flagBits[INSTR_FLAG_COUNT];	// [f] has bit i set when m_flags[i] has bit f
+
+		bool contains(uint32_t address) const { return address >= m_address && (address - m_address) / 4 < m_count; }
+		size_t indexOf(uint32_t address) const { return (address - m_address) / 4; }
+		bool isValid(size_t index) const { return (m_valid[index / 64] >> (index % 64)) & 1; }
+
+		// first set bit of <bits> at or after <index>, m_count if there is none
+		size_t nextSet(const std::vector<uint64_t>& bits, size_t index) const
+		{
+			if (index >= m_count)
+				return m_count;
+			size_t word = index / 64;
+			uint64_t pending = bits[word] & (~0ull << (index % 64));
+			while (pending == 0)
+			{
+				if (++word == bits.size())
+					return m_count;
+				pending = bits[word];
+			}
+			size_t found = word * 64 + std::countr_zero(pending);
+			return found < m_count ? found : m_count;
+		}
+	};
+	std::vector<CodeSection> m_code;
+
+	// code section that holds <address>, nullptr if none
+	const CodeSection* findCode(uint32_t address) const
+	{
+		for (const CodeSection& section : m_code)
+		{
+			if (section.contains(address))
+				return &section;
+		}
+		return nullptr;
+	}
+
+	// direct references between guest addresses, collected while the code sections are decoded
+	// entry i is m_sources[i] -> m_targets[i], sorted by target then source so the references to one
+	// address are a contiguous range found with a binary search
+	struct XrefIndex
+	{
+		enum Kind : uint8_t
+		{
+			XREF_BRANCH,		// b
+			XREF_CONDITIONAL,	// bc
+			XREF_CALL,			// bl, bcl
+			XREF_ADDRESS,		// lis + addi / ori building an address inside a code section
+		};
+
+		std::vector<uint32_t> m_targets;
+		std::vector<uint32_t> m_sources;
+		std::vector<uint8_t> m_kinds;
+
+		size_t size() const { return m_targets.size(); }
+		// index of the first reference to an address >= <address>, size() if there is none
+		size_t lowerBound(uint32_t address) const { return std::lower_bound(m_targets.begin(), m_targets.end(), address) - m_targets.begin(); }
+		// [first, last) indices of the references to <target>
+		std::pair<size_t, size_t> find(uint32_t target) const
+		{
+			auto range = std::equal_range(m_targets.begin(), m_targets.end(), target);
+			return { (size_t)(range.first - m_targets.begin()), (size_t)(range.second - m_targets.begin()) };
+		}
+		bool isTarget(uint32_t target) const { return std::binary_search(m_targets.begin(), m_targets.end(), target); }
+		bool isTarget(uint32_t target, Kind kind) const
+		{
+			auto [first, last] = find(target);
+			for (size_t i = first; i < last; i++)
+			{
+				if (m_kinds[i] == kind)
+					return true;
+			}
+			return false;
+		}
+	};
+	XrefIndex m_xrefs;
+
+	// one function of the image, [m_address, m_end)
+	struct Function
+	{
+		enum Source : uint8_t
+		{
+			FUNCTION_ENTRY,		// the image entry point
+			FUNCTION_EXPORT,
+			FUNCTION_PDATA,		// exact bounds from .pdata
+			FUNCTION_CALL,		// target of a bl (or a tail branch) in discovered code
+		};
+
+		uint32_t m_address;
+		uint32_t m_end;		// one past the last instruction, 0 until the function was scanned
+		Source m_source;
+
+		bool contains(uint32_t address) const { return address >= m_address && address < m_end; }
+	};
+	// sorted by address and not overlapping, complete before anything is emitted (Analysis::DiscoverFunctions)
+	std::vector<Function> m_functions;
+
+	// function that contains <address>, nullptr if none
+	const Function* findFunction(uint32_t address) const
+	{
+		auto it = std::upper_bound(m_functions.begin(), m_functions.end(), address,
+			[](uint32_t addr, const Function& func) { return addr < func.m_address; });
+		if (it == m_functions.begin() || !(it - 1)->contains(address))
+			return nullptr;
+		return &*(it - 1);
+	}
+
+	// the loaded image, kept alive so its memory stays at m_guestBase + base address
+	std::shared_ptr<XLoader::IImage> m_image;
+	// host address of guest address 0 when the image is in the guest window at GuestWindow::PreferredBase,
+	// 0 otherwise (no window, or one at another address) so translated code reads moduleBase
+	uint64_t m_guestBase = 0;
+	// XXH3-128 of the image file in hex, the name of its entry in ./cache
+	std::string m_contentHash;
 
 	void LoadBinary();
+	// take an image that was already loaded (at its guest address) and decode it
+	void AttachImage(std::shared_ptr<XLoader::IImage> image);
 	void RecompileBinary();
 };
 
@@ -42,3 +175,15 @@ struct PBinaryHandle
 	// used also to load cached binaries <useCache> (true)
 	// the PBinaryHandle is generated everytime the binary it's translated or reloaded from cache
 	NAIVE_EXPORT PBinaryHandle* TranslateBinary(std::wstring path, bool useCache = false, bool isKernel = false);
+
+	// Translate every module of a title (default.xex and its xex DLLs), the images are loaded concurrently
+	// returns one handle per path, in the same order
+	NAIVE_EXPORT std::vector<PBinaryHandle*> TranslateBinaries(std::vector<std::wstring> paths);
+
+	// Load the binary at <path> <iterations> times and print the loader throughput (MB/s) of each run
+	// and the cost of the page digest checks (skipped when <verifyDigests> is false)
+	NAIVE_EXPORT void BenchmarkLoader(std::wstring path, int iterations = 5, bool verifyDigests = true);
+
+	// Decode the executable sections of the binary at <path> with the scalar, the batch (AVX2) and the parallel decoder
+	// and print the throughput of each, best of <iterations>
+	NAIVE_EXPORT void BenchmarkDecoder(std::wstring path, int iterations = 10);
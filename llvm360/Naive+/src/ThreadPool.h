@@ -0,0 +1,148 @@
+#pragma once
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+// Fixed size worker pool shared by the loader and decoder
+// parallelFor is the main entry point: the calling thread takes part in the work, so it
+// can be used from inside a task (or with every worker busy) without deadlocking
+class ThreadPool
+{
+public:
+    // <threads> = 0 uses one worker per hardware thread (minus the caller)
+    explicit ThreadPool(size_t threads = 0)
+    {
+        if (threads == 0)
+        {
+            size_t hw = std::thread::hardware_concurrency();
+            threads = hw > 1 ? hw - 1 : 0;
+        }
+        for (size_t i = 0; i < threads; i++)
+        {
+            m_workers.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        for (std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    static ThreadPool& global()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    // number of threads that can run a parallelFor at once (workers + caller)
+    size_t getConcurrency() const { return m_workers.size() + 1; }
+
+    void submit(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.push_back(std::move(task));
+        }
+        m_cv.notify_one();
+    }
+
+    // run fn(i) for every i in [0, count) and wait for all of them
+    // indices are handed out dynamically, fn must not depend on which thread runs it
+    void parallelFor(size_t count, const std::function<void(size_t)>& fn)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+        if (count == 1 || m_workers.empty())
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                fn(i);
+            }
+            return;
+        }
+
+        struct Job
+        {
+            std::atomic<size_t> next{ 0 };
+            std::atomic<size_t> done{ 0 };
+            size_t count = 0;
+            const std::function<void(size_t)>* fn = nullptr;
+            std::mutex mutex;
+            std::condition_variable cv;
+        };
+        auto job = std::make_shared<Job>();
+        job->count = count;
+        job->fn = &fn;
+
+        auto run = [job]
+        {
+            size_t finished = 0;
+            size_t i;
+            while ((i = job->next.fetch_add(1)) < job->count)
+            {
+                (*job->fn)(i);
+                finished++;
+            }
+            if (finished && job->done.fetch_add(finished) + finished == job->count)
+            {
+                std::lock_guard<std::mutex> lock(job->mutex);
+                job->cv.notify_all();
+            }
+        };
+
+        size_t helpers = std::min(count - 1, m_workers.size());
+        for (size_t i = 0; i < helpers; i++)
+        {
+            submit(run);
+        }
+        run();
+
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->cv.wait(lock, [&] { return job->done.load() == job->count; });
+    }
+
+private:
+    void workerLoop()
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                if (m_stop && m_tasks.empty())
+                {
+                    return;
+                }
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> m_workers;
+    std::deque<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_stop = false;
+};